@@ -33,7 +33,10 @@
 #include <OpenSim/Simulation/SimbodyEngine/FreeJoint.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
 #include <OpenSim/Simulation/SimulationUtilities.h>
+#include <OpenSim/Analyses/Actuation.h>
 #include <OpenSim/Analyses/BodyKinematics.h>
+#include <OpenSim/Analyses/ForceReporter.h>
+#include <OpenSim/Analyses/Kinematics.h>
 #include <OpenSim/Analyses/MuscleAnalysis.h>
 #include <OpenSim/Analyses/IMUDataReporter.h>
 #include <OpenSim/Actuators/ModelFactory.h>
@@ -58,6 +61,8 @@ void testIMUDataReporter();
 
 void testMuscleAnalysisSerialization();
 
+void testParallelAnalysis();
+
 int main()
 {
     SimTK::Array_<std::string> failures;
@@ -110,6 +115,12 @@ int main()
         cout << e.what() << endl;
         failures.push_back("testMuscleAnalysisSerialization");
     }
+    try {
+        testParallelAnalysis();
+    } catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testParallelAnalysis");
+    }
 
     if (!failures.empty()) {
         cout << "Done, with failure(s): " << failures << endl;
@@ -601,3 +612,83 @@ void testMuscleAnalysisSerialization()
     roundTrip = MuscleAnalysis("manalysis.xml");
     ASSERT(!roundTrip.getComputeMoments());
 }
+
+void testParallelAnalysis() {
+    // A double pendulum with a muscle spanning the first joint, so that the
+    // force and muscle analyses have something to report.
+    const auto createModel = []() {
+        Model model = ModelFactory::createNLinkPendulum(2);
+        auto* muscle = new Millard2012EquilibriumMuscle("muscle", 10, 0.5,
+                0.5, 0);
+        muscle->set_ignore_tendon_compliance(true);
+        muscle->addNewPathPoint("origin", model.getGround(),
+                SimTK::Vec3(0, 0.5, 0));
+        muscle->addNewPathPoint("insertion", model.getBodySet().get("b0"),
+                SimTK::Vec3(0));
+        model.addForce(muscle);
+        return model;
+    };
+
+    // Simulate a swinging pendulum to create states to analyze.
+    Model pendulum = createModel();
+    SimTK::State& state = pendulum.initSystem();
+    pendulum.getCoordinateSet()[0].setValue(state, 0.5);
+    pendulum.equilibrateMuscles(state);
+    Manager manager(pendulum);
+    manager.setIntegratorMaximumStepSize(0.005);
+    manager.initialize(state);
+    manager.integrate(2.0);
+    const Storage& states = manager.getStateStorage();
+
+    // Analyze the states with the given number of threads, and return copies
+    // of a selection of the results of each analysis.
+    const auto analyze = [&](int numThreads) {
+        Model model = createModel();
+        BodyKinematics* bodyKinematics = new BodyKinematics(&model);
+        bodyKinematics->setStepInterval(3);
+        model.addAnalysis(bodyKinematics);
+        Kinematics* kinematics = new Kinematics(&model);
+        model.addAnalysis(kinematics);
+        Actuation* actuation = new Actuation(&model);
+        model.addAnalysis(actuation);
+        ForceReporter* forceReporter = new ForceReporter(&model);
+        model.addAnalysis(forceReporter);
+        MuscleAnalysis* muscleAnalysis = new MuscleAnalysis(&model);
+        model.addAnalysis(muscleAnalysis);
+        SimTK::State& s = model.initSystem();
+        AnalyzeTool::run(s, model, 0, states.getSize() - 1, states, false,
+                numThreads);
+        std::vector<Storage> results;
+        results.push_back(*bodyKinematics->getPositionStorage());
+        results.push_back(*kinematics->getVelocityStorage());
+        results.push_back(*actuation->getForceStorage());
+        results.push_back(*actuation->getSpeedStorage());
+        results.push_back(*actuation->getPowerStorage());
+        results.push_back(forceReporter->getForceStorage());
+        results.push_back(*muscleAnalysis->getFiberLengthStorage());
+        results.push_back(*muscleAnalysis->getForceStorage());
+        return results;
+    };
+    const auto serial = analyze(1);
+    const auto parallel = analyze(4);
+
+    const auto compare = [](const Storage& expected, const Storage& actual) {
+        ASSERT(expected.getSize() > 0);
+        ASSERT_EQUAL(expected.getSize(), actual.getSize());
+        for (int i = 0; i < expected.getSize(); ++i) {
+            const StateVector& expectedRow = *expected.getStateVector(i);
+            const StateVector& actualRow = *actual.getStateVector(i);
+            ASSERT_EQUAL<double>(expectedRow.getTime(), actualRow.getTime(),
+                    1e-12);
+            ASSERT_EQUAL(expectedRow.getSize(), actualRow.getSize());
+            for (int j = 0; j < expectedRow.getSize(); ++j) {
+                ASSERT_EQUAL<double>(expectedRow.getData()[j],
+                        actualRow.getData()[j], 1e-10);
+            }
+        }
+    };
+    ASSERT_EQUAL(serial.size(), parallel.size());
+    for (int i = 0; i < (int)serial.size(); ++i) {
+        compare(serial[i], parallel[i]);
+    }
+}
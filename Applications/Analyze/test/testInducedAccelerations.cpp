@@ -28,6 +28,7 @@
 #include <OpenSim/Simulation/Control/PrescribedController.h>
 #include <OpenSim/Tools/AnalyzeTool.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+#include <OpenSim/Analyses/InducedAccelerations.h>
 #include <OpenSim/Analyses/InducedAccelerationsSolver.h>
 
 using namespace OpenSim;
@@ -50,13 +51,37 @@ int main()
         testDoublePendulum();
 
         AnalyzeTool analyze("subject02_Setup_IAA_02_232.xml");
+        std::clock_t startTime = std::clock();
         analyze.run();
+        cout << "Induced Accelerations of Running computed in "
+             << 1.e3*(std::clock()-startTime)/CLOCKS_PER_SEC << "ms" << endl;
         Storage result1("ResultsInducedAccelerations/subject02_running_arms_InducedAccelerations_center_of_mass.sto");
         Storage standard1("std_subject02_running_arms_InducedAccelerations_CENTER_OF_MASS.sto");
         CHECK_STORAGE_AGAINST_STANDARD(result1, standard1,
             std::vector<double>(result1.getSmallestNumberOfStates(), 0.15),
             __FILE__, __LINE__, "Induced Accelerations of Running failed");
         cout << "Induced Accelerations of Running passed\n" << endl;
+
+        // Compute the contributions of gravity and the muscles by linear
+        // superposition and compare to the solve for each contributor.
+        AnalyzeTool analyzeSuperposition("subject02_Setup_IAA_02_232.xml");
+        analyzeSuperposition.setName(
+                analyze.getName() + "_superposition");
+        InducedAccelerations& iaa = dynamic_cast<InducedAccelerations&>(
+                analyzeSuperposition.updAnalysisSet().get(
+                        "InducedAccelerations"));
+        iaa.setUseLinearSuperposition(true);
+        startTime = std::clock();
+        analyzeSuperposition.run();
+        cout << "Induced Accelerations of Running with linear superposition "
+             << "computed in "
+             << 1.e3*(std::clock()-startTime)/CLOCKS_PER_SEC << "ms" << endl;
+        Storage result2("ResultsInducedAccelerations/subject02_running_arms_superposition_InducedAccelerations_center_of_mass.sto");
+        CHECK_STORAGE_AGAINST_STANDARD(result2, result1,
+            std::vector<double>(result1.getSmallestNumberOfStates(), 1e-6),
+            __FILE__, __LINE__,
+            "Induced Accelerations of Running with linear superposition failed");
+        cout << "Induced Accelerations of Running with linear superposition passed\n" << endl;
     }
     catch (const OpenSim::Exception& e) {
         e.print(cerr);
@@ -25,6 +25,8 @@
 #include <OpenSim/OpenSim.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 
+#include <ctime>
+
 using namespace OpenSim;
 using namespace std;
 
@@ -66,6 +68,39 @@ int main()
             std::vector<double>(standard4.getSmallestNumberOfStates(), 1e-5), __FILE__, __LINE__,
             "DoublePendulum3D_FrameKeyword failed");
         cout << "DoublePendulum3D_FrameKeyword passed" << endl;
+
+        // Compute the reactions at all joints of a full-body model with one
+        // and with multiple threads, and report the time of each.
+        std::vector<Storage> fullBodyResults;
+        for (int numThreads : {1, 4}) {
+            const std::string name =
+                    "subject02_threads" + std::to_string(numThreads);
+            AnalyzeTool analyzeFullBody;
+            analyzeFullBody.setName(name);
+            analyzeFullBody.setModelFilename(
+                    "subject02_running_RRA_cycle02_sim02_07_v232.osim");
+            analyzeFullBody.setCoordinatesFileName(
+                    "subject02_running_arms_ik.mot");
+            analyzeFullBody.setInitialTime(0);
+            analyzeFullBody.setFinalTime(2);
+            analyzeFullBody.setNumThreads(numThreads);
+            JointReaction jointReaction;
+            jointReaction.setName("JointReaction");
+            analyzeFullBody.updAnalysisSet().cloneAndAppend(jointReaction);
+            std::clock_t startTime = std::clock();
+            analyzeFullBody.run();
+            cout << "Full-body joint reactions with " << numThreads
+                 << " thread(s) computed in "
+                 << 1.e3*(std::clock()-startTime)/CLOCKS_PER_SEC << "ms"
+                 << endl;
+            fullBodyResults.emplace_back(
+                    name + "_JointReaction_ReactionLoads.sto");
+        }
+        CHECK_STORAGE_AGAINST_STANDARD(fullBodyResults[1], fullBodyResults[0],
+            std::vector<double>(
+                    fullBodyResults[0].getSmallestNumberOfStates(), 1e-8),
+            __FILE__, __LINE__, "Full-body joint reactions in parallel failed");
+        cout << "Full-body joint reactions in parallel passed" << endl;
     }
     catch (const std::exception& e) {
         cout << e.what() << endl;
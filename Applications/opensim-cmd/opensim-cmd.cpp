@@ -24,6 +24,8 @@
 #include "opensim-cmd_info.h"
 #include "opensim-cmd_print-xml.h"
 #include "opensim-cmd_run-tool.h"
+#include "opensim-cmd_snapshot.h"
+#include "opensim-cmd_sweep.h"
 #include "opensim-cmd_update-file.h"
 #include "opensim-cmd_viz.h"
 #include "parse_arguments.h"
@@ -41,13 +43,14 @@ static const char HELP[] =
 R"(OpenSim: musculoskeletal modeling and simulation.
 
 Usage:
-  opensim-cmd [--library=<path>]... [--log=<level>] <command> [<args>...]
+  opensim-cmd [--library=<path>]... [--log=<level>] [--trace=<file>] <command> [<args>...]
   opensim-cmd -h | --help
   opensim-cmd -V | --version
 
 Options:
   -L <path>, --library <path>  Load a plugin.
   -o <level>, --log <level>  Logging level.
+  --trace <file>  Record a performance trace.
   -h, --help     Show this help description.
   -V, --version  Show the version number.
 
@@ -57,6 +60,8 @@ Available commands:
   info         Show description of properties in an OpenSim class.
   update-file  Update an .xml file (.osim or setup) to this version's format.
   viz          Show a model, motion, or data with the Simbody Visualizer.
+  sweep        Solve variations of a MocoStudy (e.g., a parameter sweep).
+  snapshot     Create a binary snapshot of a model for fast loading.
 
   Pass -h or --help to any of these commands to learn how to use them.
 
@@ -70,6 +75,12 @@ Description of options:
   o, log      Control the verbosity of OpenSim's console output.
               Levels: off, critical, error, warn, info, debug, trace.
               Default: info.
+  trace       Record the time spent in OpenSim's instrumented code (e.g.,
+              integration, realizing the model, computing muscle equilibrium,
+              and each frame of a Tool) while running the command. Afterwards,
+              the timeline is written to <file> in the Chrome trace (JSON)
+              format, which you can open with https://ui.perfetto.dev, and a
+              summary table is logged.
 
 Examples:
   opensim-cmd run-tool InverseDynamics_Setup.xml
@@ -79,6 +90,7 @@ Examples:
   opensim-cmd -L C:\Plugins\osimMyCustomForce.dll run-tool CMC_setup.xml
   opensim-cmd --library ../plugins/libosimMyPlugin.so print-xml MyCustomTool
   opensim-cmd --library=libosimMyCustomForce.dylib --log=debug info MyCustomForce
+  opensim-cmd --trace=ik_trace.json run-tool IK_setup.xml
 
 )";
 
@@ -86,6 +98,20 @@ int main(int argc, const char** argv) {
 
     using namespace OpenSim;
 
+    // Set by --trace. The trace and summary are written even if the command
+    // throws, since that is when a trace is most useful.
+    std::string traceFile;
+    const auto writeTrace = [&traceFile]() {
+        if (traceFile.empty()) return;
+        // Clear the filename first so that the trace is not written again if
+        // writing it throws.
+        const std::string filename = std::move(traceFile);
+        traceFile.clear();
+        Instrumentation::setEnabled(false);
+        Instrumentation::writeChromeTrace(filename);
+        Instrumentation::logSummary();
+    };
+
     try {
 
     // Register the available commands.
@@ -97,6 +123,8 @@ int main(int argc, const char** argv) {
     commands["info"] = info;
     commands["update-file"] = update_file;
     commands["viz"] = viz;
+    commands["sweep"] = sweep;
+    commands["snapshot"] = snapshot;
 
     // If no arguments are provided; just print the help text.
     // -------------------------------------------------------
@@ -129,6 +157,13 @@ int main(int argc, const char** argv) {
         Logger::setLevelString(args["--log"].asString());
     }
 
+    // Instrumentation.
+    // ----------------
+    if (args["--trace"]) {
+        traceFile = args["--trace"].asString();
+        Instrumentation::setEnabled(true);
+    }
+
     // Did the user provide a valid command?
     // -------------------------------------
     if (!args["<command>"]) {
@@ -148,11 +183,19 @@ int main(int argc, const char** argv) {
     // Dispatch to the requested command.
     // ----------------------------------
     // Each command returns whether or not it succeeded.
-    return commands.at(command)(argc, argv);
+    const int status = commands.at(command)(argc, argv);
+
+    writeTrace();
+    return status;
 
 
     } catch (const std::exception& e) {
         log_error(e.what());
+        try {
+            writeTrace();
+        } catch (const std::exception& traceError) {
+            log_error(traceError.what());
+        }
         return EXIT_FAILURE;
     }
 
@@ -38,6 +38,7 @@ Usage:
 Options:
   -L <path>, --library <path>  Load a plugin.
   -o <level>, --log <level>  Logging level.
+  --trace <file>  Record a performance trace.
 
 Description:
   If you do not supply any arguments, you get a list of all registered
@@ -38,6 +38,7 @@ Usage:
 Options:
   -L <path>, --library <path>  Load a plugin.
   -o <level>, --log <level>  Logging level.
+  --trace <file>  Record a performance trace.
 
 Description:
   The argument <tool-or-class> can be the name of a Tool
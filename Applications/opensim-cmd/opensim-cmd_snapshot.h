@@ -0,0 +1,114 @@
+#ifndef OPENSIM_CMD_SNAPSHOT_H_
+#define OPENSIM_CMD_SNAPSHOT_H_
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  opensim-cmd_snapshot.h                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <iostream>
+
+#include <docopt.h>
+#include "parse_arguments.h"
+
+static const char HELP_SNAPSHOT[] =
+R"(Create a binary snapshot of a model that loads faster than the .osim file.
+
+Usage:
+  opensim-cmd [options]... snapshot <model-file> <snapshot-file> [--benchmark=<n>]
+  opensim-cmd snapshot -h | --help
+
+Options:
+  -L <path>, --library <path>  Load a plugin.
+  -o <level>, --log <level>  Logging level.
+  --trace <file>  Record a performance trace.
+  -b <n>, --benchmark <n>  Compare load times of the two files n times.
+
+Description:
+  The snapshot contains the model's properties in a binary form that can be
+  read without parsing XML (see the documentation for ModelSnapshot). Load
+  the snapshot with ModelSnapshot::read().
+
+  A snapshot can only be read by the same version of OpenSim on a machine
+  with the same byte order. Keep the .osim file, and create the snapshot
+  again after updating OpenSim.
+
+  With --benchmark, the .osim file and the snapshot are each loaded (and the
+  model's system is created with initSystem()) n times, and the average times
+  are printed.
+
+Examples:
+  opensim-cmd snapshot gait2354.osim gait2354.osnap
+  opensim-cmd snapshot gait2354.osim gait2354.osnap --benchmark=10
+)";
+
+int snapshot(int argc, const char** argv) {
+
+    using namespace OpenSim;
+
+    std::map<std::string, docopt::value> args = OpenSim::parse_arguments(
+            HELP_SNAPSHOT, { argv + 1, argv + argc },
+            true); // show help if requested
+
+    const std::string modelFile = args["<model-file>"].asString();
+    const std::string snapshotFile = args["<snapshot-file>"].asString();
+
+    ModelSnapshot::write(Model(modelFile), snapshotFile);
+
+    if (args["--benchmark"]) {
+        const int numLoads = std::stoi(args["--benchmark"].asString());
+        if (numLoads < 1) {
+            throw Exception("Expected --benchmark to be positive, but got " +
+                            std::to_string(numLoads) + ".");
+        }
+        // Only the times are of interest.
+        const auto level = Logger::getLevel();
+        Logger::setLevel(Logger::Level::Warn);
+        double xmlLoadTime = 0;
+        double xmlTotalTime = 0;
+        double snapshotLoadTime = 0;
+        double snapshotTotalTime = 0;
+        for (int i = 0; i < numLoads; ++i) {
+            {
+                Stopwatch watch;
+                Model model(modelFile);
+                xmlLoadTime += watch.getElapsedTime();
+                model.initSystem();
+                xmlTotalTime += watch.getElapsedTime();
+            }
+            {
+                Stopwatch watch;
+                auto model = ModelSnapshot::read(snapshotFile);
+                snapshotLoadTime += watch.getElapsedTime();
+                model->initSystem();
+                snapshotTotalTime += watch.getElapsedTime();
+            }
+        }
+        Logger::setLevel(level);
+        log_info("Average over {} loads (load; load + initSystem()):",
+                numLoads);
+        log_info("  {}: {:.4f} s; {:.4f} s", modelFile,
+                xmlLoadTime / numLoads, xmlTotalTime / numLoads);
+        log_info("  {}: {:.4f} s; {:.4f} s", snapshotFile,
+                snapshotLoadTime / numLoads, snapshotTotalTime / numLoads);
+    }
+    return EXIT_SUCCESS;
+}
+
+#endif // OPENSIM_CMD_SNAPSHOT_H_
@@ -0,0 +1,234 @@
+#ifndef OPENSIM_CMD_SWEEP_H_
+#define OPENSIM_CMD_SWEEP_H_
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  opensim-cmd_sweep.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#ifndef _WIN32
+#include <sys/wait.h>
+#endif
+
+#include <docopt.h>
+#include "parse_arguments.h"
+
+static const char HELP_SWEEP[] =
+R"(Solve variations of a MocoStudy with overridden property values.
+
+Usage:
+  opensim-cmd [options]... sweep <omoco-file> <overrides-file> [--results=<dir>] [--workers=<n>] [--threads-per-solve=<n>] [--processes=<n>] [--partition=<i/n>]
+  opensim-cmd sweep -h | --help
+
+Options:
+  -L <path>, --library <path>  Load a plugin.
+  -o <level>, --log <level>  Logging level.
+  --trace <file>  Record a performance trace.
+  -r <dir>, --results <dir>  Directory for solutions and checkpoints.
+  -w <n>, --workers <n>  Number of solves in parallel in each process.
+  -t <n>, --threads-per-solve <n>  Threads used by each solve.
+  -p <n>, --processes <n>  Number of worker processes to launch.
+  --partition <i/n>  Only solve runs i, i + n, i + 2n, etc.
+
+Description:
+  The <overrides-file> is a comma-separated file whose first row contains
+  property paths (e.g., problem/phases/0/goals/effort/weight) and whose other
+  rows contain the values for each run. A column named "name" provides the
+  names of the runs. See the documentation for MocoSweep.
+
+  Each finished run writes its solution and a checkpoint to the results
+  directory (default: the current directory); if the sweep is interrupted,
+  running the same command again skips the runs that succeeded. A summary of all
+  runs is written to sweep_summary.csv.
+
+  By default, one solve runs at a time and each solve uses one thread. With
+  --processes, this command launches that many copies of itself, each solving
+  a partition of the runs, and then solves any runs that remain. With --trace,
+  process i writes its trace to <file>.i.
+
+  The command fails if any run fails.
+
+Examples:
+  opensim-cmd sweep study.omoco weights.csv --results=sweep --processes=8
+  opensim-cmd sweep study.omoco weights.csv -r sweep -w 2 -t 4
+  opensim-cmd sweep study.omoco weights.csv -r sweep --partition=3/16
+)";
+
+// Quote an argument for the shell used by std::system().
+static std::string quoteSweepArgument(const std::string& arg) {
+#ifdef _WIN32
+    // Backslashes are literal unless they precede a quote.
+    std::string quoted = "\"";
+    int numBackslashes = 0;
+    for (const char c : arg) {
+        if (c == '\\') {
+            ++numBackslashes;
+        } else {
+            if (c == '"') quoted.append(numBackslashes + 1, '\\');
+            numBackslashes = 0;
+        }
+        quoted += c;
+    }
+    quoted.append(numBackslashes, '\\');
+    return quoted + "\"";
+#else
+    std::string quoted = "'";
+    for (const char c : arg) {
+        if (c == '\'') quoted += "'\\''";
+        else quoted += c;
+    }
+    return quoted + "'";
+#endif
+}
+
+// The exit code of a command run with std::system(), or -1 if the command
+// did not exit normally (e.g., it crashed).
+static int getSweepExitCode(int status) {
+#ifdef _WIN32
+    return status;
+#else
+    if (status == -1 || !WIFEXITED(status)) return -1;
+    return WEXITSTATUS(status);
+#endif
+}
+
+int sweep(int argc, const char** argv) {
+
+    using namespace OpenSim;
+
+    std::map<std::string, docopt::value> args = OpenSim::parse_arguments(
+            HELP_SWEEP, { argv + 1, argv + argc },
+            true); // show help if requested
+
+    const auto& omocoFile = args["<omoco-file>"].asString();
+    const auto& overridesFile = args["<overrides-file>"].asString();
+
+    MocoSweep sweep{MocoStudy(omocoFile)};
+    sweep.setOverridesFromFile(overridesFile);
+    if (args["--results"]) {
+        sweep.setResultsDirectory(args["--results"].asString());
+    }
+    if (args["--workers"]) {
+        sweep.setNumWorkers(std::stoi(args["--workers"].asString()));
+    }
+    if (args["--threads-per-solve"]) {
+        sweep.setThreadsPerSolve(
+                std::stoi(args["--threads-per-solve"].asString()));
+    }
+    if (args["--partition"]) {
+        const auto& partition = args["--partition"].asString();
+        const auto slash = partition.find('/');
+        if (slash == std::string::npos) {
+            throw Exception("Expected --partition to have the form i/n, but "
+                            "got '" + partition + "'.");
+        }
+        sweep.setPartition(std::stoi(partition.substr(0, slash)),
+                std::stoi(partition.substr(slash + 1)));
+    }
+
+    if (args["--processes"]) {
+        // Launch copies of this command, each with its own partition. The
+        // options before "sweep" (e.g., plugins to load) are passed along,
+        // except that each process writes its trace (if any) to its own file,
+        // <file>.<i>, so that the processes do not overwrite each other's
+        // trace or the trace of this process.
+        const int numProcesses = std::stoi(args["--processes"].asString());
+        std::string commandBeforeTrace;
+        std::string command;
+        std::string traceFile;
+        for (int i = 0; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "-p" || arg == "--processes" || arg == "--partition") {
+                ++i; // Skip the value as well.
+                continue;
+            }
+            if (arg == "--trace" || arg.compare(0, 8, "--trace=") == 0) {
+                if (arg == "--trace") {
+                    if (++i < argc) traceFile = argv[i];
+                } else {
+                    traceFile = arg.substr(8);
+                }
+                commandBeforeTrace = command;
+                command.clear();
+                continue;
+            }
+            // -p<n> (e.g., -p8), but not other arguments starting with -p.
+            const bool isShortProcesses = arg.size() > 2 &&
+                    arg.compare(0, 2, "-p") == 0 &&
+                    arg.find_first_not_of("0123456789", 2) ==
+                            std::string::npos;
+            if (arg.compare(0, 12, "--processes=") == 0 ||
+                    arg.compare(0, 12, "--partition=") == 0 ||
+                    isShortProcesses) {
+                continue;
+            }
+            command += quoteSweepArgument(arg) + " ";
+        }
+        log_info("Launching {} worker processes.", numProcesses);
+        std::vector<int> exitCodes(numProcesses, 0);
+        std::vector<std::thread> processes;
+        for (int p = 0; p < numProcesses; ++p) {
+            std::string processCommand = commandBeforeTrace;
+            if (!traceFile.empty()) {
+                processCommand += quoteSweepArgument(
+                        "--trace=" + traceFile + "." + std::to_string(p)) + " ";
+            }
+            processCommand += command + "--partition=" + std::to_string(p) +
+                    "/" + std::to_string(numProcesses);
+            processes.emplace_back([processCommand, p, &exitCodes]() {
+                exitCodes[p] = getSweepExitCode(
+                        std::system(processCommand.c_str()));
+            });
+        }
+        for (auto& process : processes) process.join();
+        // Runs that the failed processes did not finish are solved below.
+        for (int p = 0; p < numProcesses; ++p) {
+            if (exitCodes[p] == -1) {
+                log_warn("Worker process {} did not exit normally.", p);
+            } else if (exitCodes[p] != 0) {
+                log_warn("Worker process {} exited with code {}.", p,
+                        exitCodes[p]);
+            }
+        }
+        // The worker processes already attempted their runs; do not solve
+        // the failed ones again.
+        sweep.setRetryFailedRuns(false);
+    }
+
+    // Without --processes, this solves this process's runs. With
+    // --processes, the runs attempted by the worker processes are read from
+    // their checkpoints, and only runs without a checkpoint (e.g., because a
+    // worker crashed) are solved here.
+    const auto results = sweep.run();
+    int numFailed = 0;
+    for (const auto& result : results) {
+        if (!result.success) ++numFailed;
+    }
+    if (numFailed) {
+        log_error("{} of {} runs failed; see {}.", numFailed, results.size(),
+                sweep.getResultsDirectory());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+#endif // OPENSIM_CMD_SWEEP_H_
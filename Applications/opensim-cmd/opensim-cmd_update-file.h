@@ -38,6 +38,7 @@ Usage:
 Options:
   -L <path>, --library <path>  Load a plugin.
   -o <level>, --log <level>  Logging level.
+  --trace <file>  Record a performance trace.
 
 Description:
   In an OpenSim XML file, the XML file format version appears as
@@ -23,6 +23,7 @@
 
 #include <SimTKcommon/Testing.h>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <regex>
@@ -229,6 +230,21 @@ void testNoCommand() {
         testCommand("-L=x --library=y -L=z", EXIT_FAILURE, output);
     }
 
+    // Trace option.
+    // =============
+    testCommand("--trace", EXIT_FAILURE,
+            ContainsSubstring("--trace requires an argument"));
+    testCommand("--trace=testCommandLineInterface_trace.json info Body mass",
+            EXIT_SUCCESS,
+            ContainsSubstring("Wrote 0 instrumentation events to "
+                              "'testCommandLineInterface_trace.json'."));
+    // The trace is written even if the command throws.
+    testCommand("--trace=testCommandLineInterface_trace_failure.json "
+                "run-tool putes.xml",
+            EXIT_FAILURE,
+            ContainsSubstring("instrumentation events to "
+                              "'testCommandLineInterface_trace_failure.json'."));
+
     // Unrecognized command.
     // =====================
     std::string str_bleepbloop("'bleepbloop' is not an opensim-cmd command. "
@@ -490,6 +506,80 @@ void testUpdateFile() {
     testLoadPluginLibraries("update-file");
 }
 
+void testSweep() {
+    // Help.
+    // =====
+    {
+        StartsWith output("Solve variations of a MocoStudy");
+        testCommand("sweep -h", EXIT_SUCCESS, output);
+        testCommand("sweep --help", EXIT_SUCCESS, output);
+    }
+
+    // Error messages.
+    // ===============
+    testCommand("sweep", EXIT_FAILURE,
+            ContainsSubstring("Arguments did not match expected patterns"));
+    testCommand("print-xml MocoStudy testsweep_study.omoco", EXIT_SUCCESS,
+            ContainsSubstring("Printing 'testsweep_study.omoco'.\n"));
+    testCommand("sweep testsweep_study.omoco nonexistent.csv", EXIT_FAILURE,
+            ContainsSubstring("Could not open the overrides file "
+                              "'nonexistent.csv'."));
+    {
+        std::ofstream overrides("testsweep_overrides.csv");
+        overrides << "name,problem/nonexistent\n" << "a,1\n";
+    }
+    testCommand("sweep testsweep_study.omoco testsweep_overrides.csv "
+                "--results=testsweep_results",
+            EXIT_FAILURE, ContainsSubstring("'nonexistent' in property path "
+                                            "'problem/nonexistent'"));
+
+    // Each worker process writes its own trace, and the trace of this
+    // process is not overwritten.
+    {
+        std::ofstream overrides("testsweep_overrides.csv");
+        overrides << "name,solver/num_mesh_intervals\n"
+                  << "a,-1\n" << "b,-1\n";
+    }
+    testCommand("--trace=testsweep_trace.json sweep testsweep_study.omoco "
+                "testsweep_overrides.csv --results=testsweep_results "
+                "--processes=2",
+            EXIT_FAILURE,
+            std::regex("(?=" + RE_ANY + "'testsweep_trace\\.json\\.0'\\.)"
+                       "(?=" + RE_ANY + "'testsweep_trace\\.json\\.1'\\.)" +
+                       RE_ANY + "instrumentation events to "
+                       "'testsweep_trace\\.json'\\." + RE_ANY));
+}
+
+void testSnapshot() {
+    // Help.
+    // =====
+    {
+        StartsWith output("Create a binary snapshot of a model");
+        testCommand("snapshot -h", EXIT_SUCCESS, output);
+        testCommand("snapshot --help", EXIT_SUCCESS, output);
+    }
+
+    // Error messages.
+    // ===============
+    testCommand("snapshot", EXIT_FAILURE,
+            ContainsSubstring("Arguments did not match expected patterns"));
+
+    // Successful input.
+    // =================
+    testCommand("print-xml Model testsnapshot_Model.osim", EXIT_SUCCESS,
+            ContainsSubstring("Printing 'testsnapshot_Model.osim'.\n"));
+    testCommand("snapshot testsnapshot_Model.osim testsnapshot_Model.osnap",
+            EXIT_SUCCESS,
+            ContainsSubstring("to file testsnapshot_Model.osnap.\n"));
+    testCommand("snapshot testsnapshot_Model.osim testsnapshot_Model.osnap "
+                "--benchmark=2",
+            EXIT_SUCCESS, ContainsSubstring("Average over 2 loads"));
+    testCommand("snapshot testsnapshot_Model.osim testsnapshot_Model.osnap "
+                "--benchmark=0",
+            EXIT_FAILURE,
+            ContainsSubstring("Expected --benchmark to be positive"));
+}
+
 int main() {
     SimTK_START_TEST("testCommandLineInterface");
         SimTK_SUBTEST(testNoCommand);
@@ -497,5 +587,7 @@ int main() {
         SimTK_SUBTEST(testPrintXML);
         SimTK_SUBTEST(testInfo);
         SimTK_SUBTEST(testUpdateFile);
+        SimTK_SUBTEST(testSweep);
+        SimTK_SUBTEST(testSnapshot);
     SimTK_END_TEST();
 }
@@ -16,6 +16,7 @@
 #include <OpenSim/Actuators/Millard2012AccelerationMuscle.h>
 #include <OpenSim/Actuators/McKibbenActuator.h>
 #include <OpenSim/Actuators/DeGrooteFregly2016Muscle.h>
+#include <OpenSim/Actuators/DeGrooteFregly2016MuscleBatch.h>
 
 #include <OpenSim/Actuators/ModelFactory.h>
 #include <OpenSim/Actuators/ModelProcessor.h>
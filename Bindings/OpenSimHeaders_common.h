@@ -61,6 +61,7 @@
 #include <OpenSim/Common/TRCFileAdapter.h>
 #include <OpenSim/Common/TableSource.h>
 #include <OpenSim/Common/TableUtilities.h>
+#include <OpenSim/Common/TableResampler.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
 #include <OpenSim/Common/Units.h>
 #include <OpenSim/Common/XYFunctionInterface.h>
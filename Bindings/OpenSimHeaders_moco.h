@@ -37,6 +37,8 @@
 #include <OpenSim/Moco/MocoParameter.h>
 #include <OpenSim/Moco/MocoProblem.h>
 #include <OpenSim/Moco/MocoStudy.h>
+#include <OpenSim/Moco/MocoSolutionCache.h>
+#include <OpenSim/Moco/MocoSweep.h>
 #include <OpenSim/Moco/MocoStudyFactory.h>
 #include <OpenSim/Moco/MocoTrack.h>
 #include <OpenSim/Moco/MocoTrajectory.h>
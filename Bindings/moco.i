@@ -138,10 +138,15 @@ namespace OpenSim {
 %include <OpenSim/Moco/MocoTropterSolver.h>
 %include <OpenSim/Moco/MocoCasADiSolver/MocoCasADiSolver.h>
 %include <OpenSim/Moco/MocoStudy.h>
+%include <OpenSim/Moco/MocoSolutionCache.h>
+%include <OpenSim/Moco/MocoSweep.h>
 %include <OpenSim/Moco/MocoStudyFactory.h>
 
 %include <OpenSim/Moco/MocoTool.h>
 %include <OpenSim/Moco/MocoInverse.h>
+%template(StdVectorTableProcessor) std::vector<OpenSim::TableProcessor>;
+%template(StdVectorMocoInverseSolution)
+        std::vector<OpenSim::MocoInverseSolution>;
 %include <OpenSim/Moco/MocoTrack.h>
 
 %include <OpenSim/Moco/MocoUtilities.h>
@@ -337,6 +337,15 @@ void DeGrooteFregly2016Muscle::calcMuscleDynamicsInfoHelper(
         const SimTK::Real& activation, const bool& ignoreTendonCompliance,
         const MuscleLengthInfo& mli, const FiberVelocityInfo& fvi,
         MuscleDynamicsInfo& mdi, const SimTK::Real& normTendonForce) const {
+    calcMuscleDynamicsInfoHelper(getDynamicsParameters(), activation,
+            ignoreTendonCompliance, mli, fvi, mdi, normTendonForce);
+}
+
+void DeGrooteFregly2016Muscle::calcMuscleDynamicsInfoHelper(
+        const DynamicsParameters& p, const SimTK::Real& activation,
+        const bool& ignoreTendonCompliance, const MuscleLengthInfo& mli,
+        const FiberVelocityInfo& fvi, MuscleDynamicsInfo& mdi,
+        const SimTK::Real& normTendonForce) {
 
     mdi.activation = activation;
 
@@ -344,7 +353,7 @@ void DeGrooteFregly2016Muscle::calcMuscleDynamicsInfoHelper(
     SimTK::Real conPassiveFiberForce;
     SimTK::Real nonConPassiveFiberForce;
     SimTK::Real totalFiberForce;
-    calcFiberForce(mdi.activation, mli.fiberActiveForceLengthMultiplier,
+    calcFiberForce(p, mdi.activation, mli.fiberActiveForceLengthMultiplier,
             fvi.fiberForceVelocityMultiplier,
             mli.fiberPassiveForceLengthMultiplier, fvi.normFiberVelocity,
             activeFiberForce, conPassiveFiberForce, nonConPassiveFiberForce,
@@ -368,7 +377,7 @@ void DeGrooteFregly2016Muscle::calcMuscleDynamicsInfoHelper(
 
     // Compute force entries.
     // ----------------------
-    const auto maxIsometricForce = get_max_isometric_force();
+    const auto maxIsometricForce = p.maxIsometricForce;
     mdi.fiberForce = totalFiberForce;
     mdi.activeFiberForce = activeFiberForce;
     mdi.passiveFiberForce = passiveFiberForce;
@@ -385,10 +394,11 @@ void DeGrooteFregly2016Muscle::calcMuscleDynamicsInfoHelper(
 
     // Compute stiffness entries.
     // --------------------------
-    mdi.fiberStiffness = calcFiberStiffness(mdi.activation, mli.normFiberLength,
-            fvi.fiberForceVelocityMultiplier);
+    mdi.fiberStiffness = calcFiberStiffness(p, mdi.activation,
+            mli.normFiberLength, fvi.fiberForceVelocityMultiplier);
     const auto& partialPennationAnglePartialFiberLength =
-            calcPartialPennationAnglePartialFiberLength(mli.fiberLength);
+            calcPartialPennationAnglePartialFiberLength(
+                    p.fiberWidth, mli.fiberLength);
     const auto& partialFiberForceAlongTendonPartialFiberLength =
             calcPartialFiberForceAlongTendonPartialFiberLength(mdi.fiberForce,
                     mdi.fiberStiffness, mli.sinPennationAngle,
@@ -398,12 +408,14 @@ void DeGrooteFregly2016Muscle::calcMuscleDynamicsInfoHelper(
             mli.fiberLength, partialFiberForceAlongTendonPartialFiberLength,
             mli.sinPennationAngle, mli.cosPennationAngle,
             partialPennationAnglePartialFiberLength);
-    mdi.tendonStiffness = calcTendonStiffness(mli.normTendonLength);
+    mdi.tendonStiffness = ignoreTendonCompliance
+                                  ? SimTK::Infinity
+                                  : calcTendonStiffness(p, mli.normTendonLength);
 
     const auto& partialTendonForcePartialFiberLength =
-            calcPartialTendonForcePartialFiberLength(mdi.tendonStiffness,
-                    mli.fiberLength, mli.sinPennationAngle,
-                    mli.cosPennationAngle);
+            calcPartialTendonForcePartialFiberLength(p.fiberWidth,
+                    mdi.tendonStiffness, mli.fiberLength,
+                    mli.sinPennationAngle, mli.cosPennationAngle);
 
     // Compute power entries.
     // ----------------------
@@ -398,13 +398,8 @@ public:
     /// property.
     SimTK::Real calcActiveForceLengthMultiplier(
             const SimTK::Real& normFiberLength) const {
-        const double& scale = get_active_force_width_scale();
-        // Shift the curve so its peak is at the origin, scale it
-        // horizontally, then shift it back so its peak is still at x = 1.0.
-        const double x = (normFiberLength - 1.0) / scale + 1.0;
-        return calcGaussianLikeCurve(x, b11, b21, b31, b41) +
-               calcGaussianLikeCurve(x, b12, b22, b32, b42) +
-               calcGaussianLikeCurve(x, b13, b23, b33, b43);
+        return calcActiveForceLengthMultiplier(
+                normFiberLength, get_active_force_width_scale());
     }
 
     /// The derivative of the active force-length curve with respect to
@@ -414,14 +409,8 @@ public:
     /// derivative curve.
     SimTK::Real calcActiveForceLengthMultiplierDerivative(
             const SimTK::Real& normFiberLength) const {
-        const double& scale = get_active_force_width_scale();
-        // Shift the curve so its peak is at the origin, scale it
-        // horizontally, then shift it back so its peak is still at x = 1.0.
-        const double x = (normFiberLength - 1.0) / scale + 1.0;
-        return (1.0 / scale) *
-               (calcGaussianLikeCurveDerivative(x, b11, b21, b31, b41) +
-                       calcGaussianLikeCurveDerivative(x, b12, b22, b32, b42) +
-                       calcGaussianLikeCurveDerivative(x, b13, b23, b33, b43));
+        return calcActiveForceLengthMultiplierDerivative(
+                normFiberLength, get_active_force_width_scale());
     }
 
     /// The parameters of this curve are not modifiable, so this function is
@@ -466,12 +455,8 @@ public:
         if (get_ignore_passive_fiber_force()) return 0;
 
         const double& e0 = get_passive_fiber_strain_at_one_norm_force();
-
-        const double offset =
-                exp(kPE * (m_minNormFiberLength - 1.0) / e0);
-        const double denom = exp(kPE) - offset;
-
-        return (exp(kPE * (normFiberLength - 1.0) / e0) - offset) / denom;
+        return calcPassiveForceMultiplier(
+                normFiberLength, e0, calcPassiveForceOffset(e0));
     }
 
     /// This is the derivative of the passive force-length curve with respect to
@@ -481,11 +466,8 @@ public:
         if (get_ignore_passive_fiber_force()) return 0;
 
         const double& e0 = get_passive_fiber_strain_at_one_norm_force();
-
-        const double offset = exp(kPE * (m_minNormFiberLength - 1) / e0);
-
-        return (kPE * exp((kPE * (normFiberLength - 1)) / e0)) /
-               (e0 * (exp(kPE) - offset));
+        return calcPassiveForceMultiplierDerivative(
+                normFiberLength, e0, calcPassiveForceOffset(e0));
     }
 
     /// This is the integral of the passive force-length curve with respect to
@@ -520,7 +502,8 @@ public:
     /// normalized tendon length.
     SimTK::Real calcTendonForceMultiplierDerivative(
             const SimTK::Real& normTendonLength) const {
-        return c1 * getTendonStiffnessParameter() * exp(getTendonStiffnessParameter() * (normTendonLength - c2));
+        return calcTendonForceMultiplierDerivative(
+                normTendonLength, getTendonStiffnessParameter());
     }
 
     /// This is the integral of the tendon-force length curve with respect to
@@ -545,8 +528,8 @@ public:
     /// normalized tendon length as a function of the normalized tendon force.
     SimTK::Real calcTendonForceLengthInverseCurve(
             const SimTK::Real& normTendonForce) const {
-        return log((1.0 / c1) * (normTendonForce + c3))
-                / getTendonStiffnessParameter() + c2;
+        return calcTendonForceLengthInverseCurve(
+                normTendonForce, getTendonStiffnessParameter());
     }
 
     /// This returns normalized tendon velocity given the derivative of 
@@ -557,8 +540,9 @@ public:
     SimTK::Real calcTendonForceLengthInverseCurveDerivative(
             const SimTK::Real& derivNormTendonForce,
             const SimTK::Real& normTendonLength) const {
-        return derivNormTendonForce / (c1 * getTendonStiffnessParameter()
-            * exp(getTendonStiffnessParameter() * (normTendonLength - c2)));
+        return derivNormTendonForce / calcTendonForceMultiplierDerivative(
+                                              normTendonLength,
+                                              getTendonStiffnessParameter());
     }
 
     /// This computes both the total fiber force and the individual components
@@ -574,19 +558,11 @@ public:
             SimTK::Real& conPassiveFiberForce,
             SimTK::Real& nonConPassiveFiberForce,
             SimTK::Real& totalFiberForce) const {
-        const auto& maxIsometricForce = get_max_isometric_force();
-        // active force
-        activeFiberForce =
-                maxIsometricForce * (activation * activeForceLengthMultiplier *
-                                            forceVelocityMultiplier);
-        // conservative passive force
-        conPassiveFiberForce = maxIsometricForce * normPassiveFiberForce;
-        // non-conservative passive force
-        nonConPassiveFiberForce =
-                maxIsometricForce * get_fiber_damping() * normFiberVelocity;
-        // total force
-        totalFiberForce = activeFiberForce + conPassiveFiberForce +
-                          nonConPassiveFiberForce;
+        calcFiberForce(getDynamicsParameters(), activation,
+                activeForceLengthMultiplier, forceVelocityMultiplier,
+                normPassiveFiberForce, normFiberVelocity, activeFiberForce,
+                conPassiveFiberForce, nonConPassiveFiberForce,
+                totalFiberForce);
     }
 
     /// The stiffness of the fiber in the direction of the fiber. This includes
@@ -596,21 +572,8 @@ public:
     SimTK::Real calcFiberStiffness(const SimTK::Real& activation,
             const SimTK::Real& normFiberLength,
             const SimTK::Real& fiberVelocityMultiplier) const {
-
-        const SimTK::Real partialNormFiberLengthPartialFiberLength =
-                1.0 / get_optimal_fiber_length();
-        const SimTK::Real partialNormActiveForcePartialFiberLength =
-                partialNormFiberLengthPartialFiberLength *
-                calcActiveForceLengthMultiplierDerivative(normFiberLength);
-        const SimTK::Real partialNormPassiveForcePartialFiberLength =
-                partialNormFiberLengthPartialFiberLength *
-                calcPassiveForceMultiplierDerivative(normFiberLength);
-
-        // fiberStiffness = d_fiberForce / d_fiberLength
-        return get_max_isometric_force() *
-               (activation * partialNormActiveForcePartialFiberLength *
-                               fiberVelocityMultiplier +
-                       partialNormPassiveForcePartialFiberLength);
+        return calcFiberStiffness(getDynamicsParameters(), activation,
+                normFiberLength, fiberVelocityMultiplier);
     }
 
     /// The stiffness of the tendon in the direction of the tendon.
@@ -618,8 +581,7 @@ public:
     SimTK::Real calcTendonStiffness(const SimTK::Real& normTendonLength) const {
 
         if (get_ignore_tendon_compliance()) return SimTK::Infinity;
-        return (get_max_isometric_force() / get_tendon_slack_length()) *
-               calcTendonForceMultiplierDerivative(normTendonLength);
+        return calcTendonStiffness(getDynamicsParameters(), normTendonLength);
     }
 
     /// The stiffness of the whole musculotendon unit in the direction of the
@@ -650,24 +612,19 @@ public:
     /// MuscleFixedWidthPennationModel::calc_DPennationAngle_DFiberLength().
     SimTK::Real calcPartialPennationAnglePartialFiberLength(
             const SimTK::Real& fiberLength) const {
-
-        using SimTK::square;
-        // pennationAngle = asin(fiberWidth/fiberLength)
-        // d_pennationAngle/d_fiberLength =
-        //          d/d_fiberLength (asin(fiberWidth/fiberLength))
-        return (-getFiberWidth() / square(fiberLength)) /
-               sqrt(1.0 - square(getFiberWidth() / fiberLength));
+        return calcPartialPennationAnglePartialFiberLength(
+                getFiberWidth(), fiberLength);
     }
 
     /// The derivative of the fiber force along the tendon with respect to fiber
     /// length.
     /// @note based on
     /// Millard2012EquilibriumMuscle::calc_DFiberForceAT_DFiberLength().
-    SimTK::Real calcPartialFiberForceAlongTendonPartialFiberLength(
+    static SimTK::Real calcPartialFiberForceAlongTendonPartialFiberLength(
             const SimTK::Real& fiberForce, const SimTK::Real& fiberStiffness,
             const SimTK::Real& sinPennationAngle,
             const SimTK::Real& cosPennationAngle,
-            const SimTK::Real& partialPennationAnglePartialFiberLength) const {
+            const SimTK::Real& partialPennationAnglePartialFiberLength) {
 
         const SimTK::Real partialCosPennationAnglePartialFiberLength =
                 -sinPennationAngle * partialPennationAnglePartialFiberLength;
@@ -684,11 +641,12 @@ public:
     /// fiber length along the tendon.
     /// @note based on
     /// Millard2012EquilibriumMuscle::calc_DFiberForceAT_DFiberLengthAT.
-    SimTK::Real calcFiberStiffnessAlongTendon(const SimTK::Real& fiberLength,
+    static SimTK::Real calcFiberStiffnessAlongTendon(
+            const SimTK::Real& fiberLength,
             const SimTK::Real& partialFiberForceAlongTendonPartialFiberLength,
             const SimTK::Real& sinPennationAngle,
             const SimTK::Real& cosPennationAngle,
-            const SimTK::Real& partialPennationAnglePartialFiberLength) const {
+            const SimTK::Real& partialPennationAnglePartialFiberLength) {
 
         // The change in length of the fiber length along the tendon.
         // fiberLengthAlongTendon = fiberLength * cosPennationAngle
@@ -705,11 +663,11 @@ public:
                (1.0 / partialFiberLengthAlongTendonPartialFiberLength);
     }
 
-    SimTK::Real calcPartialTendonLengthPartialFiberLength(
+    static SimTK::Real calcPartialTendonLengthPartialFiberLength(
             const SimTK::Real& fiberLength,
             const SimTK::Real& sinPennationAngle,
             const SimTK::Real& cosPennationAngle,
-            const SimTK::Real& partialPennationAnglePartialFiberLength) const {
+            const SimTK::Real& partialPennationAnglePartialFiberLength) {
 
         return fiberLength * sinPennationAngle *
                        partialPennationAnglePartialFiberLength -
@@ -720,15 +678,9 @@ public:
             const SimTK::Real& tendonStiffness, const SimTK::Real& fiberLength, 
             const SimTK::Real& sinPennationAngle, 
             const SimTK::Real& cosPennationAngle) const {
-        const SimTK::Real partialPennationAnglePartialFiberLength =
-                calcPartialPennationAnglePartialFiberLength(fiberLength);
-
-        const SimTK::Real partialTendonLengthPartialFiberLength =
-                calcPartialTendonLengthPartialFiberLength(fiberLength, 
-                    sinPennationAngle, cosPennationAngle,
-                        partialPennationAnglePartialFiberLength);
-
-        return tendonStiffness * partialTendonLengthPartialFiberLength;
+        return calcPartialTendonForcePartialFiberLength(getFiberWidth(),
+                tendonStiffness, fiberLength, sinPennationAngle,
+                cosPennationAngle);
     }
 
     /// The residual (i.e. error) in the muscle-tendon equilibrium equation:
@@ -840,6 +792,8 @@ public:
     /// @}
 
 private:
+    friend class DeGrooteFregly2016MuscleBatch;
+
     void constructProperties();
 
     void calcMuscleLengthInfoHelper(const SimTK::Real& muscleTendonLength,
@@ -854,6 +808,8 @@ private:
             FiberVelocityInfo& fvi,
             const SimTK::Real& normTendonForce = SimTK::NaN,
             const SimTK::Real& normTendonForceDerivative = SimTK::NaN) const;
+    /// Calls the static calcMuscleDynamicsInfoHelper() with the
+    /// getDynamicsParameters() of this muscle.
     void calcMuscleDynamicsInfoHelper(const SimTK::Real& activation,
             const bool& ignoreTendonCompliance, const MuscleLengthInfo& mli,
             const FiberVelocityInfo& fvi, MuscleDynamicsInfo& mdi,
@@ -902,6 +858,181 @@ private:
                cube(b3 + b4 * x);
     }
 
+    /// @name Curves with explicit parameters
+    /// The curve math of the calculation methods above, with the parameters
+    /// that the muscle gets from its properties passed explicitly. These are
+    /// shared with DeGrooteFregly2016MuscleBatch, which stores the parameters
+    /// of many muscles in arrays.
+    /// @{
+    static SimTK::Real calcActiveForceLengthMultiplier(
+            const SimTK::Real& normFiberLength, const double& scale) {
+        // Shift the curve so its peak is at the origin, scale it
+        // horizontally, then shift it back so its peak is still at x = 1.0.
+        const SimTK::Real x = (normFiberLength - 1.0) / scale + 1.0;
+        return calcGaussianLikeCurve(x, b11, b21, b31, b41) +
+               calcGaussianLikeCurve(x, b12, b22, b32, b42) +
+               calcGaussianLikeCurve(x, b13, b23, b33, b43);
+    }
+    static SimTK::Real calcActiveForceLengthMultiplierDerivative(
+            const SimTK::Real& normFiberLength, const double& scale) {
+        const SimTK::Real x = (normFiberLength - 1.0) / scale + 1.0;
+        return (1.0 / scale) *
+               (calcGaussianLikeCurveDerivative(x, b11, b21, b31, b41) +
+                       calcGaussianLikeCurveDerivative(x, b12, b22, b32, b42) +
+                       calcGaussianLikeCurveDerivative(x, b13, b23, b33, b43));
+    }
+    /// The offset that makes the passive force-length curve pass through
+    /// y = 0 at x = minNormFiberLength, given the passive fiber strain at one
+    /// normalized force (e0).
+    static double calcPassiveForceOffset(const double& e0) {
+        return exp(kPE * (m_minNormFiberLength - 1.0) / e0);
+    }
+    static SimTK::Real calcPassiveForceMultiplier(
+            const SimTK::Real& normFiberLength, const double& e0,
+            const double& offset) {
+        return (exp(kPE * (normFiberLength - 1.0) / e0) - offset) /
+               (exp(kPE) - offset);
+    }
+    static SimTK::Real calcPassiveForceMultiplierDerivative(
+            const SimTK::Real& normFiberLength, const double& e0,
+            const double& offset) {
+        return (kPE * exp((kPE * (normFiberLength - 1)) / e0)) /
+               (e0 * (exp(kPE) - offset));
+    }
+    /// `kT` is the tendon stiffness parameter (see
+    /// getTendonStiffnessParameter()).
+    static SimTK::Real calcTendonForceMultiplierDerivative(
+            const SimTK::Real& normTendonLength, const double& kT) {
+        return c1 * kT * exp(kT * (normTendonLength - c2));
+    }
+    static SimTK::Real calcTendonForceLengthInverseCurve(
+            const SimTK::Real& normTendonForce, const double& kT) {
+        return log((1.0 / c1) * (normTendonForce + c3)) / kT + c2;
+    }
+    /// @}
+
+    /// @name Dynamics with explicit parameters
+    /// The fiber force, stiffness, and power math of the calculation methods
+    /// above, with the parameters that the muscle gets from its properties
+    /// passed explicitly. DeGrooteFregly2016MuscleBatch stores these
+    /// parameters for each muscle and computes the MuscleDynamicsInfo with
+    /// the same calcMuscleDynamicsInfoHelper().
+    /// @{
+    struct DynamicsParameters {
+        double maxIsometricForce;
+        double optimalFiberLength;
+        double tendonSlackLength;
+        double fiberWidth;
+        double fiberDamping;
+        double activeForceWidthScale;
+        double passiveFiberStrain;
+        double passiveForceOffset;
+        double tendonStiffness; // kT
+        bool ignorePassiveFiberForce;
+    };
+    DynamicsParameters getDynamicsParameters() const {
+        DynamicsParameters p;
+        p.maxIsometricForce = get_max_isometric_force();
+        p.optimalFiberLength = get_optimal_fiber_length();
+        p.tendonSlackLength = get_tendon_slack_length();
+        p.fiberWidth = getFiberWidth();
+        p.fiberDamping = get_fiber_damping();
+        p.activeForceWidthScale = get_active_force_width_scale();
+        p.passiveFiberStrain = get_passive_fiber_strain_at_one_norm_force();
+        p.passiveForceOffset = calcPassiveForceOffset(p.passiveFiberStrain);
+        p.tendonStiffness = getTendonStiffnessParameter();
+        p.ignorePassiveFiberForce = get_ignore_passive_fiber_force();
+        return p;
+    }
+    static void calcFiberForce(const DynamicsParameters& p,
+            const SimTK::Real& activation,
+            const SimTK::Real& activeForceLengthMultiplier,
+            const SimTK::Real& forceVelocityMultiplier,
+            const SimTK::Real& normPassiveFiberForce,
+            const SimTK::Real& normFiberVelocity,
+            SimTK::Real& activeFiberForce, SimTK::Real& conPassiveFiberForce,
+            SimTK::Real& nonConPassiveFiberForce,
+            SimTK::Real& totalFiberForce) {
+        // active force
+        activeFiberForce =
+                p.maxIsometricForce * (activation *
+                                              activeForceLengthMultiplier *
+                                              forceVelocityMultiplier);
+        // conservative passive force
+        conPassiveFiberForce = p.maxIsometricForce * normPassiveFiberForce;
+        // non-conservative passive force
+        nonConPassiveFiberForce =
+                p.maxIsometricForce * p.fiberDamping * normFiberVelocity;
+        // total force
+        totalFiberForce = activeFiberForce + conPassiveFiberForce +
+                          nonConPassiveFiberForce;
+    }
+    static SimTK::Real calcFiberStiffness(const DynamicsParameters& p,
+            const SimTK::Real& activation, const SimTK::Real& normFiberLength,
+            const SimTK::Real& fiberVelocityMultiplier) {
+        const SimTK::Real partialNormFiberLengthPartialFiberLength =
+                1.0 / p.optimalFiberLength;
+        const SimTK::Real partialNormActiveForcePartialFiberLength =
+                partialNormFiberLengthPartialFiberLength *
+                calcActiveForceLengthMultiplierDerivative(
+                        normFiberLength, p.activeForceWidthScale);
+        const SimTK::Real partialNormPassiveForcePartialFiberLength =
+                p.ignorePassiveFiberForce
+                        ? 0
+                        : partialNormFiberLengthPartialFiberLength *
+                                  calcPassiveForceMultiplierDerivative(
+                                          normFiberLength,
+                                          p.passiveFiberStrain,
+                                          p.passiveForceOffset);
+
+        // fiberStiffness = d_fiberForce / d_fiberLength
+        return p.maxIsometricForce *
+               (activation * partialNormActiveForcePartialFiberLength *
+                               fiberVelocityMultiplier +
+                       partialNormPassiveForcePartialFiberLength);
+    }
+    /// The stiffness of a compliant tendon.
+    static SimTK::Real calcTendonStiffness(const DynamicsParameters& p,
+            const SimTK::Real& normTendonLength) {
+        return (p.maxIsometricForce / p.tendonSlackLength) *
+               calcTendonForceMultiplierDerivative(
+                       normTendonLength, p.tendonStiffness);
+    }
+    static SimTK::Real calcPartialPennationAnglePartialFiberLength(
+            const double& fiberWidth, const SimTK::Real& fiberLength) {
+        using SimTK::square;
+        // pennationAngle = asin(fiberWidth/fiberLength)
+        // d_pennationAngle/d_fiberLength =
+        //          d/d_fiberLength (asin(fiberWidth/fiberLength))
+        return (-fiberWidth / square(fiberLength)) /
+               sqrt(1.0 - square(fiberWidth / fiberLength));
+    }
+    static SimTK::Real calcPartialTendonForcePartialFiberLength(
+            const double& fiberWidth, const SimTK::Real& tendonStiffness,
+            const SimTK::Real& fiberLength,
+            const SimTK::Real& sinPennationAngle,
+            const SimTK::Real& cosPennationAngle) {
+        const SimTK::Real partialPennationAnglePartialFiberLength =
+                calcPartialPennationAnglePartialFiberLength(
+                        fiberWidth, fiberLength);
+
+        const SimTK::Real partialTendonLengthPartialFiberLength =
+                calcPartialTendonLengthPartialFiberLength(fiberLength,
+                        sinPennationAngle, cosPennationAngle,
+                        partialPennationAnglePartialFiberLength);
+
+        return tendonStiffness * partialTendonLengthPartialFiberLength;
+    }
+    /// Compute the MuscleDynamicsInfo from the length and fiber velocity
+    /// info. `normTendonForce` is required if and only if
+    /// `ignoreTendonCompliance` is false.
+    static void calcMuscleDynamicsInfoHelper(const DynamicsParameters& p,
+            const SimTK::Real& activation, const bool& ignoreTendonCompliance,
+            const MuscleLengthInfo& mli, const FiberVelocityInfo& fvi,
+            MuscleDynamicsInfo& mdi,
+            const SimTK::Real& normTendonForce = SimTK::NaN);
+    /// @}
+
     //enum StatusFromEstimateMuscleFiberState {
     //    Success_Converged,
     //    Warning_FiberAtLowerBound,
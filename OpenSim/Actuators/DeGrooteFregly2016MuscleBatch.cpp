@@ -0,0 +1,221 @@
+/* -------------------------------------------------------------------------- *
+ *              OpenSim:  DeGrooteFregly2016MuscleBatch.cpp                   *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "DeGrooteFregly2016MuscleBatch.h"
+
+using namespace OpenSim;
+using SimTK::square;
+
+using DGF = DeGrooteFregly2016Muscle;
+
+DeGrooteFregly2016MuscleBatch::DeGrooteFregly2016MuscleBatch(
+        const Model& model) {
+    for (const auto& muscle :
+            model.getComponentList<DeGrooteFregly2016Muscle>()) {
+        m_muscles.push_back(&muscle);
+    }
+    const int n = getNumMuscles();
+    for (auto* v : {&m_optimalFiberLength, &m_tendonSlackLength,
+                 &m_fiberWidth, &m_squareFiberWidth,
+                 &m_maxContractionVelocity, &m_activeForceWidthScale,
+                 &m_passiveFiberStrain, &m_passiveForceOffset,
+                 &m_tendonStiffness, &m_muscleTendonLength,
+                 &m_muscleTendonVelocity, &m_activation, &m_normTendonForce,
+                 &m_normTendonForceDerivative, &m_normTendonLength,
+                 &m_fiberLength, &m_fiberLengthAlongTendon,
+                 &m_normFiberLength, &m_sinPennationAngle,
+                 &m_cosPennationAngle, &m_activeForceLengthMultiplier,
+                 &m_passiveForceMultiplier, &m_forceVelocityMultiplier,
+                 &m_normFiberVelocity, &m_fiberVelocity,
+                 &m_fiberVelocityAlongTendon, &m_tendonVelocity,
+                 &m_normTendonVelocity}) {
+        v->resize(n);
+    }
+    m_ignorePassiveFiberForce.resize(n);
+    m_ignoreTendonCompliance.resize(n);
+    m_isTendonDynamicsExplicit.resize(n);
+
+    for (int i = 0; i < n; ++i) {
+        const auto& muscle = *m_muscles[i];
+        m_optimalFiberLength[i] = muscle.get_optimal_fiber_length();
+        m_tendonSlackLength[i] = muscle.get_tendon_slack_length();
+        m_fiberWidth[i] = muscle.getFiberWidth();
+        m_squareFiberWidth[i] = muscle.getSquareFiberWidth();
+        m_maxContractionVelocity[i] =
+                muscle.getMaxContractionVelocityInMetersPerSecond();
+        m_activeForceWidthScale[i] = muscle.get_active_force_width_scale();
+        const double e0 = muscle.get_passive_fiber_strain_at_one_norm_force();
+        m_passiveFiberStrain[i] = e0;
+        m_passiveForceOffset[i] = DGF::calcPassiveForceOffset(e0);
+        m_tendonStiffness[i] = muscle.getTendonStiffnessParameter();
+        m_ignorePassiveFiberForce[i] = muscle.get_ignore_passive_fiber_force();
+        m_ignoreTendonCompliance[i] = muscle.get_ignore_tendon_compliance();
+        m_isTendonDynamicsExplicit[i] = muscle.m_isTendonDynamicsExplicit;
+        m_dynamicsParameters.push_back(muscle.getDynamicsParameters());
+    }
+}
+
+void DeGrooteFregly2016MuscleBatch::calcMuscleInfos(
+        const SimTK::State& s) const {
+    const int n = getNumMuscles();
+
+    // Gather the inputs from the state.
+    // ---------------------------------
+    for (int i = 0; i < n; ++i) {
+        const auto& muscle = *m_muscles[i];
+        m_muscleTendonLength[i] = muscle.getLength(s);
+        m_muscleTendonVelocity[i] = muscle.getLengtheningSpeed(s);
+        m_activation[i] = muscle.getActivation(s);
+        if (!m_ignoreTendonCompliance[i]) {
+            m_normTendonForce[i] = muscle.getNormalizedTendonForce(s);
+            if (!m_isTendonDynamicsExplicit[i]) {
+                m_normTendonForceDerivative[i] =
+                        muscle.getNormalizedTendonForceDerivative(s);
+            }
+        }
+    }
+
+    // Lengths and force-length multipliers.
+    // -------------------------------------
+    // See DeGrooteFregly2016Muscle::calcMuscleLengthInfoHelper().
+    for (int i = 0; i < n; ++i) {
+        m_normTendonLength[i] =
+                m_ignoreTendonCompliance[i]
+                        ? 1.0
+                        : DGF::calcTendonForceLengthInverseCurve(
+                                  m_normTendonForce[i], m_tendonStiffness[i]);
+        m_fiberLengthAlongTendon[i] = m_muscleTendonLength[i] -
+                                      m_tendonSlackLength[i] *
+                                              m_normTendonLength[i];
+        m_fiberLength[i] = sqrt(square(m_fiberLengthAlongTendon[i]) +
+                                m_squareFiberWidth[i]);
+        m_normFiberLength[i] = m_fiberLength[i] / m_optimalFiberLength[i];
+        m_cosPennationAngle[i] =
+                m_fiberLengthAlongTendon[i] / m_fiberLength[i];
+        m_sinPennationAngle[i] = m_fiberWidth[i] / m_fiberLength[i];
+    }
+    for (int i = 0; i < n; ++i) {
+        m_activeForceLengthMultiplier[i] =
+                DGF::calcActiveForceLengthMultiplier(
+                        m_normFiberLength[i], m_activeForceWidthScale[i]);
+    }
+    for (int i = 0; i < n; ++i) {
+        m_passiveForceMultiplier[i] =
+                m_ignorePassiveFiberForce[i]
+                        ? 0
+                        : DGF::calcPassiveForceMultiplier(m_normFiberLength[i],
+                                  m_passiveFiberStrain[i],
+                                  m_passiveForceOffset[i]);
+    }
+
+    // Velocities and force-velocity multipliers.
+    // ------------------------------------------
+    // See DeGrooteFregly2016Muscle::calcFiberVelocityInfoHelper().
+    for (int i = 0; i < n; ++i) {
+        if (m_isTendonDynamicsExplicit[i] && !m_ignoreTendonCompliance[i]) {
+            const double normFiberForce =
+                    m_normTendonForce[i] / m_cosPennationAngle[i];
+            m_forceVelocityMultiplier[i] =
+                    (normFiberForce - m_passiveForceMultiplier[i]) /
+                    (m_activation[i] * m_activeForceLengthMultiplier[i]);
+            m_normFiberVelocity[i] = DGF::calcForceVelocityInverseCurve(
+                    m_forceVelocityMultiplier[i]);
+            m_fiberVelocity[i] =
+                    m_normFiberVelocity[i] * m_maxContractionVelocity[i];
+            m_fiberVelocityAlongTendon[i] =
+                    m_fiberVelocity[i] / m_cosPennationAngle[i];
+            m_tendonVelocity[i] =
+                    m_muscleTendonVelocity[i] - m_fiberVelocityAlongTendon[i];
+            m_normTendonVelocity[i] =
+                    m_tendonVelocity[i] / m_tendonSlackLength[i];
+        } else {
+            m_normTendonVelocity[i] =
+                    m_ignoreTendonCompliance[i]
+                            ? 0.0
+                            : m_normTendonForceDerivative[i] /
+                                      DGF::calcTendonForceMultiplierDerivative(
+                                              m_normTendonLength[i],
+                                              m_tendonStiffness[i]);
+            m_tendonVelocity[i] =
+                    m_tendonSlackLength[i] * m_normTendonVelocity[i];
+            m_fiberVelocityAlongTendon[i] =
+                    m_muscleTendonVelocity[i] - m_tendonVelocity[i];
+            m_fiberVelocity[i] =
+                    m_fiberVelocityAlongTendon[i] * m_cosPennationAngle[i];
+            m_normFiberVelocity[i] =
+                    m_fiberVelocity[i] / m_maxContractionVelocity[i];
+            m_forceVelocityMultiplier[i] = DGF::calcForceVelocityMultiplier(
+                    m_normFiberVelocity[i]);
+        }
+    }
+
+    // Fill the cache of each muscle.
+    // ------------------------------
+    for (int i = 0; i < n; ++i) {
+        const auto& muscle = *m_muscles[i];
+        const double tsl = m_tendonSlackLength[i];
+        const double fiberLength = m_fiberLength[i];
+
+        auto& mli = muscle.updMuscleLengthInfo(s);
+        mli.normTendonLength = m_normTendonLength[i];
+        mli.tendonStrain = mli.normTendonLength - 1.0;
+        mli.tendonLength = tsl * mli.normTendonLength;
+        mli.fiberLengthAlongTendon = m_fiberLengthAlongTendon[i];
+        mli.fiberLength = fiberLength;
+        mli.normFiberLength = m_normFiberLength[i];
+        mli.cosPennationAngle = m_cosPennationAngle[i];
+        mli.sinPennationAngle = m_sinPennationAngle[i];
+        mli.pennationAngle = asin(mli.sinPennationAngle);
+        mli.fiberPassiveForceLengthMultiplier = m_passiveForceMultiplier[i];
+        mli.fiberActiveForceLengthMultiplier =
+                m_activeForceLengthMultiplier[i];
+        muscle.markCacheVariableValid(s, "lengthInfo");
+        if (mli.tendonLength < tsl) {
+            log_info("DeGrooteFregly2016Muscle '{}' is buckling (length < "
+                     "tendon_slack_length) at time {} s.",
+                    muscle.getName(), s.getTime());
+        }
+
+        auto& fvi = muscle.updFiberVelocityInfo(s);
+        fvi.fiberForceVelocityMultiplier = m_forceVelocityMultiplier[i];
+        fvi.normFiberVelocity = m_normFiberVelocity[i];
+        fvi.fiberVelocity = m_fiberVelocity[i];
+        fvi.fiberVelocityAlongTendon = m_fiberVelocityAlongTendon[i];
+        fvi.tendonVelocity = m_tendonVelocity[i];
+        fvi.normTendonVelocity = m_normTendonVelocity[i];
+        fvi.pennationAngularVelocity =
+                -fvi.fiberVelocity / fiberLength *
+                (m_fiberWidth[i] / mli.fiberLengthAlongTendon);
+        muscle.markCacheVariableValid(s, "velInfo");
+        if (fvi.normFiberVelocity < -1.0) {
+            log_info("DeGrooteFregly2016Muscle '{}' is exceeding maximum "
+                     "contraction velocity at time {} s.",
+                    muscle.getName(), s.getTime());
+        }
+
+        auto& mdi = muscle.updMuscleDynamicsInfo(s);
+        DGF::calcMuscleDynamicsInfoHelper(m_dynamicsParameters[i],
+                m_activation[i], m_ignoreTendonCompliance[i], mli, fvi, mdi,
+                m_normTendonForce[i]);
+        muscle.markCacheVariableValid(s, "dynamicsInfo");
+    }
+}
@@ -0,0 +1,115 @@
+#ifndef OPENSIM_DEGROOTEFREGLY2016MUSCLEBATCH_H
+#define OPENSIM_DEGROOTEFREGLY2016MUSCLEBATCH_H
+/* -------------------------------------------------------------------------- *
+ *               OpenSim:  DeGrooteFregly2016MuscleBatch.h                    *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "DeGrooteFregly2016Muscle.h"
+
+#include <vector>
+
+namespace OpenSim {
+
+/** Compute the length, fiber velocity, and dynamics info of all of the
+DeGrooteFregly2016Muscles in a model at once. The parameters of the muscles,
+including quantities that the muscle derives from its properties each time
+they are needed (e.g., the tendon stiffness parameter and the fiber width),
+are packed into arrays when the batch is created. calcMuscleInfos() then
+evaluates the curves of all muscles in loops over these arrays, using the
+same curve functions as DeGrooteFregly2016Muscle, computes the fiber force,
+stiffness, and power of each muscle with the same function as the muscle, and
+fills the cache variables of each muscle, so that subsequently realizing the
+model (or getting muscle outputs) uses these values rather than computing
+them one muscle at a time. The values are the same as those computed by each muscle.
+
+The batch holds references to the muscles of the model, so it must not
+outlive the model, and must be created again if the model's system is
+recreated (e.g., with initSystem()) or the muscles' properties are changed.
+MocoProblemRep uses a batch for problems without parameters.
+@code
+Model model("subject.osim");
+SimTK::State& state = model.initSystem();
+DeGrooteFregly2016MuscleBatch batch(model);
+model.realizeVelocity(state);
+batch.calcMuscleInfos(state);
+model.realizeAcceleration(state);
+@endcode */
+class OSIMACTUATORS_API DeGrooteFregly2016MuscleBatch {
+public:
+    /// Pack the parameters of the model's DeGrooteFregly2016Muscles. The
+    /// model's properties must be finalized (e.g., with initSystem()).
+    explicit DeGrooteFregly2016MuscleBatch(const Model& model);
+
+    int getNumMuscles() const { return (int)m_muscles.size(); }
+    const DeGrooteFregly2016Muscle& getMuscle(int index) const {
+        return *m_muscles[index];
+    }
+
+    /// Compute the MuscleLengthInfo, FiberVelocityInfo, and
+    /// MuscleDynamicsInfo of all muscles in the batch and store them in each
+    /// muscle's cache. The state must be realized to Stage::Velocity.
+    void calcMuscleInfos(const SimTK::State& s) const;
+
+private:
+    std::vector<const DeGrooteFregly2016Muscle*> m_muscles;
+
+    // Parameters, one element per muscle.
+    std::vector<double> m_optimalFiberLength;
+    std::vector<double> m_tendonSlackLength;
+    std::vector<double> m_fiberWidth;
+    std::vector<double> m_squareFiberWidth;
+    std::vector<double> m_maxContractionVelocity; // m/s
+    std::vector<double> m_activeForceWidthScale;
+    std::vector<double> m_passiveFiberStrain;
+    std::vector<double> m_passiveForceOffset;
+    std::vector<double> m_tendonStiffness; // kT
+    std::vector<char> m_ignorePassiveFiberForce;
+    std::vector<char> m_ignoreTendonCompliance;
+    std::vector<char> m_isTendonDynamicsExplicit;
+    // Used to compute the MuscleDynamicsInfo.
+    std::vector<DeGrooteFregly2016Muscle::DynamicsParameters>
+            m_dynamicsParameters;
+
+    // Inputs and intermediate values, one element per muscle.
+    mutable std::vector<double> m_muscleTendonLength;
+    mutable std::vector<double> m_muscleTendonVelocity;
+    mutable std::vector<double> m_activation;
+    mutable std::vector<double> m_normTendonForce;
+    mutable std::vector<double> m_normTendonForceDerivative;
+    mutable std::vector<double> m_normTendonLength;
+    mutable std::vector<double> m_fiberLength;
+    mutable std::vector<double> m_fiberLengthAlongTendon;
+    mutable std::vector<double> m_normFiberLength;
+    mutable std::vector<double> m_sinPennationAngle;
+    mutable std::vector<double> m_cosPennationAngle;
+    mutable std::vector<double> m_activeForceLengthMultiplier;
+    mutable std::vector<double> m_passiveForceMultiplier;
+    mutable std::vector<double> m_forceVelocityMultiplier;
+    mutable std::vector<double> m_normFiberVelocity;
+    mutable std::vector<double> m_fiberVelocity;
+    mutable std::vector<double> m_fiberVelocityAlongTendon;
+    mutable std::vector<double> m_tendonVelocity;
+    mutable std::vector<double> m_normTendonVelocity;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_DEGROOTEFREGLY2016MUSCLEBATCH_H
@@ -21,8 +21,12 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 #include "Millard2012EquilibriumMuscle.h"
+#include <OpenSim/Common/Instrumentation.h>
 #include <OpenSim/Simulation/Model/Model.h>
 
+#include <exception>
+#include <numeric>
+
 using namespace std;
 using namespace OpenSim;
 using namespace SimTK;
@@ -753,6 +757,8 @@ computeFiberEquilibrium(SimTK::State& s, bool solveForVelocity) const
     if(get_ignore_tendon_compliance()) {                    // rigid tendon
         return;
     }
+    OPENSIM_INSTRUMENT_SCOPE(
+            "Millard2012EquilibriumMuscle::computeFiberEquilibrium");
 
     // Elastic tendon initialization routine.
 
@@ -804,6 +810,174 @@ computeFiberEquilibrium(SimTK::State& s, bool solveForVelocity) const
     setFiberLength(s, result.fiberLength);
 }
 
+void Millard2012EquilibriumMuscle::computeEquilibria(SimTK::State& s,
+        const std::vector<const Muscle*>& muscles) const
+{
+    std::exception_ptr firstError;
+    const auto equilibrate = [&](const Muscle& muscle) {
+        try {
+            muscle.computeEquilibrium(s);
+        } catch (...) {
+            if (!firstError) firstError = std::current_exception();
+        }
+    };
+
+    // Derived classes may override computeInitialFiberEquilibrium(), so only
+    // muscles of this class are solved together. Muscles with a rigid tendon
+    // have no fiber length to solve for.
+    std::vector<const Millard2012EquilibriumMuscle*> lanes;
+    for (const Muscle* muscle : muscles) {
+        const auto* millard =
+                dynamic_cast<const Millard2012EquilibriumMuscle*>(muscle);
+        if (millard && millard->getConcreteClassName() == getClassName()) {
+            if (!millard->get_ignore_tendon_compliance()) {
+                lanes.push_back(millard);
+            }
+        } else {
+            equilibrate(*muscle);
+        }
+    }
+    const int n = (int)lanes.size();
+    if (n) _model->getMultibodySystem().realize(s, SimTK::Stage::Velocity);
+
+    // This is the static solution of estimateMuscleFiberState() (fv = 1 and
+    // dlceN = 0), with the Newton step and line search of each muscle (lane)
+    // performed one lane after another. The parameters and iterates of the
+    // lanes are stored as arrays so that the force arithmetic is a loop over
+    // contiguous data; the curves and pennation models differ between
+    // muscles, so they are evaluated one lane at a time.
+    const int maxIter = 200;
+    std::vector<double> ma(n), ml(n), tsl(n), ofl(n), fiso(n), beta(n),
+            tol(n), lceMin(n);
+    std::vector<double> lce(n), lcePrev(n), sinphi(n), cosphi(n), tlN(n),
+            fal(n), fpe(n), fse(n), Fm(n), ferr(n), ferrPrev(n),
+            dFmAT_dlce(n), dFt_d_lce(n), h(n);
+    for (int i = 0; i < n; ++i) {
+        const auto& m = *lanes[i];
+        ma[i]     = m.getActivation(s);
+        ml[i]     = m.getLength(s);
+        tsl[i]    = m.getTendonSlackLength();
+        ofl[i]    = m.getOptimalFiberLength();
+        fiso[i]   = m.getMaxIsometricForce();
+        beta[i]   = m.getFiberDamping();
+        tol[i]    = max(1e-8*fiso[i], SimTK::SignificantReal*10);
+        lceMin[i] = m.getMinimumFiberLength();
+        // Begin with a small tendon force.
+        lce[i] = m.clampFiberLength(
+                m.getPennationModel().calcFiberLength(ml[i], tsl[i]*1.01));
+    }
+
+    // Update the position-level quantities and force multipliers.
+    const auto updateLengths = [&](const std::vector<int>& indices) {
+        for (int i : indices) {
+            const auto& m = *lanes[i];
+            const double phi =
+                    m.getPennationModel().calcPennationAngle(lce[i]);
+            cosphi[i] = cos(phi);
+            sinphi[i] = sin(phi);
+            const double lceN = lce[i] / ofl[i];
+            tlN[i] = (ml[i] - lce[i]*cosphi[i]) / tsl[i];
+            fal[i] = m.get_ActiveForceLengthCurve().calcValue(lceN);
+            fpe[i] = m.get_FiberForceLengthCurve().calcValue(lceN);
+            fse[i] = m.get_TendonForceLengthCurve().calcValue(tlN[i]);
+        }
+    };
+    // Compute the equilibrium force error.
+    const auto updateError = [&](const std::vector<int>& indices) {
+        for (int i : indices) {
+            Fm[i] = calcFiberForce(fiso[i], ma[i], fal[i], 1.0, fpe[i], 0.0,
+                    beta[i]);
+            ferr[i] = Fm[i]*cosphi[i] - fse[i]*fiso[i];
+        }
+    };
+    // Compute the partial derivatives of the force error w.r.t. lce.
+    const auto updatePartials = [&](const std::vector<int>& indices) {
+        for (int i : indices) {
+            const auto& m = *lanes[i];
+            const double lceN = lce[i] / ofl[i];
+            const double dFm_dlce = calcFiberStiffness(fiso[i], ma[i], 1.0,
+                    m.get_FiberForceLengthCurve().calcDerivative(lceN, 1),
+                    m.get_ActiveForceLengthCurve().calcDerivative(lceN, 1),
+                    ofl[i]);
+            dFmAT_dlce[i] = m.calc_DFiberForceAT_DFiberLength(Fm[i],
+                    dFm_dlce, lce[i], sinphi[i], cosphi[i]);
+            const double dFt_d_tl = m.get_TendonForceLengthCurve().
+                    calcDerivative(tlN[i], 1)*fiso[i] / tsl[i];
+            dFt_d_lce[i] = m.calc_DTendonForce_DFiberLength(dFt_d_tl, lce[i],
+                    sinphi[i], cosphi[i]);
+        }
+    };
+
+    std::vector<int> iterating(n);
+    std::iota(iterating.begin(), iterating.end(), 0);
+    updateLengths(iterating);
+    updateError(iterating);
+    updatePartials(iterating);
+    ferrPrev = ferr;
+    lcePrev = lce;
+
+    std::vector<int> searching;
+    std::vector<int> stillSearching;
+    for (int iter = 0; iter < maxIter; ++iter) {
+        iterating.clear();
+        for (int i = 0; i < n; ++i) {
+            if (abs(ferr[i]) > tol[i]) iterating.push_back(i);
+        }
+        if (iterating.empty()) break;
+
+        for (int i : iterating) h[i] = 1.0;
+        searching = iterating;
+        while (!searching.empty()) {
+            for (int i : searching) {
+                const double delta_lce =
+                        -h[i]*ferrPrev[i] / (dFmAT_dlce[i] - dFt_d_lce[i]);
+                if (abs(delta_lce) > SimTK::SignificantReal) {
+                    lce[i] = lcePrev[i] + delta_lce;
+                } else {
+                    // Approach the local minimum from the other direction,
+                    // and end the line search.
+                    lce[i] = lcePrev[i] - sign(delta_lce)*SimTK::SqrtEps;
+                    h[i] = 0;
+                }
+                if (lce[i] < lceMin[i]) lce[i] = lceMin[i];
+            }
+            updateLengths(searching);
+            updateError(searching);
+
+            // Halve the step of the lanes whose error did not decrease.
+            stillSearching.clear();
+            for (int i : searching) {
+                if (h[i] <= SimTK::SqrtEps) continue;
+                h[i] = 0.5*h[i];
+                if (abs(ferr[i]) >= abs(ferrPrev[i])) {
+                    stillSearching.push_back(i);
+                }
+            }
+            searching.swap(stillSearching);
+        }
+
+        for (int i : iterating) {
+            ferrPrev[i] = ferr[i];
+            lcePrev[i] = lce[i];
+        }
+        updatePartials(iterating);
+    }
+
+    for (int i = 0; i < n; ++i) {
+        const auto& m = *lanes[i];
+        if (abs(ferr[i]) < tol[i]) {
+            m.setActuation(s, fse[i]*fiso[i]);
+            m.setFiberLength(s, m.clampFiberLength(lce[i]));
+        } else {
+            // Let the per-muscle solver handle (and report) the lanes that
+            // did not converge.
+            equilibrate(m);
+        }
+    }
+
+    if (firstError) std::rethrow_exception(firstError);
+}
+
 //==============================================================================
 // SCALING
 //==============================================================================
@@ -442,6 +442,19 @@ public:
     void computeFiberEquilibrium(SimTK::State& s, 
                                  bool solveForVelocity = false) const;
 
+    /** Computes the fiber lengths of all of the given muscles as in
+    computeInitialFiberEquilibrium(), iterating the Newton solves of all of the
+    muscles in lockstep over arrays of their parameters. Muscles whose solve
+    does not converge (including those at their minimum fiber length) are
+    equilibrated with computeInitialFiberEquilibrium() instead, as are muscles
+    of classes derived from this class.
+        @param[in,out] s The state of the system.
+        @param muscles   The muscles to equilibrate.
+        @throws MuscleCannotEquilibrate
+    */
+    void computeEquilibria(SimTK::State& s,
+            const std::vector<const Muscle*>& muscles) const override;
+
 //==============================================================================
 // DEPRECATED
 //==============================================================================
@@ -1090,3 +1090,89 @@ TEST_CASE("DeGrooteFregly2016Muscle basics") {
         CHECK(state.getY()[2] == Approx(0.451));
     }
 }
+
+TEST_CASE("DeGrooteFregly2016MuscleBatch") {
+    Model model;
+    auto* body = new Body("body", 0.5, SimTK::Vec3(0), SimTK::Inertia(0));
+    model.addComponent(body);
+    auto* joint = new SliderJoint("joint", model.getGround(), *body);
+    model.addComponent(joint);
+    const auto addMuscle = [&](const std::string& name) {
+        auto* muscle = new DeGrooteFregly2016Muscle();
+        muscle->setName(name);
+        muscle->set_optimal_fiber_length(0.1);
+        muscle->set_tendon_slack_length(0.2);
+        muscle->addNewPathPoint("origin", model.updGround(), SimTK::Vec3(0));
+        muscle->addNewPathPoint("insertion", *body, SimTK::Vec3(0, 0.05, 0));
+        model.addComponent(muscle);
+        return muscle;
+    };
+    addMuscle("explicit");
+    addMuscle("implicit")->set_tendon_compliance_dynamics_mode("implicit");
+    addMuscle("rigid")->set_ignore_tendon_compliance(true);
+    addMuscle("no_passive")->set_ignore_passive_fiber_force(true);
+    auto* pennated = addMuscle("pennated");
+    pennated->set_pennation_angle_at_optimal(0.3);
+    pennated->set_fiber_damping(0.1);
+    pennated->set_active_force_width_scale(1.5);
+    pennated->set_tendon_strain_at_one_norm_force(0.1);
+
+    SimTK::State state = model.initSystem();
+    joint->updCoordinate().setValue(state, 0.28);
+    joint->updCoordinate().setSpeedValue(state, -0.3);
+    int i = 0;
+    for (const auto& muscle :
+            model.getComponentList<DeGrooteFregly2016Muscle>()) {
+        muscle.setActivation(state, 0.2 + 0.1 * i);
+        muscle.setNormalizedTendonForce(state, 0.3 + 0.05 * i);
+        ++i;
+    }
+    model.getComponent<DeGrooteFregly2016Muscle>("implicit")
+            .setDiscreteVariableValue(
+                    state, "implicitderiv_normalized_tendon_force", 0.7);
+
+    DeGrooteFregly2016MuscleBatch batch(model);
+    CHECK(batch.getNumMuscles() == 5);
+
+    SimTK::State batchState = state;
+    model.realizeVelocity(batchState);
+    batch.calcMuscleInfos(batchState);
+    for (const auto& muscle :
+            model.getComponentList<DeGrooteFregly2016Muscle>()) {
+        CHECK(muscle.isCacheVariableValid(batchState, "dynamicsInfo"));
+    }
+    model.realizeDynamics(batchState);
+    model.realizeDynamics(state);
+
+    for (const auto& muscle :
+            model.getComponentList<DeGrooteFregly2016Muscle>()) {
+        CAPTURE(muscle.getName());
+        const auto check = [&](double (Muscle::*get)(const SimTK::State&)
+                                       const) {
+            CHECK((muscle.*get)(batchState) ==
+                    Approx((muscle.*get)(state)).epsilon(1e-12));
+        };
+        check(&Muscle::getFiberLength);
+        check(&Muscle::getPennationAngle);
+        check(&Muscle::getTendonLength);
+        check(&Muscle::getActiveForceLengthMultiplier);
+        check(&Muscle::getPassiveForceMultiplier);
+        check(&Muscle::getFiberVelocity);
+        check(&Muscle::getNormalizedFiberVelocity);
+        check(&Muscle::getTendonVelocity);
+        check(&Muscle::getForceVelocityMultiplier);
+        check(&Muscle::getPennationAngularVelocity);
+        check(&Muscle::getFiberForce);
+        check(&Muscle::getTendonForce);
+        check(&Muscle::getFiberStiffness);
+        check(&Muscle::getFiberStiffnessAlongTendon);
+        check(&Muscle::getFiberActivePower);
+        check(&Muscle::getTendonPower);
+        CHECK(muscle.getPassiveFiberDampingForce(batchState) ==
+                Approx(muscle.getPassiveFiberDampingForce(state))
+                        .epsilon(1e-12));
+        CHECK(muscle.getImplicitResidualNormalizedTendonForce(batchState) ==
+                Approx(muscle.getImplicitResidualNormalizedTendonForce(state))
+                        .epsilon(1e-12));
+    }
+}
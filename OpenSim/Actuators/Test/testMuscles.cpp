@@ -931,6 +931,53 @@ TEST_CASE("testMillard2012EquilibriumMuscle")
     }
 }
 
+namespace {
+// A model with Millard2012EquilibriumMuscles of varied properties, lengths, and
+// activations, each spanning two points on ground.
+Model createMillard2012EquilibriumMuscleModel(int numMuscles) {
+    Model model;
+    for (int i = 0; i < numMuscles; ++i) {
+        const double optimalFiberLength = 0.05 + 0.1 * (i % 7) / 7.0;
+        const double tendonSlackLength = 0.1 + 0.3 * (i % 11) / 11.0;
+        const double pennationAngle = 0.3 * (i % 5) / 5.0;
+        auto* muscle = new Millard2012EquilibriumMuscle("muscle" +
+                std::to_string(i), 100.0 + 10.0 * i, optimalFiberLength,
+                tendonSlackLength, pennationAngle);
+        muscle->set_default_activation(0.05 + 0.9 * (i % 13) / 13.0);
+        const double length = (optimalFiberLength + tendonSlackLength) *
+                              (0.9 + 0.3 * (i % 17) / 17.0);
+        muscle->addNewPathPoint("p1", model.updGround(), SimTK::Vec3(0));
+        muscle->addNewPathPoint("p2", model.updGround(),
+                SimTK::Vec3(0, 0, length));
+        model.addForce(muscle);
+    }
+    return model;
+}
+}
+
+TEST_CASE("Millard2012EquilibriumMuscle computeEquilibria") {
+    Model model = createMillard2012EquilibriumMuscleModel(50);
+    const SimTK::State& state = model.initSystem();
+
+    // Model::equilibrateMuscles() solves all of the muscles together.
+    SimTK::State batched = state;
+    model.equilibrateMuscles(batched);
+    model.realizeVelocity(batched);
+
+    SimTK::State perMuscle = state;
+    for (const auto& muscle : model.getComponentList<Muscle>()) {
+        muscle.computeEquilibrium(perMuscle);
+    }
+    model.realizeVelocity(perMuscle);
+
+    for (const auto& muscle : model.getComponentList<Muscle>()) {
+        CAPTURE(muscle.getName());
+        CHECK(muscle.getFiberLength(batched) ==
+                Catch::Approx(muscle.getFiberLength(perMuscle))
+                        .epsilon(1e-12));
+    }
+}
+
 TEST_CASE("testMillard2012AccelerationMuscle")
 {
     Millard2012AccelerationMuscle muscle("muscle",
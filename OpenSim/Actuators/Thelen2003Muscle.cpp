@@ -24,6 +24,7 @@
 // INCLUDES
 //=============================================================================
 #include <fstream>
+#include <OpenSim/Common/Instrumentation.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include "Thelen2003Muscle.h"
 
@@ -331,6 +332,8 @@ double  Thelen2003Muscle::computeActuation(const SimTK::State& s) const
 
 void Thelen2003Muscle::computeInitialFiberEquilibrium(SimTK::State& s) const
 {
+    OPENSIM_INSTRUMENT_SCOPE(
+            "Thelen2003Muscle::computeInitialFiberEquilibrium");
     //Initial activation and fiber length from input State, s.
     _model->getMultibodySystem().realize(s, SimTK::Stage::Velocity);
     double activation = getActivation(s);
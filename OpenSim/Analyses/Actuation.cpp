@@ -283,6 +283,9 @@ deleteStorage()
     if (_forceStore != NULL) { delete _forceStore;  _forceStore = NULL; }
     if (_speedStore != NULL) { delete _speedStore;  _speedStore = NULL; }
     if (_powerStore != NULL) { delete _powerStore;  _powerStore = NULL; }
+    // The list does not own the storages; drop the pointers just freed so
+    // that allocateStorage() does not append next to dangling entries.
+    _storageList.setSize(0);
 }
 
 
@@ -530,3 +533,11 @@ getNumEnabledActuators()
 
     return numEnabled;
 }
+
+void Actuation::appendResults(const Analysis& other, double afterTime)
+{
+    const auto& actuation = dynamic_cast<const Actuation&>(other);
+    appendRows(*_forceStore, *actuation._forceStore, afterTime);
+    appendRows(*_speedStore, *actuation._speedStore, afterTime);
+    appendRows(*_powerStore, *actuation._powerStore, afterTime);
+}
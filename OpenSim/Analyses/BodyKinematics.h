@@ -134,6 +134,8 @@ public:
     int
         printResults(const std::string &aBaseName,const std::string &aDir="",
         double aDT=-1.0,const std::string &aExtension=".sto") override;
+    bool isFrameIndependent() const override { return true; }
+    void appendResults(const Analysis& other, double afterTime) override;
 
 //=============================================================================
 };  // END of class BodyKinematics
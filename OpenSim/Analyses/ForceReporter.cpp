@@ -243,6 +243,8 @@ void ForceReporter::constructColumnLabels(const SimTK::State& s)
 void ForceReporter::deleteStorage()
 {
     //if(_forceStore!=NULL) { delete _forceStore;  _forceStore=NULL; }
+    // allocateStorage() appends _forceStore again.
+    _storageList.setSize(0);
 }
 
 //=============================================================================
@@ -29,6 +29,8 @@
 #include <OpenSim/Simulation/Model/ExternalForce.h>
 #include "InducedAccelerations.h"
 
+#include <memory>
+
 using namespace OpenSim;
 using namespace std;
 
@@ -37,6 +39,54 @@ using namespace std;
 //=============================================================================
 #define CENTER_OF_MASS_NAME string("center_of_mass")
 
+namespace {
+// The quantities at one instant that are shared by all contributors whose
+// induced accelerations are computed by linear superposition. The state has
+// zero speeds, gravity and all actuators apply forces, and it is realized to
+// Stage::Dynamics.
+struct SuperpositionSystem {
+    SimTK::State state;
+    // Factorization of the projected inverse mass matrix W = G M^-1 ~G.
+    SimTK::FactorQTZ projectedMInv;
+    int numConstraintEquations = 0;
+    SimTK::Vector biasForMultiplyByG;
+    SimTK::Vector biasForAccelerationConstraints;
+    // Forces applied by components other than gravity and the actuators
+    // (e.g., passive forces), which are included in every contribution.
+    SimTK::Vector passiveMobilityForces;
+    SimTK::Vector_<SimTK::SpatialVec> passiveBodyForces;
+    // The forces applied by each actuator.
+    std::vector<SimTK::Vector> actuatorMobilityForces;
+    std::vector<SimTK::Vector_<SimTK::SpatialVec>> actuatorBodyForces;
+};
+
+// Solve M udot + ~G lambda = f, G udot = b for the generalized accelerations
+// (udot) and body accelerations induced by the applied forces f.
+void calcConstrainedAccelerations(const SimTK::SimbodyMatterSubsystem& matter,
+        const SuperpositionSystem& system,
+        const SimTK::Vector& mobilityForces,
+        const SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+        SimTK::Vector& udot, SimTK::Vector_<SimTK::SpatialVec>& A_GB)
+{
+    const SimTK::State& s = system.state;
+    matter.calcAccelerationIgnoringConstraints(
+            s, mobilityForces, bodyForces, udot, A_GB);
+    if (system.numConstraintEquations == 0) return;
+
+    // Find the multipliers that remove the constraint acceleration errors of
+    // the unconstrained accelerations: W lambda = G udot - b.
+    SimTK::Vector accelerationErrors;
+    matter.multiplyByG(s, udot, system.biasForMultiplyByG, accelerationErrors);
+    accelerationErrors += system.biasForAccelerationConstraints;
+    SimTK::Vector lambda;
+    system.projectedMInv.solve(accelerationErrors, lambda);
+    SimTK::Vector constraintForces;
+    matter.multiplyByGTranspose(s, lambda, constraintForces);
+    matter.calcAccelerationIgnoringConstraints(
+            s, mobilityForces - constraintForces, bodyForces, udot, A_GB);
+}
+} // anonymous namespace
+
 //=============================================================================
 // CONSTRUCTOR(S) AND DESTRUCTOR
 //=============================================================================
@@ -68,7 +118,8 @@ InducedAccelerations::InducedAccelerations(Model *aModel) :
     _constraintSet((ConstraintSet&)_constraintSetProp.getValueObj()),
     _forceThreshold(_forceThresholdProp.getValueDbl()),
     _computePotentialsOnly(_computePotentialsOnlyProp.getValueBool()),
-    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool())
+    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool()),
+    _useLinearSuperposition(_useLinearSuperpositionProp.getValueBool())
 {
     // make sure members point to NULL if not valid. 
     setNull();
@@ -96,7 +147,8 @@ InducedAccelerations::InducedAccelerations(const std::string &aFileName):
     _constraintSet((ConstraintSet&)_constraintSetProp.getValueObj()),
     _forceThreshold(_forceThresholdProp.getValueDbl()),
     _computePotentialsOnly(_computePotentialsOnlyProp.getValueBool()),
-    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool())
+    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool()),
+    _useLinearSuperposition(_useLinearSuperpositionProp.getValueBool())
 {
     setNull();
 
@@ -120,7 +172,8 @@ InducedAccelerations::InducedAccelerations(const InducedAccelerations &aInducedA
     _constraintSet((ConstraintSet&)_constraintSetProp.getValueObj()),
     _forceThreshold(_forceThresholdProp.getValueDbl()),
     _computePotentialsOnly(_computePotentialsOnlyProp.getValueBool()),
-    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool())
+    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool()),
+    _useLinearSuperposition(_useLinearSuperpositionProp.getValueBool())
 {
     setNull();
     // COPY TYPE AND NAME
@@ -152,6 +205,7 @@ operator=(const InducedAccelerations &aInducedAccelerations)
     _forceThreshold = aInducedAccelerations._forceThreshold;
     _computePotentialsOnly = aInducedAccelerations._computePotentialsOnly;
     _reportConstraintReactions = aInducedAccelerations._reportConstraintReactions;
+    _useLinearSuperposition = aInducedAccelerations._useLinearSuperposition;
     _includeCOM = aInducedAccelerations._includeCOM;
     return(*this);
 }
@@ -171,6 +225,7 @@ void InducedAccelerations::setNull()
     _bodyNames[0] = CENTER_OF_MASS_NAME;
     _computePotentialsOnly = false;
     _reportConstraintReactions = false;
+    _useLinearSuperposition = false;
     // Analysis does not own contents of these sets
     _coordSet.setMemoryOwner(false);
     _bodySet.setMemoryOwner(false);
@@ -213,6 +268,12 @@ void InducedAccelerations::setupProperties()
     _reportConstraintReactionsProp.setName("report_constraint_reactions");
     _reportConstraintReactionsProp.setComment("Report individual contributions to constraint reactions in addition to accelerations.");
     _propertySet.append(&_reportConstraintReactionsProp);
+
+    _useLinearSuperpositionProp.setName("use_linear_superposition");
+    _useLinearSuperpositionProp.setComment("Compute the induced accelerations of gravity and the actuators "
+        "by linear superposition, using one factorization of the constrained equations of motion per time step. "
+        "This is faster for models with many actuators. Not used if report_constraint_reactions is true.");
+    _propertySet.append(&_useLinearSuperpositionProp);
 }
 
 //=============================================================================
@@ -539,8 +600,102 @@ int InducedAccelerations::record(const SimTK::State& s)
     //Use same conditions on constraints
     s_analysis.setTime(aT);
 
+    // Gravity and the actuators are applied at zero speed with the same
+    // constraints, so their contributions can be computed by superposition.
+    const bool useSuperposition =
+        _useLinearSuperposition && !_reportConstraintReactions;
+    std::unique_ptr<SuperpositionSystem> superposition;
+    const SimTK::SimbodyMatterSubsystem& matter = _model->getMatterSubsystem();
+    SimTK::Vector udot;
+    SimTK::Vector_<SimTK::SpatialVec> A_GB;
+
     // Cycle through the force contributors to the system acceleration
     for(int c=0; c< _contributors.getSize(); c++){          
+        if(useSuperposition && _contributors[c] != "total" &&
+                _contributors[c] != "velocity"){
+            // Set up the system after the "total" contributor, which may
+            // change which constraints are enforced.
+            if(!superposition){
+                superposition.reset(new SuperpositionSystem());
+                SimTK::State& s_sup = superposition->state;
+                s_sup = s_analysis;
+                s_sup.setQ(Q);
+                s_sup.setU(SimTK::Vector(nu,0.0));
+                s_sup.setZ(s.getZ());
+                _model->updForceSubsystem().setForceIsDisabled(s_sup, _model->getGravityForce().getForceIndex(), false);
+
+                int na = _model->getActuators().getSize();
+                for(int f=0; f<na; f++){
+                    Actuator &actuator = _model->updActuators().get(f);
+                    actuator.setAppliesForce(s_sup, true);
+                    ScalarActuator* act = dynamic_cast<ScalarActuator*>(&actuator);
+                    if(act){
+                        bool potential = _computePotentialsOnly &&
+                            dynamic_cast<Muscle*>(&actuator) != nullptr;
+                        act->overrideActuation(s_sup, potential);
+                        if(potential)
+                            act->setOverrideActuation(s_sup, 1.0);
+                    }
+                }
+                const SimTK::MultibodySystem& system = _model->getMultibodySystem();
+                system.realize(s_sup, SimTK::Stage::Dynamics);
+
+                // The passive forces are the total applied forces less those
+                // of gravity and the actuators.
+                superposition->passiveMobilityForces =
+                    system.getMobilityForces(s_sup, SimTK::Stage::Dynamics);
+                superposition->passiveBodyForces =
+                    system.getRigidBodyForces(s_sup, SimTK::Stage::Dynamics);
+                superposition->passiveBodyForces -=
+                    _model->getGravityBodyForces(s_sup);
+                superposition->actuatorMobilityForces.resize(na);
+                superposition->actuatorBodyForces.resize(na);
+                for(int f=0; f<na; f++){
+                    SimTK::Vector& mobilityForces =
+                        superposition->actuatorMobilityForces[f];
+                    SimTK::Vector_<SimTK::SpatialVec>& bodyForces =
+                        superposition->actuatorBodyForces[f];
+                    mobilityForces.resize(nu);
+                    mobilityForces = 0;
+                    bodyForces.resize(matter.getNumBodies());
+                    bodyForces = SimTK::SpatialVec(SimTK::Vec3(0), SimTK::Vec3(0));
+                    _model->getActuators().get(f).computeForce(
+                        s_sup, bodyForces, mobilityForces);
+                    superposition->passiveMobilityForces -= mobilityForces;
+                    superposition->passiveBodyForces -= bodyForces;
+                }
+
+                SimTK::Matrix projectedMInv;
+                matter.calcProjectedMInv(s_sup, projectedMInv);
+                superposition->numConstraintEquations = projectedMInv.nrow();
+                if(superposition->numConstraintEquations > 0){
+                    superposition->projectedMInv.factor(projectedMInv);
+                    matter.calcBiasForMultiplyByG(s_sup,
+                        superposition->biasForMultiplyByG);
+                    matter.calcBiasForAccelerationConstraints(s_sup,
+                        superposition->biasForAccelerationConstraints);
+                }
+            }
+
+            SimTK::Vector mobilityForces = superposition->passiveMobilityForces;
+            SimTK::Vector_<SimTK::SpatialVec> bodyForces =
+                superposition->passiveBodyForces;
+            if(_contributors[c] == "gravity"){
+                bodyForces += _model->getGravityBodyForces(superposition->state);
+            }
+            else{
+                int ai = _model->getActuators().getIndex(_contributors[c]);
+                if(ai<0)
+                    throw Exception("InducedAcceleration: ERR- Could not find actuator '"+_contributors[c],__FILE__,__LINE__);
+                mobilityForces += superposition->actuatorMobilityForces[ai];
+                bodyForces += superposition->actuatorBodyForces[ai];
+            }
+            calcConstrainedAccelerations(matter, *superposition,
+                mobilityForces, bodyForces, udot, A_GB);
+            appendInducedAccelerations(superposition->state, udot, A_GB);
+            continue;
+        }
+
         //cout << "Solving for contributor: " << _contributors[c] << endl;
         // Need to be at the dynamics stage to disable a force
         _model->getMultibodySystem().realize(s_analysis, SimTK::Stage::Dynamics);
@@ -787,6 +942,64 @@ int InducedAccelerations::record(const SimTK::State& s)
     return(0);
 }
 
+//_____________________________________________________________________________
+/**
+ * Append the induced accelerations of the coordinates, bodies and center of
+ * mass for one contributor, given the generalized accelerations (udot) and
+ * the spatial accelerations of the bodies in ground. The speeds in the state
+ * must be zero.
+ */
+void InducedAccelerations::appendInducedAccelerations(const SimTK::State& s,
+        const SimTK::Vector& udot,
+        const SimTK::Vector_<SimTK::SpatialVec>& bodyAccelerations)
+{
+    const SimTK::SimbodyMatterSubsystem& matter = _model->getMatterSubsystem();
+
+    for(int i=0;i<_coordSet.getSize();i++) {
+        const Coordinate& coord = _coordSet.get(i);
+        const SimTK::MobilizedBody& mobod =
+            matter.getMobilizedBody(coord.getBodyIndex());
+        double acc = udot[mobod.getFirstUIndex(s) + coord.getMobilizerQIndex()];
+
+        if(getInDegrees()) 
+            acc *= SimTK_RADIAN_TO_DEGREE;  
+        _coordIndAccs[i]->append(1, &acc);
+    }
+
+    // With zero speeds, the acceleration of a station is the acceleration of
+    // the body origin plus the angular acceleration crossed with the station
+    // location (there are no centripetal accelerations).
+    for(int i=0;i<_bodySet.getSize();i++) {
+        const Body &body = _bodySet.get(i);
+        const SimTK::SpatialVec& A_GB =
+            bodyAccelerations[body.getMobilizedBodyIndex()];
+        SimTK::Vec3 angVec = A_GB[0];
+        SimTK::Vec3 vec = A_GB[1] +
+            angVec % (body.getTransformInGround(s).R() * body.get_mass_center());
+
+        if(getInDegrees()) 
+            angVec *= SimTK_RADIAN_TO_DEGREE;   
+
+        _bodyIndAccs[i]->append(3, &vec[0]);
+        _bodyIndAccs[i]->append(3, &angVec[0]);
+    }
+
+    if(_includeCOM){
+        SimTK::Vec3 vec(0);
+        double mass = 0;
+        for(SimTK::MobilizedBodyIndex mbx(1); mbx < matter.getNumBodies(); ++mbx){
+            const SimTK::MobilizedBody& mobod = matter.getMobilizedBody(mbx);
+            const SimTK::MassProperties& massProps = mobod.getBodyMassProperties(s);
+            const SimTK::SpatialVec& A_GB = bodyAccelerations[mbx];
+            vec += massProps.getMass() * (A_GB[1] + A_GB[0] %
+                (mobod.getBodyRotation(s) * massProps.getMassCenter()));
+            mass += massProps.getMass();
+        }
+        vec /= mass;
+        _comIndAccs.append(3, &vec[0]);
+    }
+}
+
 /**
  * This method is called at the beginning of an analysis so that any
  * necessary initializations may be performed.
@@ -847,6 +1060,10 @@ int InducedAccelerations::begin(const SimTK::State &s)
 
     initialize(s);
 
+    if(_useLinearSuperposition && _reportConstraintReactions)
+        log_warn("InducedAccelerations: use_linear_superposition is not used "
+            "because report_constraint_reactions is true.");
+
     // RESET STORAGES
     for(int i = 0; i<_storeInducedAccelerations.getSize(); i++){
         _storeInducedAccelerations[i]->reset(s.getTime());
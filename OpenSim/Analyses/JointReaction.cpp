@@ -433,10 +433,12 @@ void JointReaction::loadForcesFromFile()
             _containsAllActuators = false;
         }
         else {
+            _actuatorForceIndices.setSize(actuatorSetSize);
             for(int actuatorIndex=0;actuatorIndex<actuatorSetSize;actuatorIndex++)
             {
                 std::string actuatorName = _model->getActuators().get(actuatorIndex).getName();
                 int storageIndex = _storeActuation->getStateIndex(actuatorName,0);
+                _actuatorForceIndices[actuatorIndex] = storageIndex;
                 if(storageIndex == -1) {
                     log_warn("The actuator '{}' was not found in the forces "
                              "file.",
@@ -553,19 +555,13 @@ record(const SimTK::State& s)
     if(_useForceStorage){
         const auto& actuatorSet = _model->getActuators();
         int nA = actuatorSet.getSize();
-        Array<double> forces(0,nA);
-        _storeActuation->getDataAtTime(s.getTime(),nA,forces);
-        int storageIndex = -1;
+        int nF = _storeActuation->getSmallestNumberOfStates();
+        Array<double> forces(0,nF);
+        _storeActuation->getDataAtTime(s.getTime(),nF,forces);
         for(int actuatorIndex=0;actuatorIndex<nA;actuatorIndex++)
         {
-            //Actuator* act = dynamic_cast<Actuator*>(&_forceSet->get(actuatorIndex));
-            std::string actuatorName = actuatorSet.get(actuatorIndex).getName();
-            storageIndex = _storeActuation->getStateIndex(actuatorName, 0);
-            if(storageIndex == -1){
-                log_warn("The actuator '{}' was not found in the forces file.",
-                        actuatorName);
-                break;
-            }
+            // The column of each actuator was found when loading the file.
+            int storageIndex = _actuatorForceIndices[actuatorIndex];
             const ScalarActuator* act = dynamic_cast<const ScalarActuator*>(&actuatorSet[actuatorIndex]);
             if (act){
                 act->overrideActuation(s_analysis, true);
@@ -573,11 +569,15 @@ record(const SimTK::State& s)
             }
         }
     }
-    // VARIABLES
-    const Ground& ground = _model->getGround();
-
     _model->realizeAcceleration(s_analysis);
 
+    /* Compute the reaction loads at all mobilizers at once, rather than once
+    *  for each joint (the Joint methods for the reaction on the parent and on
+    *  the child each compute the loads at all mobilizers).*/
+    const SimTK::SimbodyMatterSubsystem& matter = _model->getMatterSubsystem();
+    Vector_<SpatialVec> reactionsOnBodiesAtMInG;
+    matter.calcMobilizerReactionForces(s_analysis, reactionsOnBodiesAtMInG);
+
     /* retrieved desired joint reactions, convert to desired bodies, and convert
     *  to desired reference frames*/
     int numOutputJoints = _reactionList.getSize();
@@ -585,39 +585,43 @@ record(const SimTK::State& s)
     for(int i=0; i<numOutputJoints; i++) {
         JointReactionKey currentKey = _reactionList[i];
         const Joint& joint = *currentKey.joint;
-        const Frame& expressedInBody = *currentKey.expressedInFrame;
-        SpatialVec jointReaction;
-        Vec3 pointOfApplication;
+        const SimTK::MobilizedBody& mobod =
+            joint.getChildFrame().getMobilizedBody();
+        // The transform from the requested base frame (expressedInBody) to
+        // ground, used to express both the loads and the point.
+        const SimTK::Transform X_GE =
+            currentKey.expressedInFrame->getTransformInGround(s_analysis);
+        SpatialVec jointReaction =
+            reactionsOnBodiesAtMInG[mobod.getMobilizedBodyIndex()];
+        Vec3 locationInGlobal;
         
         // check if the load requested is on the parent or child
         if(!currentKey.isAppliedOnChild){
-            jointReaction = joint.calcReactionOnParentExpressedInGround(s_analysis);
+            // The reaction on the parent is equal and opposite to the
+            // reaction on the child, shifted from the mobilizer's M frame to
+            // its F frame.
+            const Vec3 p_GM = mobod.getBodyTransform(s_analysis) *
+                mobod.getOutboardFrame(s_analysis).p();
+            const Vec3 p_GF = mobod.getParentMobilizedBody()
+                .getBodyTransform(s_analysis) *
+                mobod.getInboardFrame(s_analysis).p();
+            jointReaction = shiftForceFromTo(-jointReaction, p_GM, p_GF);
 
             // find the point of application in immediate parent frame, then
             // transform to the base frame of the parent (expressedInBody)
-            Vec3 parentLocationInGlobal = joint.getParentFrame().getTransformInGround(s_analysis).p();
-            pointOfApplication = 
-                ground.findStationLocationInAnotherFrame(s_analysis, parentLocationInGlobal, expressedInBody);
+            locationInGlobal = joint.getParentFrame().getTransformInGround(s_analysis).p();
         }
         else{
-            jointReaction = joint.calcReactionOnChildExpressedInGround(s_analysis);
-
             // find the point of application in immediate child frame, then
             // transform to the base frame of the child (expressedInBody)
-            Vec3 childLocationInGlobal = joint.getChildFrame().getTransformInGround(s_analysis).p();
-            pointOfApplication =
-                ground.findStationLocationInAnotherFrame(s_analysis, childLocationInGlobal, expressedInBody);
+            locationInGlobal = joint.getChildFrame().getTransformInGround(s_analysis).p();
         }
 
-        // transform SpatialVec of reaction forces and moments to the
-        // requested base frame (expressedInBody)
-        Vec3 force = ground.expressVectorInAnotherFrame(s_analysis, jointReaction[1], expressedInBody);
-        Vec3 moment = ground.expressVectorInAnotherFrame(s_analysis, jointReaction[0], expressedInBody);
-
-        /* place results in the truncated loads vectors*/
-        forcesVec[i] = force;
-        momentsVec[i] = moment;
-        pointsVec[i] = pointOfApplication;
+        /* place results in the truncated loads vectors, with the reaction
+        *  forces and moments expressed in the requested base frame*/
+        forcesVec[i] = ~X_GE.R() * jointReaction[1];
+        momentsVec[i] = ~X_GE.R() * jointReaction[0];
+        pointsVec[i] = ~X_GE * locationInGlobal;
     }
 
     /* fill out row construction array*/
@@ -735,4 +739,8 @@ printResults(const string &aBaseName,const string &aDir,double aDT,
     return(0);
 }
 
-
+void JointReaction::appendResults(const Analysis& other, double afterTime)
+{
+    const auto& reaction = dynamic_cast<const JointReaction&>(other);
+    appendRows(_storeReactionLoads, reaction._storeReactionLoads, afterTime);
+}
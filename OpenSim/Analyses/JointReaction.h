@@ -112,6 +112,9 @@ protected:
     /** Storage for holding actuator forces IF SPECIFIED by user.*/
     Storage *_storeActuation;
 
+    /** Index of each actuator's force in _storeActuation.*/
+    Array<int> _actuatorForceIndices;
+
     /** Storage for recording joint Reaction loads.*/
     Storage _storeReactionLoads;
 
@@ -198,6 +201,8 @@ public:
     int
         printResults(const std::string &aBaseName,const std::string &aDir="",
         double aDT=-1.0,const std::string &aExtension=".sto") override;
+    bool isFrameIndependent() const override { return true; }
+    void appendResults(const Analysis& other, double afterTime) override;
 
 
 protected:
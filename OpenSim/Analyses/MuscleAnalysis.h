@@ -240,6 +240,7 @@ public:
     int
         printResults(const std::string &aBaseName,const std::string &aDir="",
         double aDT=-1.0,const std::string &aExtension=".sto") override;
+    bool isFrameIndependent() const override { return true; }
     /** 
      * Intended for use only by GUI that holds one MuscleAnalysis and keeps changing attributes to generate various plots
      * For all other use cases, the code handles the allocation/deallocation of resources internally.
@@ -651,4 +651,10 @@ printResults(const string &aBaseName,const string &aDir,double aDT,
     return(0);
 }
 
-
+void PointKinematics::appendResults(const Analysis& other, double afterTime)
+{
+    const auto& kinematics = dynamic_cast<const PointKinematics&>(other);
+    appendRows(*_pStore, *kinematics._pStore, afterTime);
+    appendRows(*_vStore, *kinematics._vStore, afterTime);
+    appendRows(*_aStore, *kinematics._aStore, afterTime);
+}
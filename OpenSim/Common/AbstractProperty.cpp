@@ -95,13 +95,29 @@ void AbstractProperty::readFromXMLParentElement(Xml::Element& parent,
     // tag as a name), look for the first element whose tag is
     // that name and read it if found. That is, we're looking for
     //      <propName> ... </propName>
+    readFromXMLParentElement(parent, versionNumber,
+            isUnnamedProperty() ? parent.element_end()
+                                : parent.element_begin(getName()));
+}
+
+void AbstractProperty::readFromXMLParentElement(Xml::Element& parent,
+        int versionNumber, const XMLChildElementIndex& childElements)
+{
+    Xml::element_iterator propElt = parent.element_end();
     if (!isUnnamedProperty()) {
-        Xml::element_iterator propElt = parent.element_begin(getName());
-        if (propElt != parent.element_end()) {
-            readFromXMLElement(*propElt, versionNumber);
-            setValueIsDefault(false);
-            return;
-        }
+        const auto found = childElements.find(getName());
+        if (found != childElements.end()) propElt = found->second;
+    }
+    readFromXMLParentElement(parent, versionNumber, propElt);
+}
+
+void AbstractProperty::readFromXMLParentElement(Xml::Element& parent,
+        int versionNumber, Xml::element_iterator propElt)
+{
+    if (propElt != parent.element_end()) {
+        readFromXMLElement(*propElt, versionNumber);
+        setValueIsDefault(false);
+        return;
     }
 
     // Didn't find a property element by its name (or it didn't have one).
@@ -227,3 +243,12 @@ void AbstractProperty::writeToXMLParentElement(Xml::Element& parent) const {
     obj.updateXMLNode(parent, this);
 }
 
+void AbstractProperty::writeToBinaryStream(std::ostream&) const {
+    OPENSIM_THROW(Exception, "Property '{}' of type {} cannot be written in "
+            "binary form.", getName(), getTypeName());
+}
+
+void AbstractProperty::readFromBinaryStream(std::istream&) {
+    OPENSIM_THROW(Exception, "Property '{}' of type {} cannot be read from "
+            "binary form.", getName(), getTypeName());
+}
@@ -25,8 +25,10 @@
 
 // INCLUDES
 #include "Assertion.h"
+#include <iosfwd>
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
 #include "osimCommonDLL.h"
 #include "Exception.h"
 #include "SimTKcommon/internal/Xml.h"
@@ -251,10 +253,34 @@ public:
     void readFromXMLParentElement(SimTK::Xml::Element& parent,
                                   int                  versionNumber);
 
+    /** The first child element with each tag in an XML parent element. **/
+    typedef std::unordered_map<std::string, SimTK::Xml::element_iterator>
+        XMLChildElementIndex;
+
+    /** Same as above, but the property element is looked up in
+    \a childElements (an index of the child elements of \a parent) instead of
+    by searching the child elements of \a parent. Objects with many
+    properties use this to read an element with many children in linear time.
+    **/
+    void readFromXMLParentElement(SimTK::Xml::Element&        parent,
+                                  int                         versionNumber,
+                                  const XMLChildElementIndex& childElements);
+
     /** Given an XML parent element, append a single child element representing
     the serialized form of this property. **/
     void writeToXMLParentElement(SimTK::Xml::Element& parent) const;
 
+    /** Write the values of this property (but not its name or other 
+    attributes) to a stream in the binary form used by 
+    Object::writeToBinaryStream(). Object properties write their objects 
+    recursively. The default implementation throws an Exception; the 
+    deprecated properties are written by Object instead. **/
+    virtual void writeToBinaryStream(std::ostream& stream) const;
+    /** Replace the values of this property with values read from a stream
+    written by writeToBinaryStream(). The default implementation throws an
+    Exception. **/
+    virtual void readFromBinaryStream(std::istream& stream);
+
 
     /** %Set the property name. **/
     void setName(const std::string& name){ _name = name; }
@@ -398,6 +424,13 @@ protected:
 private:
     void setNull();
 
+    // Read the property from propElt, the property element in parent (or
+    // parent.element_end() if there is none), or from the alternate form of
+    // one-object properties.
+    void readFromXMLParentElement(SimTK::Xml::Element&         parent,
+                                  int                          versionNumber,
+                                  SimTK::Xml::element_iterator propElt);
+
     std::string _name;
     std::string _comment;
     bool        _valueIsDefault;    // current value is just the default
@@ -245,6 +245,20 @@ public:
         _storage.push_back(aValue);
         return size();
     }
+#ifndef SWIG
+    /**
+     * Append a value onto the array by moving it.
+     *
+     * @param aValue Value to be appended.
+     * @return New size of the array, or, equivalently, the index to the new
+     * first empty element of the array.
+     */
+    int append(T&& aValue)
+    {
+        _storage.push_back(std::move(aValue));
+        return size();
+    }
+#endif
 
     /**
      * Append an array of values.
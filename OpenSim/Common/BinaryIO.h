@@ -0,0 +1,174 @@
+#ifndef OPENSIM_BINARYIO_H_
+#define OPENSIM_BINARYIO_H_
+/* -------------------------------------------------------------------------- *
+ *                            OpenSim:  BinaryIO.h                            *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "Exception.h"
+
+#include "SimTKcommon/SmallMatrix.h"
+#include "SimTKcommon/internal/BigMatrix.h"
+#include "SimTKcommon/internal/Transform.h"
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace OpenSim {
+
+/** Read and write values in the binary formats of OpenSim's snapshot files
+(e.g., Object::writeToBinaryStream()). Values are written with the byte order
+and floating-point representation of this machine, so these formats are
+intended for fast, temporary storage (e.g., caches) rather than for exchanging
+files. Each read function throws an Exception if the stream ends before the
+value is read. Write a marker with writeByteOrderMark() at the start of a file
+so that readByteOrderMark() can detect files written on a machine with a
+different byte order. */
+namespace BinaryIO {
+
+/// @cond
+inline void writeBytes(std::ostream& stream, const void* data,
+        std::size_t size) {
+    stream.write(static_cast<const char*>(data), (std::streamsize)size);
+}
+
+inline void readBytes(std::istream& stream, void* data, std::size_t size) {
+    stream.read(static_cast<char*>(data), (std::streamsize)size);
+    OPENSIM_THROW_IF(!stream, Exception,
+            "Unexpected end of binary data (expected {} more bytes).", size);
+}
+/// @endcond
+
+inline void write(std::ostream& stream, bool value) {
+    const char byte = value ? 1 : 0;
+    writeBytes(stream, &byte, 1);
+}
+inline void write(std::ostream& stream, int value) {
+    const std::int32_t v = value;
+    writeBytes(stream, &v, sizeof(v));
+}
+inline void write(std::ostream& stream, std::int64_t value) {
+    writeBytes(stream, &value, sizeof(value));
+}
+inline void write(std::ostream& stream, double value) {
+    writeBytes(stream, &value, sizeof(value));
+}
+inline void write(std::ostream& stream, const std::string& value) {
+    write(stream, (int)value.size());
+    writeBytes(stream, value.data(), value.size());
+}
+// Without this overload, string literals would be written as bools.
+inline void write(std::ostream& stream, const char* value) {
+    write(stream, std::string(value));
+}
+template <int M>
+void write(std::ostream& stream, const SimTK::Vec<M>& value) {
+    for (int i = 0; i < M; ++i) write(stream, value[i]);
+}
+inline void write(std::ostream& stream, const SimTK::Vector& value) {
+    write(stream, value.size());
+    for (int i = 0; i < value.size(); ++i) write(stream, value[i]);
+}
+/// The rotation matrix is written exactly, rather than as angles.
+inline void write(std::ostream& stream, const SimTK::Transform& value) {
+    const SimTK::Mat33& R = value.R().asMat33();
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j) write(stream, R(i, j));
+    write(stream, value.p());
+}
+
+inline void read(std::istream& stream, bool& value) {
+    char byte;
+    readBytes(stream, &byte, 1);
+    value = byte != 0;
+}
+inline void read(std::istream& stream, int& value) {
+    std::int32_t v;
+    readBytes(stream, &v, sizeof(v));
+    value = v;
+}
+inline void read(std::istream& stream, std::int64_t& value) {
+    readBytes(stream, &value, sizeof(value));
+}
+inline void read(std::istream& stream, double& value) {
+    readBytes(stream, &value, sizeof(value));
+}
+inline void read(std::istream& stream, std::string& value) {
+    int size;
+    read(stream, size);
+    OPENSIM_THROW_IF(size < 0, Exception,
+            "Invalid string size {} in binary data.", size);
+    value.resize(size);
+    if (size) readBytes(stream, &value[0], size);
+}
+template <int M>
+void read(std::istream& stream, SimTK::Vec<M>& value) {
+    for (int i = 0; i < M; ++i) read(stream, value[i]);
+}
+inline void read(std::istream& stream, SimTK::Vector& value) {
+    int size;
+    read(stream, size);
+    OPENSIM_THROW_IF(size < 0, Exception,
+            "Invalid vector size {} in binary data.", size);
+    value.resize(size);
+    for (int i = 0; i < size; ++i) read(stream, value[i]);
+}
+inline void read(std::istream& stream, SimTK::Transform& value) {
+    SimTK::Mat33 R;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j) read(stream, R(i, j));
+    SimTK::Vec3 p;
+    read(stream, p);
+    // The matrix was written from a valid rotation, so it is not checked.
+    value = SimTK::Transform(SimTK::Rotation(R, true), p);
+}
+
+/// Read a value of type T.
+template <typename T>
+T read(std::istream& stream) {
+    T value;
+    read(stream, value);
+    return value;
+}
+
+/// @name Byte order
+/// @{
+inline void writeByteOrderMark(std::ostream& stream) {
+    const std::uint32_t mark = 0x01020304;
+    writeBytes(stream, &mark, sizeof(mark));
+}
+/// @throws Exception if the data was written on a machine with a different
+/// byte order.
+inline void readByteOrderMark(std::istream& stream) {
+    std::uint32_t mark;
+    readBytes(stream, &mark, sizeof(mark));
+    OPENSIM_THROW_IF(mark != 0x01020304, Exception,
+            "The binary data was written on a machine with a different byte "
+            "order.");
+}
+/// @}
+
+} // namespace BinaryIO
+
+} // namespace OpenSim
+
+#endif // OPENSIM_BINARYIO_H_
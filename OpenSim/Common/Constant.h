@@ -89,6 +89,11 @@ public:
     {
         return _value;
     }
+    double calcValue1(double xUnused) const override { return _value; }
+    double calcDerivs1(double xUnused, int order) const override
+    {
+        return order == 0 ? _value : 0;
+    }
     double getValue() const { return _value; }
     SimTK::Function* createSimTKFunction() const override;
 //=============================================================================
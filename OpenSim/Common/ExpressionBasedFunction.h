@@ -122,6 +122,9 @@ public:
      */
     SimTK::Function* createSimTKFunction() const override;
 
+protected:
+    bool isSimTKFunctionShareable() const override { return true; }
+
 private:
     void constructProperties() {
         constructProperty_expression("");
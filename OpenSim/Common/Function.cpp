@@ -49,28 +49,33 @@ using SimTK::Vector;
  */
 Function::~Function()
 {
-    if (_function != NULL)
-        delete _function;
 }
 //_____________________________________________________________________________
 /**
  * Default constructor.
  */
 Function::Function() :
-    _function(NULL)
+    _function(nullptr)
 {
     setNull();
 }
 //_____________________________________________________________________________
 /**
- * Copy constructor.
+ * Copy constructor. The copy shares the SimTK::Function of aFunction if it
+ * has been created and is shareable; the copy has the same properties, so
+ * the SimTK::Function is up to date for the copy as well.
  *
  * @param aFunction Function to copy.
  */
 Function::Function(const Function &aFunction) :
     Object(aFunction),
-    _function(NULL)
+    _function(nullptr)
 {
+    if (aFunction._function && aFunction.isObjectUpToDateWithProperties() &&
+            aFunction.isSimTKFunctionShareable()) {
+        _function = aFunction._function;
+        setObjectIsUpToDateWithProperties();
+    }
 }
 
 
@@ -101,6 +106,16 @@ operator=(const Function &aFunction)
     // BASE CLASS
     Object::operator=(aFunction);
 
+    if (&aFunction != this) {
+        _function.reset();
+        if (aFunction._function &&
+                aFunction.isObjectUpToDateWithProperties() &&
+                aFunction.isSimTKFunctionShareable()) {
+            _function = aFunction._function;
+            setObjectIsUpToDateWithProperties();
+        }
+    }
+
     return(*this);
 }
 
@@ -161,35 +176,89 @@ evaluateTotalSecondDerivative(double aX,double aDxdt,double aD2xdt2)
 */
 double Function::calcValue(const Vector& x) const
 {
-    if (_function == NULL)
-        _function = createSimTKFunction();
-    return _function->calcValue(x);
+    return getSimTKFunction().calcValue(x);
 }
 
 double Function::calcDerivative(const std::vector<int>& derivComponents, const Vector& x) const
 {
-    if (_function == NULL)
-        _function = createSimTKFunction();
-    return _function->calcDerivative(derivComponents, x);
+    return getSimTKFunction().calcDerivative(derivComponents, x);
+}
+
+double Function::calcValue1(double x) const
+{
+    return calcValue(Vector(1, x));
+}
+
+double Function::calcDerivs1(double x, int order) const
+{
+    if (order == 0) return calcValue1(x);
+    return calcDerivative(std::vector<int>(order, 0), Vector(1, x));
+}
+
+double Function::calcValue1WithHint(double x, int&) const
+{
+    return calcValue1(x);
+}
+
+double Function::calcDerivs1WithHint(double x, int order, int&) const
+{
+    return calcDerivs1(x, order);
+}
+
+void Function::calcValues(const Vector& xs, Vector& out) const
+{
+    out.resize(xs.size());
+    int hint = 0;
+    for (int i = 0; i < xs.size(); ++i)
+        out[i] = calcValue1WithHint(xs[i], hint);
+}
+
+int Function::findInterval(const double* x, int n, double aX, int hint)
+{
+    if (hint >= 0 && hint < n - 1 && x[hint] <= aX) {
+        if (aX <= x[hint + 1]) return hint;
+        if (hint + 2 < n && aX <= x[hint + 2]) return hint + 1;
+    }
+    int k, i = 0;
+    int j = n;
+    while (1)
+    {
+        k = (i+j)/2;
+        if (aX < x[k])
+            j = k;
+        else if (aX > x[k+1])
+            i = k;
+        else
+            break;
+    }
+    return k;
 }
 
 int Function::getArgumentSize() const
 {
-    if (_function == NULL)
-        _function = createSimTKFunction();
-    return _function->getArgumentSize();
+    return getSimTKFunction().getArgumentSize();
 }
 
 int Function::getMaxDerivativeOrder() const
 {
-    if (_function == NULL)
-        _function = createSimTKFunction();
-    return _function->getMaxDerivativeOrder();
+    return getSimTKFunction().getMaxDerivativeOrder();
 }
 
 void Function::resetFunction()
 {
-    if (_function != NULL)
-        delete _function;
-    _function = NULL;
+    _function.reset();
+}
+
+const SimTK::Function& Function::getSimTKFunction() const
+{
+    if (!_function || !isObjectUpToDateWithProperties()) {
+        // Release the previous SimTK::Function before creating the new one,
+        // which may depend on whether one already exists (see GCVSpline).
+        _function.reset();
+        _function.reset(createSimTKFunction());
+        // Properties modified after this point clear the flag, so that the
+        // SimTK::Function is created again.
+        const_cast<Function*>(this)->setObjectIsUpToDateWithProperties();
+    }
+    return *_function;
 }
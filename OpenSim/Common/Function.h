@@ -32,6 +32,8 @@
 #include "Object.h"
 #include "SimTKmath.h"
 
+#include <memory>
+
 
 //=============================================================================
 //=============================================================================
@@ -58,8 +60,11 @@ OpenSim_DECLARE_ABSTRACT_OBJECT(Function, Object);
 // DATA
 //=============================================================================
 protected:
-    // The SimTK::Function object implementing this function.
-    mutable SimTK::Function* _function;
+    // The SimTK::Function object implementing this function, created by
+    // createSimTKFunction() when this function is first evaluated. If
+    // isSimTKFunctionShareable(), copies of this function share it until they
+    // are modified.
+    mutable std::shared_ptr<SimTK::Function> _function;
 
 //=============================================================================
 // METHODS
@@ -114,6 +119,46 @@ public:
      * @param x                the Vector of input arguments.  Its size must equal the value returned by getArgumentSize().
      */
     virtual double calcDerivative(const std::vector<int>& derivComponents, const SimTK::Vector& x) const;
+    /**
+     * Calculate the value of a function of one argument, without creating a
+     * Vector for the argument. This is used where functions of a single
+     * coordinate are evaluated many times (e.g., by CustomJoint and
+     * CoordinateCouplerConstraint). The default implementation calls
+     * calcValue(); functions of one argument should override this method to
+     * evaluate themselves directly.
+     */
+    virtual double calcValue1(double x) const;
+    /**
+     * Calculate a derivative of the given order (1 for the first derivative)
+     * of a function of one argument. This is equivalent to calcDerivative()
+     * with a derivComponents containing `order` zeros. A derivative of order
+     * 0 is the value of the function (as from calcValue1()); every override
+     * must follow this. The default implementation calls calcDerivative().
+     */
+    virtual double calcDerivs1(double x, int order) const;
+    /**
+     * Same as calcValue1(), but piecewise functions (e.g., SimmSpline) start
+     * their search for the interval containing x at the interval `hint`, and
+     * set `hint` to the interval containing x. A caller that evaluates a
+     * function at increasing (or nearby) arguments owns a hint (initially 0)
+     * and passes it to each call, so that each evaluation takes constant
+     * time. Since the hint is owned by the caller, evaluating a function from
+     * multiple threads is safe if each thread has its own hint. The default
+     * implementation ignores the hint and calls calcValue1().
+     */
+    virtual double calcValue1WithHint(double x, int& hint) const;
+    /**
+     * Same as calcDerivs1(), but with a hint as in calcValue1WithHint(). The
+     * default implementation ignores the hint and calls calcDerivs1().
+     */
+    virtual double calcDerivs1WithHint(double x, int order, int& hint) const;
+    /**
+     * Calculate the values of a function of one argument at many arguments
+     * (e.g., the times of a trajectory); out is resized to the size of xs.
+     * This is most efficient if xs is sorted, as the interval found for each
+     * argument is the hint for the next (see calcValue1WithHint()).
+     */
+    virtual void calcValues(const SimTK::Vector& xs, SimTK::Vector& out) const;
     /**
      * Get the number of components expected in the input vector.
      */
@@ -135,6 +180,37 @@ protected:
      */
     void resetFunction();
 
+    /**
+     * Get the SimTK::Function used to evaluate this function, creating it
+     * with createSimTKFunction() if it has not been created or if a property
+     * has been modified since it was created (see
+     * isObjectUpToDateWithProperties()).
+     */
+    const SimTK::Function& getSimTKFunction() const;
+
+    /**
+     * Return true if the SimTK::Function returned by createSimTKFunction()
+     * depends only on the property values of this function (e.g., it does not
+     * refer to this object, as FunctionAdapter does) and is safe to evaluate
+     * from multiple threads. Copies of such functions share the SimTK::Function
+     * that was already created for evaluation, rather than creating their own,
+     * which avoids repeating expensive work such as fitting a GCVSpline or
+     * parsing the expression of an ExpressionBasedFunction. Subclasses that
+     * return true must call resetFunction() when they are modified other than
+     * through their properties. The default implementation returns false.
+     */
+    virtual bool isSimTKFunctionShareable() const { return false; }
+
+    /**
+     * Find the index k of the interval [x[k], x[k+1]] containing aX, for
+     * increasing knots x of length n >= 2 and x[0] <= aX < x[n-1]. The
+     * intervals at and after `hint` (e.g., the interval found by the
+     * previous call) are checked first, so evaluating a function at
+     * increasing arguments takes constant time per evaluation; otherwise,
+     * this is a binary search.
+     */
+    static int findInterval(const double* x, int n, double aX, int hint);
+
 //=============================================================================
 };  // END class Function
 
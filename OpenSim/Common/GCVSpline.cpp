@@ -580,6 +580,16 @@ addPoint(double aX, double aY)
     return i;
 }
 
+double GCVSpline::calcValue1(double x) const {
+    return static_cast<const SimTK::Spline&>(getSimTKFunction()).calcValue(x);
+}
+
+double GCVSpline::calcDerivs1(double x, int order) const {
+    if (order == 0) return calcValue1(x);
+    return static_cast<const SimTK::Spline&>(getSimTKFunction())
+            .calcDerivative(order, x);
+}
+
 SimTK::Function* GCVSpline::createSimTKFunction() const {
     int degree = _halfOrder*2-1;
     Vector x(_x.getSize());
@@ -588,15 +598,25 @@ SimTK::Function* GCVSpline::createSimTKFunction() const {
         x[i] = _x[i];
     for (int i = 0; i < y.size(); ++i)
         y[i] = _y[i];
-    SimTK::Spline* spline;
-    if (_errorVariance < 0.0)
-        spline = new SimTK::Spline(SimTK::SplineFitter<double>::fitFromGCV(degree, x, y).getSpline());
-    else
-        spline = new SimTK::Spline(SimTK::SplineFitter<double>::fitFromErrorVariance(degree, x, y, _errorVariance).getSpline());
-
-     int sz = _coefficients.getSize();
-    for (int i = 0; i < sz; ++i)
-        _coefficients[i] = spline->getControlPointValues()[i];
-    return spline;
+    // Fitting is expensive, so the fit is kept as the SimTK::Function used
+    // to evaluate this spline (which copies of this spline share), and each
+    // call returns an independent spline with the same control points (e.g.,
+    // for each call to Model::initSystem()).
+    if (!_function || !isObjectUpToDateWithProperties()) {
+        SimTK::Spline* spline;
+        if (_errorVariance < 0.0)
+            spline = new SimTK::Spline(SimTK::SplineFitter<double>::fitFromGCV(degree, x, y).getSpline());
+        else
+            spline = new SimTK::Spline(SimTK::SplineFitter<double>::fitFromErrorVariance(degree, x, y, _errorVariance).getSpline());
+
+        int sz = _coefficients.getSize();
+        for (int i = 0; i < sz; ++i)
+            _coefficients[i] = spline->getControlPointValues()[i];
+        _function.reset(spline);
+        const_cast<GCVSpline*>(this)->setObjectIsUpToDateWithProperties();
+    }
+    return new SimTK::Spline(degree, x,
+            static_cast<const SimTK::Spline&>(*_function)
+                    .getControlPointValues());
 }
 
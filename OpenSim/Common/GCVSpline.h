@@ -233,6 +233,11 @@ public:
     //--------------------------------------------------------------------------
     // EVALUATION
     //--------------------------------------------------------------------------
+    double calcValue1(double x) const override;
+    double calcDerivs1(double x, int order) const override;
+
+protected:
+    bool isSimTKFunctionShareable() const override { return true; }
 
 //=============================================================================
 };  // END class GCVSpline
@@ -0,0 +1,299 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  Instrumentation.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "Instrumentation.h"
+
+#include "Exception.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+using namespace OpenSim;
+
+std::atomic<bool> Instrumentation::s_enabled{false};
+
+namespace {
+
+struct Event {
+    const char* name;
+    long long start;
+    // Negative for counters.
+    long long duration;
+    double value;
+};
+
+struct Totals {
+    long long count = 0;
+    double sum = 0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    void add(double value) {
+        ++count;
+        sum += value;
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+    void add(const Totals& other) {
+        count += other.count;
+        sum += other.sum;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+    }
+};
+
+/// Only the thread that owns the buffer records into it.
+struct ThreadBuffer {
+    int id = 0;
+    std::vector<Event> events;
+    long long numDropped = 0;
+    // Keyed by the address of the name; the same name in different
+    // translation units may have different addresses, so the totals are
+    // merged by the contents of the name in createSummary().
+    std::unordered_map<const char*, Totals> scopeTotals;
+    std::unordered_map<const char*, Totals> counterTotals;
+    void clear() {
+        events.clear();
+        numDropped = 0;
+        scopeTotals.clear();
+        counterTotals.clear();
+    }
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    int nextThreadId = 0;
+    std::atomic<int> maxEventsPerThread{500000};
+    std::atomic<long long> epoch{Instrumentation::now()};
+};
+
+Registry& getRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+ThreadBuffer& getThreadBuffer() {
+    // The registry shares ownership so that the events of threads that have
+    // exited (e.g., worker threads of a tool) are still written.
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        auto& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        buffer->id = registry.nextThreadId++;
+        registry.buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void recordEvent(ThreadBuffer& buffer, const Event& event) {
+    if ((int)buffer.events.size() <
+            getRegistry().maxEventsPerThread.load(std::memory_order_relaxed)) {
+        buffer.events.push_back(event);
+    } else {
+        ++buffer.numDropped;
+    }
+}
+
+std::string escapeJSON(const char* name) {
+    std::string out;
+    for (const char* c = name; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out += '\\';
+            out += *c;
+        } else if ((unsigned char)*c < 0x20) {
+            out += fmt::format("\\u{:04x}", (int)*c);
+        } else {
+            out += *c;
+        }
+    }
+    return out;
+}
+
+} // anonymous namespace
+
+void Instrumentation::setEnabled(bool enabled) {
+#ifndef OPENSIM_WITH_INSTRUMENTATION
+    if (enabled) {
+        log_warn("OpenSim was built without OPENSIM_WITH_INSTRUMENTATION; "
+                 "only code that uses OpenSim::Instrumentation directly is "
+                 "instrumented.");
+    }
+#endif
+    // Start the timeline of the trace before anything is recorded.
+    getRegistry();
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Instrumentation::clear() {
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    // Forget the buffers of threads that have exited.
+    registry.buffers.erase(std::remove_if(registry.buffers.begin(),
+                                   registry.buffers.end(),
+                                   [](const std::shared_ptr<ThreadBuffer>& b) {
+                                       return b.use_count() == 1;
+                                   }),
+            registry.buffers.end());
+    for (auto& buffer : registry.buffers) { buffer->clear(); }
+    registry.epoch = now();
+}
+
+void Instrumentation::setMaxEventsPerThread(int maxEvents) {
+    OPENSIM_THROW_IF(maxEvents < 0, Exception,
+            "Expected maxEvents >= 0, but got {}.", maxEvents);
+    getRegistry().maxEventsPerThread = maxEvents;
+}
+
+int Instrumentation::getMaxEventsPerThread() {
+    return getRegistry().maxEventsPerThread;
+}
+
+void Instrumentation::recordScope(
+        const char* name, long long startNs, long long endNs) {
+    auto& buffer = getThreadBuffer();
+    const long long duration = endNs - startNs;
+    buffer.scopeTotals[name].add((double)duration);
+    recordEvent(buffer, {name, startNs, duration, 0});
+}
+
+void Instrumentation::recordCounter(const char* name, double value) {
+    auto& buffer = getThreadBuffer();
+    buffer.counterTotals[name].add(value);
+    recordEvent(buffer, {name, now(), -1, value});
+}
+
+void Instrumentation::writeChromeTrace(const std::string& filename) {
+    std::ofstream out(filename);
+    OPENSIM_THROW_IF(!out, Exception, "Could not open '{}' for writing.",
+            filename);
+
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    const long long epoch = registry.epoch;
+    // Timestamps are in microseconds.
+    const auto toUs = [epoch](long long ns) { return (ns - epoch) / 1000.0; };
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    long long numEvents = 0;
+    long long numDropped = 0;
+    for (const auto& buffer : registry.buffers) {
+        if (buffer->events.empty()) continue;
+        out << (first ? "\n" : ",\n")
+            << fmt::format("{{\"name\":\"thread_name\",\"ph\":\"M\","
+                           "\"pid\":1,\"tid\":{0},"
+                           "\"args\":{{\"name\":\"thread {0}\"}}}}",
+                       buffer->id);
+        first = false;
+        for (const auto& event : buffer->events) {
+            const std::string name = escapeJSON(event.name);
+            if (event.duration >= 0) {
+                out << fmt::format(",\n{{\"name\":\"{}\",\"ph\":\"X\","
+                                   "\"pid\":1,\"tid\":{},\"ts\":{:.3f},"
+                                   "\"dur\":{:.3f}}}",
+                        name, buffer->id, toUs(event.start),
+                        event.duration / 1000.0);
+            } else {
+                out << fmt::format(",\n{{\"name\":\"{}\",\"ph\":\"C\","
+                                   "\"pid\":1,\"tid\":{},\"ts\":{:.3f},"
+                                   "\"args\":{{\"value\":{}}}}}",
+                        name, buffer->id, toUs(event.start), event.value);
+            }
+        }
+        numEvents += (long long)buffer->events.size();
+        numDropped += buffer->numDropped;
+    }
+    out << "\n]}\n";
+
+    log_info("Wrote {} instrumentation events to '{}'.", numEvents, filename);
+    if (numDropped) {
+        log_warn("{} instrumentation events were not kept for the trace; "
+                 "see Instrumentation::setMaxEventsPerThread().",
+                numDropped);
+    }
+}
+
+std::string Instrumentation::createSummary() {
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::map<std::string, Totals> scopes;
+    std::map<std::string, Totals> counters;
+    for (const auto& buffer : registry.buffers) {
+        for (const auto& kv : buffer->scopeTotals) {
+            scopes[kv.first].add(kv.second);
+        }
+        for (const auto& kv : buffer->counterTotals) {
+            counters[kv.first].add(kv.second);
+        }
+    }
+
+    std::vector<std::pair<std::string, Totals>> sortedScopes(
+            scopes.begin(), scopes.end());
+    std::stable_sort(sortedScopes.begin(), sortedScopes.end(),
+            [](const std::pair<std::string, Totals>& a,
+                    const std::pair<std::string, Totals>& b) {
+                return a.second.sum > b.second.sum;
+            });
+    std::size_t width = 5;
+    for (const auto& kv : scopes) width = std::max(width, kv.first.size());
+    for (const auto& kv : counters) width = std::max(width, kv.first.size());
+
+    std::stringstream ss;
+    ss << fmt::format("{:<{}} {:>10} {:>12} {:>12} {:>12} {:>12}\n", "Scope",
+            width, "Calls", "Total (ms)", "Mean (us)", "Min (us)",
+            "Max (us)");
+    for (const auto& kv : sortedScopes) {
+        const auto& t = kv.second;
+        ss << fmt::format(
+                "{:<{}} {:>10} {:>12.3f} {:>12.3f} {:>12.3f} {:>12.3f}\n",
+                kv.first, width, t.count, t.sum / 1e6,
+                t.sum / (double)t.count / 1e3, t.min / 1e3, t.max / 1e3);
+    }
+    if (!counters.empty()) {
+        ss << fmt::format("{:<{}} {:>10} {:>12} {:>12} {:>12} {:>12}\n",
+                "Counter", width, "Samples", "Sum", "Mean", "Min", "Max");
+        for (const auto& kv : counters) {
+            const auto& t = kv.second;
+            ss << fmt::format(
+                    "{:<{}} {:>10} {:>12.6g} {:>12.6g} {:>12.6g} {:>12.6g}\n",
+                    kv.first, width, t.count, t.sum,
+                    t.sum / (double)t.count, t.min, t.max);
+        }
+    }
+    return ss.str();
+}
+
+void Instrumentation::logSummary() {
+    std::istringstream summary(createSummary());
+    log_info("Instrumentation summary:");
+    std::string line;
+    while (std::getline(summary, line)) { log_info("{}", line); }
+}
@@ -0,0 +1,155 @@
+#ifndef OPENSIM_INSTRUMENTATION_H_
+#define OPENSIM_INSTRUMENTATION_H_
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  Instrumentation.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimCommonDLL.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace OpenSim {
+
+/** Record how much time is spent in instrumented scopes of code, and the
+values of counters, across the whole process, to find out where time goes
+(e.g., in Manager::integrate() or an Inverse Kinematics frame) without an
+external profiler.
+
+Instrumentation is disabled by default; enable it with setEnabled() or with
+the `--trace` option of `opensim-cmd`. While instrumentation is disabled, an
+instrumented scope costs a single relaxed atomic load. If OpenSim is built
+with the CMake option `OPENSIM_WITH_INSTRUMENTATION` off, the
+OPENSIM_INSTRUMENT_SCOPE() and OPENSIM_INSTRUMENT_COUNTER() macros expand to
+nothing, and only code that uses this class directly is instrumented.
+
+@code
+void MyComponent::computeExpensiveQuantity(const SimTK::State& s) const {
+    OPENSIM_INSTRUMENT_SCOPE("MyComponent::computeExpensiveQuantity");
+    ...
+    OPENSIM_INSTRUMENT_COUNTER("MyComponent::numIterations", numIterations);
+}
+@endcode
+
+After running the code of interest, writeChromeTrace() writes a JSON file
+with a timeline of the recorded scopes and counters for each thread, which
+you can open with https://ui.perfetto.dev or chrome://tracing, and
+logSummary() logs a table of the number of calls and the time spent in each
+scope.
+
+Each thread records into its own buffer, so recording does not take a lock
+(except once per thread, to register the buffer). The totals for each scope
+and counter are always kept, but each thread keeps at most
+getMaxEventsPerThread() events for the trace. Names must be string literals
+(or otherwise outlive the recorded data), since only the pointer is stored.
+clear(), writeChromeTrace(), createSummary() and logSummary() must not be
+invoked while other threads are recording. */
+class OSIMCOMMON_API Instrumentation {
+public:
+    /// Start or stop recording. Enabling instrumentation does not clear
+    /// previously recorded data; see clear().
+    static void setEnabled(bool enabled);
+    static bool isEnabled() {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Discard all recorded data, and start the timeline of the trace at the
+    /// current time.
+    static void clear();
+
+    /// The maximum number of scope and counter events each thread keeps for
+    /// writeChromeTrace(); later events are only included in the totals.
+    /// Default: 500000.
+    static void setMaxEventsPerThread(int maxEvents);
+    static int getMaxEventsPerThread();
+
+    /// The current time in nanoseconds (from a monotonic clock), as used for
+    /// recordScope().
+    static long long now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+    }
+    /// Record that the calling thread spent the time between `startNs` and
+    /// `endNs` (from now()) in the scope with the given name. Usually, you
+    /// would use OPENSIM_INSTRUMENT_SCOPE() instead.
+    static void recordScope(const char* name, long long startNs,
+            long long endNs);
+    /// Record the current value of a counter. Usually, you would use
+    /// OPENSIM_INSTRUMENT_COUNTER() instead.
+    static void recordCounter(const char* name, double value);
+
+    /// Write the recorded events in the Chrome trace event (JSON) format,
+    /// which Perfetto also reads.
+    static void writeChromeTrace(const std::string& filename);
+    /// A table with the number of calls and the total, mean, minimum and
+    /// maximum duration of each scope (over all threads), sorted by the total
+    /// duration, followed by a table of the counters.
+    static std::string createSummary();
+    /// Log createSummary() at the info level.
+    static void logSummary();
+
+    /// Record the time from construction to destruction of this object if
+    /// instrumentation is enabled when it is constructed.
+    class Scope {
+    public:
+        explicit Scope(const char* name)
+                : m_name(isEnabled() ? name : nullptr),
+                  m_start(m_name ? now() : 0) {}
+        ~Scope() {
+            if (m_name) { recordScope(m_name, m_start, now()); }
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* m_name;
+        long long m_start;
+    };
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+} // namespace OpenSim
+
+#define OPENSIM_INSTRUMENT_CONCAT_IMPL(a, b) a##b
+#define OPENSIM_INSTRUMENT_CONCAT(a, b) OPENSIM_INSTRUMENT_CONCAT_IMPL(a, b)
+
+#ifdef OPENSIM_WITH_INSTRUMENTATION
+/// Time the rest of the enclosing scope; see OpenSim::Instrumentation.
+#define OPENSIM_INSTRUMENT_SCOPE(name)                                         \
+    const OpenSim::Instrumentation::Scope OPENSIM_INSTRUMENT_CONCAT(           \
+            osimInstrumentScope, __LINE__)(name)
+/// Record the value of a counter; see OpenSim::Instrumentation.
+#define OPENSIM_INSTRUMENT_COUNTER(name, value)                                \
+    do {                                                                       \
+        if (OpenSim::Instrumentation::isEnabled()) {                           \
+            OpenSim::Instrumentation::recordCounter(name, value);              \
+        }                                                                      \
+    } while (false)
+#else
+#define OPENSIM_INSTRUMENT_SCOPE(name)
+#define OPENSIM_INSTRUMENT_COUNTER(name, value) do {} while (false)
+#endif
+
+#endif // OPENSIM_INSTRUMENTATION_H_
@@ -101,6 +101,15 @@ public:
     //--------------------------------------------------------------------------
     // EVALUATION
     //--------------------------------------------------------------------------
+    double calcValue1(double x) const override
+    {
+        return _coefficients[0] * x + _coefficients[1];
+    }
+    double calcDerivs1(double x, int order) const override
+    {
+        if (order == 0) return calcValue1(x);
+        return order == 1 ? _coefficients[0] : 0;
+    }
     SimTK::Function* createSimTKFunction() const override;
 
 //=============================================================================
@@ -182,6 +182,26 @@ double MultiplierFunction::calcValue(const SimTK::Vector& x) const
     }
 }
 
+double MultiplierFunction::calcValue1(double x) const
+{
+    if (_osFunction)
+        return _osFunction->calcValue1(x) * _scale;
+    else {
+        throw Exception("MultiplierFunction::calcValue1(): _osFunction is NULL.");
+        return 0.0;
+    }
+}
+
+double MultiplierFunction::calcDerivs1(double x, int order) const
+{
+    if (_osFunction)
+        return _osFunction->calcDerivs1(x, order) * _scale;
+    else {
+        throw Exception("MultiplierFunction::calcDerivs1(): _osFunction is NULL.");
+        return 0.0;
+    }
+}
+
 int MultiplierFunction::getArgumentSize() const
 {
     if (_osFunction)
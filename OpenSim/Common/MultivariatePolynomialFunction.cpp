@@ -627,20 +627,14 @@ SimTK::Function* MultivariatePolynomialFunction::createSimTKFunction() const {
 
 SimTK::Vector MultivariatePolynomialFunction::getTermValues(
         const SimTK::Vector& x) const {
-    if (!_function) {
-        _function = createSimTKFunction();
-    }
-    return dynamic_cast<const SimTKMultivariatePolynomial<SimTK::Real>*>(
-                    _function)->calcMonomialValues(x);
+    return dynamic_cast<const SimTKMultivariatePolynomial<SimTK::Real>&>(
+                    getSimTKFunction()).calcMonomialValues(x);
 }
 
 SimTK::Vector MultivariatePolynomialFunction::getTermDerivatives(
         const std::vector<int>& derivComponent, const SimTK::Vector& x) const {
-    if (!_function) {
-        _function = createSimTKFunction();
-    }
-    return dynamic_cast<const SimTKMultivariatePolynomial<SimTK::Real>*>(
-                    _function)->calcMonomialDerivatives(
+    return dynamic_cast<const SimTKMultivariatePolynomial<SimTK::Real>&>(
+                    getSimTKFunction()).calcMonomialDerivatives(
                         SimTK::ArrayViewConst_<int>(derivComponent), x);
 }
 
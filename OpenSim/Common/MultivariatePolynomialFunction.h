@@ -180,6 +180,9 @@ public:
      */
     MultivariatePolynomialFunction generatePartialVelocityFunction() const;
 
+protected:
+    bool isSimTKFunctionShareable() const override { return true; }
+
 private:
     void constructProperties() {
         constructProperty_coefficients(SimTK::Vector(0));
@@ -33,13 +33,16 @@
 #include "Object.h"
 
 #include "Assertion.h"
+#include "BinaryIO.h"
 #include "Exception.h"
 #include "IO.h"
 #include "Logger.h"
 #include "PropertyTransform.h"
 #include "Property_Deprecated.h"
 #include "XMLDocument.h"
+#include <algorithm>
 #include <fstream>
+#include <vector>
 
 using namespace OpenSim;
 using namespace std;
@@ -49,9 +52,9 @@ using SimTK::Transform;
 //=============================================================================
 // STATICS
 //=============================================================================
-ArrayPtrs<Object>           Object::_registeredTypes;
-std::map<string,Object*>    Object::_mapTypesToDefaultObjects;
-std::map<string,string>     Object::_renamedTypesMap;
+ArrayPtrs<Object>                   Object::_registeredTypes;
+std::unordered_map<string,Object*>  Object::_mapTypesToDefaultObjects;
+std::unordered_map<string,string>   Object::_renamedTypesMap;
 
 bool                        Object::_serializeAllDefaults=false;
 const string                Object::DEFAULT_NAME(ObjectDEFAULT_NAME);
@@ -530,8 +533,7 @@ renameType(const std::string& oldTypeName, const std::string& newTypeName)
     if(oldTypeName == newTypeName)
         return; 
 
-    std::map<std::string,Object*>::const_iterator p = 
-        _mapTypesToDefaultObjects.find(newTypeName);
+    const auto p = _mapTypesToDefaultObjects.find(newTypeName);
 
     if (p == _mapTypesToDefaultObjects.end())
         throw OpenSim::Exception(
@@ -544,6 +546,13 @@ renameType(const std::string& oldTypeName, const std::string& newTypeName)
 
 /*static*/ const Object* Object::
 getDefaultInstanceOfType(const std::string& objectTypeTag) {
+    // Most types have not been renamed, so try them first without copying
+    // the name.
+    if (_renamedTypesMap.find(objectTypeTag) == _renamedTypesMap.end()) {
+        const auto p = _mapTypesToDefaultObjects.find(objectTypeTag);
+        return p != _mapTypesToDefaultObjects.end() ? p->second : nullptr;
+    }
+
     std::string actualName = objectTypeTag;
     bool wasRenamed = false; // for a better error message
 
@@ -553,8 +562,7 @@ getDefaultInstanceOfType(const std::string& objectTypeTag) {
     const int MaxRenames = (int)_renamedTypesMap.size();
     int renameCount = 0;
     while(true) {
-        std::map<std::string,std::string>::const_iterator newNamep =
-            _renamedTypesMap.find(actualName);
+        const auto newNamep = _renamedTypesMap.find(actualName);
         if (newNamep == _renamedTypesMap.end())
             break; // actualName has not been renamed
 
@@ -569,8 +577,7 @@ getDefaultInstanceOfType(const std::string& objectTypeTag) {
     }
 
     // Look up the "actualName" default object and return it.
-    std::map<std::string,Object*>::const_iterator p = 
-        _mapTypesToDefaultObjects.find(actualName);
+    const auto p = _mapTypesToDefaultObjects.find(actualName);
     if (p != _mapTypesToDefaultObjects.end())
         return p->second;
 
@@ -619,10 +626,15 @@ newInstanceOfType(const std::string& objectTypeTag)
 /*static*/ void Object::
 getRegisteredTypenames(Array<std::string>& rTypeNames)
 {
-    std::map<string,Object*>::const_iterator p = 
-        _mapTypesToDefaultObjects.begin();
-    for (; p != _mapTypesToDefaultObjects.end(); ++p)
-        rTypeNames.append(p->first);
+    // The map is unordered, so sort the names as they were sorted when the
+    // map was ordered.
+    std::vector<std::string> typeNames;
+    typeNames.reserve(_mapTypesToDefaultObjects.size());
+    for (const auto& p : _mapTypesToDefaultObjects)
+        typeNames.push_back(p.first);
+    std::sort(typeNames.begin(), typeNames.end());
+    for (const auto& typeName : typeNames)
+        rTypeNames.append(typeName);
     // Renamed type names don't appear in the registeredTypes map, unless
     // they were separately registered.
 }
@@ -787,9 +799,35 @@ try {
     updateDefaultObjectsFromXMLNode(); // May need to pass in aNode
 
     // LOOP THROUGH PROPERTIES
-    for(int i=0; i < _propertyTable.getNumProperties(); ++i) {
-        AbstractProperty& prop = _propertyTable.updAbstractPropertyByIndex(i);
-        prop.readFromXMLParentElement(aNode, versionNumber);
+    // Finding each property's element requires searching the children of
+    // aNode, so for elements with many children, index the children by tag
+    // once instead.
+    const int MinChildElementsToIndex = 8;
+    int numChildElements = 0;
+    for (auto iter = aNode.element_begin();
+            iter != aNode.element_end() &&
+            numChildElements < MinChildElementsToIndex; ++iter)
+        ++numChildElements;
+    if (numChildElements < MinChildElementsToIndex) {
+        for(int i=0; i < _propertyTable.getNumProperties(); ++i) {
+            AbstractProperty& prop =
+                    _propertyTable.updAbstractPropertyByIndex(i);
+            prop.readFromXMLParentElement(aNode, versionNumber);
+        }
+    } else {
+        AbstractProperty::XMLChildElementIndex childElements;
+        for (auto iter = aNode.element_begin(); iter != aNode.element_end();
+                ++iter) {
+            // Only the first element with each tag is used, as when
+            // searching.
+            childElements.emplace(iter->getElementTag(), iter);
+        }
+        for(int i=0; i < _propertyTable.getNumProperties(); ++i) {
+            AbstractProperty& prop =
+                    _propertyTable.updAbstractPropertyByIndex(i);
+            prop.readFromXMLParentElement(aNode, versionNumber,
+                    childElements);
+        }
     }
 
     // LOOP THROUGH DEPRECATED PROPERTIES
@@ -967,6 +1005,242 @@ try {
 
 }
 
+//-----------------------------------------------------------------------------
+// BINARY SERIALIZATION
+//-----------------------------------------------------------------------------
+template<class T> static void 
+WriteBinaryArray(std::ostream& stream, const Array<T>& array)
+{
+    BinaryIO::write(stream, array.getSize());
+    for (int i = 0; i < array.getSize(); ++i)
+        BinaryIO::write(stream, array[i]);
+}
+
+template<class T> static Array<T> 
+ReadBinaryArray(std::istream& stream)
+{
+    const int size = BinaryIO::read<int>(stream);
+    OPENSIM_THROW_IF(size < 0, Exception,
+            "Invalid array size {} in binary data.", size);
+    Array<T> array(T(), size);
+    for (int i = 0; i < size; ++i)
+        BinaryIO::read(stream, array[i]);
+    return array;
+}
+
+void Object::writeToBinaryStream(std::ostream& stream) const
+{
+    BinaryIO::write(stream, getConcreteClassName());
+    BinaryIO::write(stream, getName());
+    BinaryIO::write(stream, _description);
+    BinaryIO::write(stream, _authors);
+    BinaryIO::write(stream, _references);
+
+    // The file this object was read from, so that objects that find their
+    // data files relative to it (e.g., ExternalLoads) still find them.
+    BinaryIO::write(stream, getDocumentFileName());
+    BinaryIO::write(stream, _inlined);
+
+    // PROPERTIES
+    BinaryIO::write(stream, _propertyTable.getNumProperties());
+    for (int i = 0; i < _propertyTable.getNumProperties(); ++i) {
+        const AbstractProperty& prop = 
+                _propertyTable.getAbstractPropertyByIndex(i);
+        BinaryIO::write(stream, prop.getName());
+        BinaryIO::write(stream, prop.getValueIsDefault());
+        prop.writeToBinaryStream(stream);
+    }
+
+    // DEPRECATED PROPERTIES
+    // Many classes (e.g., GCVSpline, SimmSpline, and Scale) still store their
+    // data in deprecated properties, so the binary stream must include them
+    // to reproduce the object.
+    BinaryIO::write(stream, _propertySet.getSize());
+    for (int i = 0; i < _propertySet.getSize(); ++i) {
+        const Property_Deprecated* prop = _propertySet.get(i);
+        const Property_Deprecated::PropertyType type = prop->getType();
+        BinaryIO::write(stream, prop->getName());
+        BinaryIO::write(stream, (int)type);
+        BinaryIO::write(stream, prop->getValueIsDefault());
+        switch (type) {
+        case Property_Deprecated::Bool:
+            BinaryIO::write(stream, prop->getValueBool());
+            break;
+        case Property_Deprecated::Int:
+            BinaryIO::write(stream, prop->getValueInt());
+            break;
+        case Property_Deprecated::Dbl:
+            BinaryIO::write(stream, prop->getValueDbl());
+            break;
+        case Property_Deprecated::Str:
+            BinaryIO::write(stream, prop->getValueStr());
+            break;
+        case Property_Deprecated::BoolArray:
+            WriteBinaryArray(stream, prop->getValueBoolArray());
+            break;
+        case Property_Deprecated::IntArray:
+            WriteBinaryArray(stream, prop->getValueIntArray());
+            break;
+        case Property_Deprecated::DblArray:
+        case Property_Deprecated::DblVec:
+            WriteBinaryArray(stream, prop->getValueDblArray());
+            break;
+        case Property_Deprecated::Transform: {
+            OpenSim::Array<double> arr(0, 6);
+            static_cast<const PropertyTransform*>(prop)
+                    ->getRotationsAndTranslationsAsArray6(&arr[0]);
+            WriteBinaryArray(stream, arr);
+            break;
+        }
+        case Property_Deprecated::StrArray:
+            WriteBinaryArray(stream, prop->getValueStrArray());
+            break;
+        case Property_Deprecated::Obj:
+            prop->getValueObj().writeToBinaryStream(stream);
+            break;
+        case Property_Deprecated::ObjPtr: {
+            const Object* object = prop->getValueObjPtr();
+            BinaryIO::write(stream, object != nullptr);
+            if (object) object->writeToBinaryStream(stream);
+            break;
+        }
+        case Property_Deprecated::ObjArray:
+            BinaryIO::write(stream, prop->getArraySize());
+            for (int j = 0; j < prop->getArraySize(); ++j)
+                prop->getValueObjPtr(j)->writeToBinaryStream(stream);
+            break;
+        default:
+            OPENSIM_THROW_FRMOBJ(Exception,
+                    "Property '{}' has an unrecognized type.", 
+                    prop->getName());
+        }
+    }
+}
+
+Object* Object::makeObjectFromBinaryStream(std::istream& stream)
+{
+    const std::string className = BinaryIO::read<std::string>(stream);
+    std::unique_ptr<Object> object(newInstanceOfType(className));
+    OPENSIM_THROW_IF(!object, Exception,
+            "Binary data contains an object of type {}, which is not "
+            "registered.", className);
+    object->readFromBinaryStream(stream);
+    return object.release();
+}
+
+void Object::readFromBinaryStream(std::istream& stream)
+{
+    setName(BinaryIO::read<std::string>(stream));
+    BinaryIO::read(stream, _description);
+    BinaryIO::read(stream, _authors);
+    BinaryIO::read(stream, _references);
+    _objectIsUpToDate = false;
+
+    const std::string documentFileName = BinaryIO::read<std::string>(stream);
+    _inlined = BinaryIO::read<bool>(stream);
+    if (!documentFileName.empty()) {
+        _document = std::make_shared<XMLDocument>();
+        _document->setFileName(documentFileName);
+    }
+
+    // PROPERTIES
+    const int numProperties = BinaryIO::read<int>(stream);
+    for (int i = 0; i < numProperties; ++i) {
+        const std::string name = BinaryIO::read<std::string>(stream);
+        const bool isDefault = BinaryIO::read<bool>(stream);
+        // The properties are normally in the order they were written.
+        AbstractProperty* prop = nullptr;
+        if (i < _propertyTable.getNumProperties()) {
+            prop = &_propertyTable.updAbstractPropertyByIndex(i);
+        }
+        if (!prop || prop->getName() != name) {
+            prop = _propertyTable.updPropertyPtr(name);
+        }
+        OPENSIM_THROW_IF_FRMOBJ(!prop, Exception,
+                "Binary data contains property '{}', which {} does not have.",
+                name, getConcreteClassName());
+        prop->readFromBinaryStream(stream);
+        prop->setValueIsDefault(isDefault);
+    }
+
+    // DEPRECATED PROPERTIES
+    // See writeToBinaryStream().
+    const int numDeprecated = BinaryIO::read<int>(stream);
+    for (int i = 0; i < numDeprecated; ++i) {
+        const std::string name = BinaryIO::read<std::string>(stream);
+        const auto type = 
+                (Property_Deprecated::PropertyType)BinaryIO::read<int>(stream);
+        const bool isDefault = BinaryIO::read<bool>(stream);
+        Property_Deprecated* prop = _propertySet.contains(name);
+        OPENSIM_THROW_IF_FRMOBJ(!prop || prop->getType() != type, Exception,
+                "Binary data contains property '{}', which {} does not have "
+                "or which has a different type.",
+                name, getConcreteClassName());
+        switch (type) {
+        case Property_Deprecated::Bool:
+            prop->setValue(BinaryIO::read<bool>(stream));
+            break;
+        case Property_Deprecated::Int:
+            prop->setValue(BinaryIO::read<int>(stream));
+            break;
+        case Property_Deprecated::Dbl:
+            prop->setValue(BinaryIO::read<double>(stream));
+            break;
+        case Property_Deprecated::Str:
+            prop->setValue(BinaryIO::read<std::string>(stream));
+            break;
+        case Property_Deprecated::BoolArray:
+            prop->setValue(ReadBinaryArray<bool>(stream));
+            break;
+        case Property_Deprecated::IntArray:
+            prop->setValue(ReadBinaryArray<int>(stream));
+            break;
+        case Property_Deprecated::DblArray:
+        case Property_Deprecated::DblVec:
+        case Property_Deprecated::Transform:
+            prop->setValue(ReadBinaryArray<double>(stream));
+            break;
+        case Property_Deprecated::StrArray:
+            prop->setValue(ReadBinaryArray<std::string>(stream));
+            break;
+        case Property_Deprecated::Obj: {
+            // The object belongs to the property, so it is read in place.
+            Object& object = prop->getValueObj();
+            const std::string className = BinaryIO::read<std::string>(stream);
+            OPENSIM_THROW_IF_FRMOBJ(
+                    className != object.getConcreteClassName(), Exception,
+                    "Expected an object of type {} for property '{}', but "
+                    "the binary data contains an object of type {}.",
+                    object.getConcreteClassName(), name, className);
+            object.readFromBinaryStream(stream);
+            break;
+        }
+        case Property_Deprecated::ObjPtr:
+            if (BinaryIO::read<bool>(stream)) {
+                prop->setValue(makeObjectFromBinaryStream(stream));
+            } else {
+                prop->setValue((Object*)nullptr);
+            }
+            break;
+        case Property_Deprecated::ObjArray: {
+            prop->clearObjArray();
+            const int size = BinaryIO::read<int>(stream);
+            for (int j = 0; j < size; ++j) {
+                std::unique_ptr<Object> object(
+                        makeObjectFromBinaryStream(stream));
+                prop->appendValue(object.get());
+                object.release();
+            }
+            break;
+        }
+        default:
+            OPENSIM_THROW_FRMOBJ(Exception,
+                    "Property '{}' has an unrecognized type.", name);
+        }
+        prop->setValueIsDefault(isDefault);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // UPDATE DEFAULT OBJECTS FROM XML NODE
 //-----------------------------------------------------------------------------
@@ -42,9 +42,11 @@
 #include "Property.h"
 
 #include <cstring>
+#include <istream>
 #include <map>
 #include <memory>
 #include <ostream>
+#include <unordered_map>
 #include <set>
 #include <string>
 
@@ -617,6 +619,26 @@ public:
     /** dump the XML representation of this %Object into an std::string and return it.
     Mainly intended for debugging and for use by the XML browser in the GUI. **/
     std::string dump() const; 
+
+    #ifndef SWIG
+    /** Write this %Object (its concrete class name, its name, and the values
+    of all of its properties, including the objects they contain) to a stream
+    in a compact binary form that makeObjectFromBinaryStream() reads without
+    parsing XML or updating old file versions. This is a snapshot for loading
+    the same object quickly many times (e.g., a model used by many jobs); it
+    can be read only by the same version of %OpenSim on a machine with the
+    same byte order (see BinaryIO), so use XML files to store and share
+    objects. Objects that were read from separate XML files are written in
+    place, along with the name of the file they were read from, which is
+    restored as the name of the object's document (getDocumentFileName()). **/
+    void writeToBinaryStream(std::ostream& stream) const;
+
+    /** Create an %Object from data written by writeToBinaryStream(). The
+    caller owns the returned object.
+    @throws Exception if the data ends early, or if it contains a class or
+    a property that does not exist in this version of %OpenSim. **/
+    static Object* makeObjectFromBinaryStream(std::istream& stream);
+    #endif
     /**@}**/
     //--------------------------------------------------------------------------
     // ADVANCED/OBSCURE/QUESTIONABLE/BUGGY
@@ -848,6 +870,10 @@ private:
     void updateDefaultObjectsFromXMLNode();
     void updateDefaultObjectsXMLNode(SimTK::Xml::Element& aParent);
 
+    // Read the name, description and properties written by
+    // writeToBinaryStream() (after the concrete class name) into this object.
+    void readFromBinaryStream(std::istream& stream);
+
     /** This is invoked at the start of print(). If _debugLevel is at least 1 then
      * printing is allowed to proceed even if the resulting file is corrupt, otherwise
      * printing is aborted.
@@ -879,8 +905,9 @@ private:
     // Map from concrete object class name string to a default object of that 
     // type kept in the above array of registered types. Renamed types are *not* 
     // normally entered here; the names are mapped separately using the map 
-    // below.
-    static std::map<std::string,Object*>        _mapTypesToDefaultObjects;
+    // below. This is searched for each object that is read from XML, so it is
+    // a hash table.
+    static std::unordered_map<std::string,Object*> _mapTypesToDefaultObjects;
 
     // Map types that have been renamed to their new names, which can
     // then be used to find them in the default object map. This lets us 
@@ -889,7 +916,7 @@ private:
     // to map one registered type to a different one programmatically, because
     // we'll look up the name in the rename table first prior to searching
     // the registered types list.
-    static std::map<std::string,std::string>    _renamedTypesMap;
+    static std::unordered_map<std::string,std::string> _renamedTypesMap;
 
     // Global flag to indicate if all registered objects are to be written in 
     // a "defaults" section.
@@ -1426,9 +1453,9 @@ ObjectProperty<T>::readFromXMLElement
         if (objectsFound > this->getMaxListSize())
             continue; // ignore this one
 
-        // Create an Object of the element tag's type.
-        Object* object = Object::newInstanceOfType(objTypeTag);
-        OPENSIM_ASSERT(object); // we just checked above
+        // Create an Object of the element tag's type (the same as
+        // Object::newInstanceOfType(), without looking up the type again).
+        Object* object = registeredObj->clone();
         object->readObjectFromXMLNodeOrFile(*iter, versionNumber);
 
         T* objectT = dynamic_cast<T*>(object);
@@ -1461,6 +1488,33 @@ ObjectProperty<T>::writeToXMLElement
 }
 
 
+template <class T> inline void 
+ObjectProperty<T>::writeToBinaryStream(std::ostream& stream) const
+{
+    const int size = (int)objects.size();
+    BinaryIO::write(stream, size);
+    for (int i=0; i < size; ++i)
+        objects[i]->writeToBinaryStream(stream);
+}
+
+template <class T> inline void 
+ObjectProperty<T>::readFromBinaryStream(std::istream& stream)
+{
+    const int size = BinaryIO::read<int>(stream);
+    clearValues();
+    for (int i=0; i < size; ++i) {
+        std::unique_ptr<Object> object(
+                Object::makeObjectFromBinaryStream(stream));
+        T* objectT = dynamic_cast<T*>(object.get());
+        OPENSIM_THROW_IF(!objectT, Exception,
+                "Object type {} wrong for {} property '{}'.",
+                object->getConcreteClassName(), objectClassName,
+                this->getName());
+        object.release();
+        adoptAndAppendValueVirtual(objectT); // don't copy
+    }
+}
+
 template <class T> inline void 
 ObjectProperty<T>::setValueAsObject(const Object& obj, int index) {
     if (index < 0 && this->getMaxListSize()==1)
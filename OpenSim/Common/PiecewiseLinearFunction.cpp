@@ -432,9 +432,19 @@ void PiecewiseLinearFunction::calcCoefficients()
 }
 
 double PiecewiseLinearFunction::calcValue(const Vector& x) const
+{
+    return calcValue1(x[0]);
+}
+
+double PiecewiseLinearFunction::calcValue1(double aX) const
+{
+    int hint = 0;
+    return calcValue1WithHint(aX, hint);
+}
+
+double PiecewiseLinearFunction::calcValue1WithHint(double aX, int& hint) const
 {
     int n = _x.getSize();
-    double aX = x[0];
 
     if (aX < _x[0])
         return _y[0] + (aX - _x[0]) * _b[0];
@@ -450,32 +460,36 @@ double PiecewiseLinearFunction::calcValue(const Vector& x) const
     else if (EQUAL_WITHIN_ERROR(aX,_x[n-1]))
         return _y[n-1];
 
-    // Do a binary search to find which two points the abscissa is between.
-    int k, i = 0;
-    int j = n;
-    while (1)
-    {
-        k = (i+j)/2;
-        if (aX < _x[k])
-            j = k;
-        else if (aX > _x[k+1])
-            i = k;
-        else
-            break;
-    }
+    // Find which two points the abscissa is between, starting with the
+    // interval given by the caller.
+    const int k = findInterval(&_x[0], n, aX, hint);
+    hint = k;
 
     return _y[k] + (aX - _x[k]) * _b[k];
 }
 
 double PiecewiseLinearFunction::calcDerivative(const std::vector<int>& derivComponents, const Vector& x) const
 {
-    if (derivComponents.size() == 0)
+    return calcDerivs1(x[0], (int)derivComponents.size());
+}
+
+double PiecewiseLinearFunction::calcDerivs1(double aX, int order) const
+{
+    int hint = 0;
+    return calcDerivs1WithHint(aX, order, hint);
+}
+
+double PiecewiseLinearFunction::calcDerivs1WithHint(
+        double aX, int order, int& hint) const
+{
+    if (order == 0)
+        return calcValue1WithHint(aX, hint);
+    if (order < 1)
         return SimTK::NaN;
-    if (derivComponents.size() > 1)
+    if (order > 1)
         return 0.0;
 
     int n = _x.getSize();
-    double aX = x[0];
 
     if (aX < _x[0]) {
         return _b[0];
@@ -493,19 +507,10 @@ double PiecewiseLinearFunction::calcDerivative(const std::vector<int>& derivComp
         return _b[n-1];
     }
 
-    // Do a binary search to find which two points the abscissa is between.
-    int k, i = 0;
-    int j = n;
-    while (1)
-    {
-        k = (i+j)/2;
-        if (aX < _x[k])
-            j = k;
-        else if (aX > _x[k+1])
-            i = k;
-        else
-            break;
-    }
+    // Find which two points the abscissa is between, starting with the
+    // interval given by the caller.
+    const int k = findInterval(&_x[0], n, aX, hint);
+    hint = k;
 
     return _b[k];
 }
@@ -116,6 +116,10 @@ public:
     //--------------------------------------------------------------------------
     double calcValue(const SimTK::Vector& x) const override;
     double calcDerivative(const std::vector<int>& derivComponents, const SimTK::Vector& x) const override;
+    double calcValue1(double x) const override;
+    double calcDerivs1(double x, int order) const override;
+    double calcValue1WithHint(double x, int& hint) const override;
+    double calcDerivs1WithHint(double x, int order, int& hint) const override;
     int getArgumentSize() const override;
     int getMaxDerivativeOrder() const override;
     SimTK::Function* createSimTKFunction() const override;
@@ -26,6 +26,7 @@
 // INCLUDES
 #include "AbstractProperty.h"
 #include "Assertion.h"
+#include "BinaryIO.h"
 #include "Exception.h"
 #include "Logger.h"
 
@@ -954,6 +955,21 @@ public:
         propertyElement.setValue(valstream.str()); 
     } 
 
+    void writeToBinaryStream(std::ostream& stream) const override final {
+        const int size = (int)values.size();
+        BinaryIO::write(stream, size);
+        for (int i = 0; i < size; ++i) BinaryIO::write(stream, values[i]);
+    }
+
+    void readFromBinaryStream(std::istream& stream) override final {
+        const int size = BinaryIO::read<int>(stream);
+        OPENSIM_THROW_IF(size < 0, Exception,
+                "Invalid number of values ({}) for property '{}'.", size,
+                this->getName());
+        values.resize(size);
+        for (int i = 0; i < size; ++i) BinaryIO::read(stream, values[i]);
+    }
+
 
     const Object& getValueAsObject(int index=-1) const override final {
         throw OpenSim::Exception(
@@ -1150,6 +1166,8 @@ public:
         int                  versionNumber) override final;
     void writeToXMLElement
        (SimTK::Xml::Element& propertyElement) const override final;
+    void writeToBinaryStream(std::ostream& stream) const override final;
+    void readFromBinaryStream(std::istream& stream) override final;
     void setValueAsObject(const Object& obj, int index=-1) override final;
 
     bool isUnnamedProperty() const override final {return isUnnamed;}
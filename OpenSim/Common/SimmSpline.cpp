@@ -509,6 +509,17 @@ int SimmSpline::addPoint(double aX, double aY)
 }
 
 double SimmSpline::calcValue(const Vector& x) const
+{
+    return calcValue1(x[0]);
+}
+
+double SimmSpline::calcValue1(double aX) const
+{
+    int hint = 0;
+    return calcValue1WithHint(aX, hint);
+}
+
+double SimmSpline::calcValue1WithHint(double aX, int& hint) const
 {
     // NOT A NUMBER
     if(!_y.getSize()) return(SimTK::NaN);
@@ -516,11 +527,10 @@ double SimmSpline::calcValue(const Vector& x) const
     if(!_c.getSize()) return(SimTK::NaN);
     if(!_d.getSize()) return(SimTK::NaN);
 
-    int i, j, k;
+    int k;
     double dx;
 
     int n = _x.getSize();
-    double aX = x[0];
 
    /* Check if the abscissa is out of range of the function. If it is,
     * then use the slope of the function at the appropriate end point to
@@ -556,19 +566,10 @@ double SimmSpline::calcValue(const Vector& x) const
     }
     else
     {
-        /* Do a binary search to find which two points the abscissa is between. */
-        i = 0;
-        j = n;
-        while (1)
-        {
-            k = (i+j)/2;
-            if (aX < _x[k])
-                j = k;
-            else if (aX > _x[k+1])
-                i = k;
-            else
-                break;
-        }
+        /* Find which two points the abscissa is between, starting with the
+         * interval given by the caller. */
+        k = findInterval(&_x[0], n, aX, hint);
+        hint = k;
     }
 
    dx = aX - _x[k];
@@ -576,6 +577,18 @@ double SimmSpline::calcValue(const Vector& x) const
 }
 
 double SimmSpline::calcDerivative(const std::vector<int>& derivComponents, const Vector& x) const
+{
+    return calcDerivs1(x[0], (int)derivComponents.size());
+}
+
+double SimmSpline::calcDerivs1(double aX, int aDerivOrder) const
+{
+    int hint = 0;
+    return calcDerivs1WithHint(aX, aDerivOrder, hint);
+}
+
+double SimmSpline::calcDerivs1WithHint(
+        double aX, int aDerivOrder, int& hint) const
 {
     // NOT A NUMBER
     if(!_y.getSize()) return(SimTK::NaN);
@@ -583,14 +596,15 @@ double SimmSpline::calcDerivative(const std::vector<int>& derivComponents, const
     if(!_c.getSize()) return(SimTK::NaN);
     if(!_d.getSize()) return(SimTK::NaN);
 
-    int i, j, k;
+    int k;
     double dx;
 
+    if (aDerivOrder == 0)
+        return calcValue1WithHint(aX, hint);
+
     int n = _x.getSize();
-    double aX = x[0];
-    int aDerivOrder = (int)derivComponents.size();
     if (aDerivOrder < 1 || aDerivOrder > 2)
-        throw Exception("SimmSpline::calcDerivative(): derivative order must be 1 or 2.");
+        throw Exception("SimmSpline::calcDerivative(): derivative order must be 0, 1, or 2.");
 
    /* Check if the abscissa is out of range of the function. If it is,
     * then use the slope of the function at the appropriate end point to
@@ -646,19 +660,10 @@ double SimmSpline::calcDerivative(const std::vector<int>& derivComponents, const
     }
     else
     {
-        /* Do a binary search to find which two points the abscissa is between. */
-        i = 0;
-        j = n;
-        while (1)
-        {
-            k = (i+j)/2;
-            if (aX < _x[k])
-                j = k;
-            else if (aX > _x[k+1])
-                i = k;
-            else
-                break;
-        }
+        /* Find which two points the abscissa is between, starting with the
+         * interval given by the caller. */
+        k = findInterval(&_x[0], n, aX, hint);
+        hint = k;
     }
 
    dx = aX - _x[k];
@@ -71,6 +71,12 @@ private:
 public:
     StateVector()                   = default;
     StateVector(const StateVector&) = default;
+#ifndef SWIG
+    // Moving (e.g., when a Storage grows) transfers the data instead of
+    // copying it.
+    StateVector(StateVector&&) noexcept = default;
+    StateVector& operator=(StateVector&&) noexcept = default;
+#endif
     virtual ~StateVector();
 
     StateVector(double aT);
@@ -42,19 +42,36 @@
 #include "StateVector.h"
 #include "TableUtilities.h"
 #include "TimeSeriesTable.h"
+#include <algorithm>
 #include <iostream>
 
 using namespace OpenSim;
 using namespace std;
 
+namespace {
+    /// The index of the first row in [aBegin, aEnd) whose time is greater
+    /// than aT (or aEnd if there is none), assuming that the times are
+    /// nondecreasing.
+    int findFirstRowAfter(const Array<StateVector>& rows, int aBegin,
+            int aEnd, double aT) {
+        const StateVector* first = rows.get();
+        return (int)(std::upper_bound(first + aBegin, first + aEnd, aT,
+                             [](double t, const StateVector& row) {
+                                 return t < row.getTime();
+                             }) -
+                     first);
+    }
+}
+
 void convertTableToStorage(const AbstractDataTable* table, Storage& sto)
 {
     sto.purge();
     TimeSeriesTable out;
+    const TimeSeriesTable* flat = &out;
 
     if (auto td = dynamic_cast<const TimeSeriesTable*>(table))
-        // Table is already flattened, so clone for further processing
-        out = TimeSeriesTable{ *td };
+        // Table is already flattened, so read it directly.
+        flat = td;
     else if (auto tst = dynamic_cast<const TimeSeriesTable_<SimTK::Vec2>*>(table))
         out = tst->flatten();
     else if (auto tst = dynamic_cast<const TimeSeriesTable_<SimTK::Vec3>*>(table))
@@ -87,18 +104,25 @@ void convertTableToStorage(const AbstractDataTable* table, Storage& sto)
         OPENSIM_THROW( STODataTypeNotSupported, typeid(table).name());
     }
 
-    OpenSim::Array<std::string> labels("", (int)out.getNumColumns() + 1);
+    const int numColumns = (int)flat->getNumColumns();
+    OpenSim::Array<std::string> labels("", numColumns + 1);
     labels[0] = "time";
-    for (int i = 0; i < (int)out.getNumColumns(); ++i) {
-        labels[i + 1] = out.getColumnLabel(i);
+    for (int i = 0; i < numColumns; ++i) {
+        labels[i + 1] = flat->getColumnLabel(i);
     }
     sto.setColumnLabels(labels);
 
-    const auto& times = out.getIndependentColumn();
-    for (unsigned i_time = 0; i_time < out.getNumRows(); ++i_time) {
-        const SimTK::Vector rowVector =
-            out.getRowAtIndex(i_time).transpose().getAsVector();
-        sto.append(times[i_time], rowVector);
+    // Each row is copied once, directly from the table's matrix, and then
+    // moved into the Storage.
+    const auto& times = flat->getIndependentColumn();
+    const auto& matrix = flat->getMatrix();
+    sto.ensureCapacity((int)flat->getNumRows());
+    for (int i_time = 0; i_time < (int)flat->getNumRows(); ++i_time) {
+        StateVector row(times[i_time]);
+        Array<double>& data = row.getData();
+        data.setSize(numColumns);
+        for (int j = 0; j < numColumns; ++j) data[j] = matrix(i_time, j);
+        sto.append(std::move(row));
     }
 }
 
@@ -307,6 +331,28 @@ Storage::Storage(const string &fileName, bool readHeadersOnly) :
     }
 }
 //_____________________________________________________________________________
+/**
+ * Construct a Storage from a TimeSeriesTable.
+ */
+Storage::Storage(const TimeSeriesTable& table) :
+    StorageInterface(""),
+    _storage(StateVector())
+{
+    setNull();
+    _fileVersion = Storage::LatestVersion;
+    convertTableToStorage(&table, *this);
+
+    if (table.hasTableMetaDataKey("header")) {
+        setName(table.getTableMetaDataAsString("header"));
+    }
+    if (table.hasTableMetaDataKey("inDegrees")) {
+        setInDegrees(table.getTableMetaDataAsString("inDegrees") == "yes");
+    }
+    if (table.hasTableMetaDataKey("description")) {
+        setDescription(table.getTableMetaDataAsString("description"));
+    }
+}
+//_____________________________________________________________________________
 /**
  * Copy constructor.
  */
@@ -1135,9 +1181,9 @@ getDataColumn(int aStateIndex,double *&rData) const
     // ASSIGNMENT
     int i,nData;
     for(i=nData=0;i<n;i++) {
-        StateVector *vec = getStateVector(i);
-        if(vec==NULL) continue;
-        if(vec->getDataValue(aStateIndex,rData[nData])) nData++;
+        const Array<double>& data = _storage[i].getData();
+        if(aStateIndex<0 || aStateIndex>=data.getSize()) continue;
+        rData[nData++] = data[aStateIndex];
     }
 
     return(nData);
@@ -1153,9 +1199,9 @@ getDataColumn(int aStateIndex,Array<double> &rData) const
     // ASSIGNMENT
     int i,nData;
     for(i=nData=0;i<n;i++) {
-        StateVector *vec = getStateVector(i);
-        if(vec==NULL) continue;
-        if(vec->getDataValue(aStateIndex,rData[nData])) nData++;
+        const Array<double>& data = _storage[i].getData();
+        if(aStateIndex<0 || aStateIndex>=data.getSize()) continue;
+        rData[nData++] = data[aStateIndex];
     }
 
     rData.setSize(nData);
@@ -1300,6 +1346,28 @@ Storage::getColumnIndicesForIdentifier(const std::string& identifier) const
 TimeSeriesTable Storage::exportToTable() const {
     TimeSeriesTable table{};
 
+    // If all rows have one value per column label, fill a matrix in a single
+    // pass instead of appending (and reallocating the table) row by row.
+    const int numRows = _storage.getSize();
+    const int numColumns = _columnLabels.getSize() - 1;
+    bool uniform = numColumns > 0;
+    for (int i = 0; uniform && i < numRows; ++i) {
+        uniform = _storage[i].getSize() == numColumns;
+    }
+    if (uniform) {
+        std::vector<double> times(numRows);
+        SimTK::Matrix matrix(numRows, numColumns);
+        for (int i = 0; i < numRows; ++i) {
+            times[i] = _storage[i].getTime();
+            const double* row = _storage[i].getData().get();
+            for (int j = 0; j < numColumns; ++j) matrix(i, j) = row[j];
+        }
+        // Exclude the first column label. It is 'time'.
+        table = TimeSeriesTable(times, matrix,
+                std::vector<std::string>(_columnLabels.get() + 1,
+                        _columnLabels.get() + _columnLabels.getSize()));
+    }
+
     table.addTableMetaData("header", getName());
     table.addTableMetaData("inDegrees", std::string{_inDegrees ? "yes" : "no"});
     table.addTableMetaData("nRows", std::to_string(_storage.getSize()));
@@ -1307,6 +1375,8 @@ TimeSeriesTable Storage::exportToTable() const {
     if(!getDescription().empty())
         table.addTableMetaData("description", getDescription());
 
+    if (uniform) return table;
+
     // Exclude the first column label. It is 'time'. Time is a separate column
     // in TimeSeriesTable and column label is optional.
     if (_columnLabels.size() > 1) {
@@ -1391,7 +1461,7 @@ crop(const double newStartTime, const double newFinalTime)
     }
     if (startindex!=0){
         for(int i=0; i<finalindex-startindex+1; i++)
-            _storage[i]=_storage[startindex+i];
+            _storage[i]=std::move(_storage[startindex+i]);
     }
     _storage.setSize(numRowsToKeep);
 }
@@ -1422,6 +1492,27 @@ append(const StateVector &aStateVector,bool aCheckForDuplicateTime)
     return(_storage.getSize());
 }
 //_____________________________________________________________________________
+/**
+ * Append an StateVector, moving its data into the storage.
+ *
+ * @param aStateVector Statevector to be appended.
+ * @return Size of the storage after the append.
+ */
+int Storage::
+append(StateVector &&aStateVector,bool aCheckForDuplicateTime)
+{
+    if (_fp!=0){
+        aStateVector.print(_fp);
+        fflush(_fp);
+    }
+    if(aCheckForDuplicateTime && _storage.getSize() && _storage.getLast().getTime()==aStateVector.getTime())
+        _storage.updLast() = std::move(aStateVector);
+    else
+        _storage.append(std::move(aStateVector));
+
+    return(_storage.getSize());
+}
+//_____________________________________________________________________________
 /**
  * Append copies of all state vectors in an Storage object.
  *
@@ -1434,6 +1525,7 @@ append(const StateVector &aStateVector,bool aCheckForDuplicateTime)
 int Storage::
 append(const Array<StateVector> &aStorage)
 {
+    _storage.ensureCapacity(_storage.getSize() + aStorage.getSize());
     for(int i=0; i<aStorage.getSize(); i++)
         _storage.append(aStorage[i]);
     return(_storage.getSize());
@@ -1454,8 +1546,9 @@ append(double aT,int aN,const double *aY,bool aCheckForDuplicateTime)
     if(aN<0) return(_storage.getSize());
 
     // APPEND
-    StateVector vec(aT, SimTK::Vector_<double>(aN, aY));
-    append(vec,aCheckForDuplicateTime);
+    StateVector vec(aT);
+    vec.getData().append(aN, aY);
+    append(std::move(vec),aCheckForDuplicateTime);
     // TODO: use some tolerance when checking for duplicate time?
     /*
     if(aCheckForDuplicateTime && _storage.getSize() && _storage.getLast().getTime()==vec.getTime())
@@ -2462,11 +2555,13 @@ findIndex(int aI,double aT) const
     if(getStateVector(aI)->getTime()>aT) aI=0;
 
     // SEARCH
-    //cout << "Storage.findIndex: starting at " << aI << endl;
-    int i;
-    for(i=aI;i<_storage.getSize();i++) {
-        if(aT<getStateVector(i)->getTime()) break;
-    }
+    // Check the rows just after aI first, since consecutive lookups are
+    // usually close together, and then bisect the remaining rows.
+    const int n = _storage.getSize();
+    int i = aI;
+    const int linearEnd = std::min(aI + 8, n);
+    while(i<linearEnd && !(aT<_storage[i].getTime())) i++;
+    if(i==linearEnd && i<n) i = findFirstRowAfter(_storage, i, n, aT);
     _lastI = i-1;
     if(_lastI<0) _lastI=0;
     return(_lastI);
@@ -2476,8 +2571,8 @@ findIndex(int aI,double aT) const
  * Find the index of the storage element that occurred immediately before
  * or at a specified time ( getTime(index) <= aT ).
  *
- * This method is not very efficient because it always starts its search
- * with the first stored state.
+ * The search bisects all stored states; if consecutive searches are for
+ * nearby times, findIndex(int,double) is more efficient.
  *
  * @param aT Time.
  * @return Index preceding or at time aT.  If aT is less than the earliest
@@ -2487,10 +2582,7 @@ int Storage::
 findIndex(double aT) const
 {
     if(_storage.getSize()<=0) return(-1);
-    int i;
-    for(i=0;i<_storage.getSize();i++) {
-        if(aT<getStateVector(i)->getTime()) break;
-    }
+    int i = findFirstRowAfter(_storage, 0, _storage.getSize(), aT);
     _lastI = i-1;
     if(_lastI<0) _lastI=0;
     return(_lastI);
@@ -2540,7 +2632,9 @@ resample(double aDT, int aDegree)
     // For every column, collect data and fit spline to originalTimes, dataColumn.
     Storage *newStorage = splineSet->constructStorage(0,aDT);
     newStorage->setInDegrees(isInDegrees());
-    copyData(*newStorage);
+    // Take the resampled rows instead of copying them.
+    _units = newStorage->_units;
+    _storage = std::move(newStorage->_storage);
 
     setColumnLabels(saveLabels);
 
@@ -2590,7 +2684,10 @@ resampleLinear(double aDT)
         newStorage->append(t,ny,y);
     }
 
-    copyData(*newStorage);
+    // Take the resampled rows instead of copying them.
+    _units = newStorage->_units;
+    setInDegrees(newStorage->isInDegrees());
+    _storage = std::move(newStorage->_storage);
 
     delete newStorage;
     delete[] y;
@@ -128,6 +128,11 @@ public:
     Please use FileAdapter (STOFileAdpater, C3DFileAdapter, ...) and TimeSeriesTable
     instead, whenever possible. */
     Storage(const std::string &aFileName, bool readHeadersOnly=false) SWIG_DECLARE_EXCEPTION;
+    /** Create a Storage with the same column labels and data as a
+    TimeSeriesTable. The "header" and "inDegrees" metadata written by
+    exportToTable() are used for the name and isInDegrees(), so
+    `Storage(sto.exportToTable())` reproduces the original Storage. */
+    explicit Storage(const TimeSeriesTable& table);
     Storage(const Storage &aStorage,bool aCopyData=true);
     Storage(const Storage &aStorage,int aStateIndex,int aN,
         const char *aDelimiter="\t");
@@ -231,6 +236,11 @@ public:
     void setStepInterval(int aStepInterval);
     int getStepInterval() const;
 
+    // CAPACITY
+    /** Reserve memory for at least aCapacity rows, so that appending up to
+    that many rows does not reallocate the stored rows. */
+    void ensureCapacity(int aCapacity) { _storage.ensureCapacity(aCapacity); }
+
     // CAPACITY INCREMENT
     [[deprecated("this no longer does anything")]]
     void setCapacityIncrement(int) {}
@@ -267,6 +277,10 @@ public:
     // STORAGE
     //--------------------------------------------------------------------------
     int append(const StateVector &aVec, bool aCheckForDuplicateTime=true) override;
+#ifndef SWIG
+    /** Append a StateVector by moving its data instead of copying it. */
+    int append(StateVector &&aVec, bool aCheckForDuplicateTime=true);
+#endif
     int append(const Array<StateVector> &aArray) override;
     int append(double aT,int aN,const double *aY, bool aCheckForDuplicateTime=true) override;
     int append(double aT,const SimTK::Vector& aY, bool aCheckForDuplicateTime=true) override;
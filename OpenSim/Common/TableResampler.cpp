@@ -0,0 +1,382 @@
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  TableResampler.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "TableResampler.h"
+
+#include "Signal.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+using namespace OpenSim;
+
+namespace {
+// Tables are only divided among threads if each thread computes at least
+// this many samples.
+constexpr long long minSamplesPerThread = 1 << 16;
+
+// The monomial coefficients (of 1, x, ..., x^5) of the quintic Hermite basis
+// functions on [0, 1] for the value, first derivative, and second derivative
+// at x = 0, followed by those at x = 1.
+constexpr double quinticHermiteBasis[6][6] = {
+        {1, 0, 0, -10, 15, -6},
+        {0, 1, 0, -6, 8, -3},
+        {0, 0, 0.5, -1.5, 1.5, -0.5},
+        {0, 0, 0, 10, -15, 6},
+        {0, 0, 0, -4, 7, -3},
+        {0, 0, 0, 0.5, -1, 0.5}};
+// The integral over [0, 1] of the product of the third derivatives of each
+// pair of the basis functions above.
+constexpr double quinticHermiteStiffness[6][6] = {
+        {720, 360, 60, -720, 360, -60},
+        {360, 192, 36, -360, 168, -24},
+        {60, 36, 9, -60, 24, -3},
+        {-720, -360, -60, 720, -360, 60},
+        {360, 168, 24, -360, 192, -36},
+        {-60, -24, -3, 60, -36, 9}};
+// The half-bandwidth of the quintic spline system, whose unknowns are the
+// first and second derivatives at each time (interleaved).
+constexpr int quinticHalfBandwidth = 3;
+
+double evalQuinticHermiteBasis(int j, double x) {
+    const double* c = quinticHermiteBasis[j];
+    return c[0] + x * (c[1] + x * (c[2] + x * (c[3] + x * (c[4] + x * c[5]))));
+}
+}
+
+TableResampler::TableResampler(std::vector<double> time,
+        std::vector<double> newTime, Kernel kernel, int sincHalfWidth)
+        : m_time(std::move(time)), m_newTime(std::move(newTime)),
+          m_kernel(kernel) {
+    const int n = (int)m_time.size();
+    OPENSIM_THROW_IF(n < 2, Exception,
+            "Cannot resample if number of times is 0 or 1.");
+    for (int i = 1; i < n; ++i) {
+        OPENSIM_THROW_IF(m_time[i] <= m_time[i - 1], Exception,
+                "Expected times to be increasing, but time[{}] <= time[{}] "
+                "({} <= {}).",
+                i, i - 1, m_time[i], m_time[i - 1]);
+    }
+    if (!m_newTime.empty()) {
+        OPENSIM_THROW_IF(m_newTime.front() < m_time.front(), Exception,
+                "New initial time ({}) cannot be less than existing initial "
+                "time ({})",
+                m_newTime.front(), m_time.front());
+        OPENSIM_THROW_IF(m_newTime.back() > m_time.back(), Exception,
+                "New final time ({}) cannot be greater than existing final "
+                "time ({})",
+                m_newTime.back(), m_time.back());
+    }
+    for (int i = 1; i < (int)m_newTime.size(); ++i) {
+        OPENSIM_THROW_IF(m_newTime[i] < m_newTime[i - 1], Exception,
+                "New times must be non-decreasing, but "
+                "time[{}] < time[{}] ({} < {}).",
+                i, i - 1, m_newTime[i], m_newTime[i - 1]);
+    }
+
+    const int numNewRows = (int)m_newTime.size();
+    m_rowStart.reserve(numNewRows + 1);
+    m_rowStart.push_back(0);
+
+    if (kernel == Kernel::WindowedSinc) {
+        OPENSIM_THROW_IF(sincHalfWidth < 1, Exception,
+                "Expected sincHalfWidth to be positive, but got {}.",
+                sincHalfWidth);
+        const double dt = (m_time.back() - m_time.front()) / (n - 1);
+        for (int i = 1; i < n; ++i) {
+            OPENSIM_THROW_IF(
+                    std::abs(m_time[i] - m_time[i - 1] - dt) > 1e-6 * dt,
+                    Exception,
+                    "The WindowedSinc kernel requires uniformly spaced "
+                    "times, but the interval between time[{}] and time[{}] "
+                    "is {} (expected {}).",
+                    i - 1, i, m_time[i] - m_time[i - 1], dt);
+        }
+        const int a = sincHalfWidth;
+        m_indices.reserve((size_t)numNewRows * 2 * a);
+        m_weights.reserve((size_t)numNewRows * 2 * a);
+        for (const double t : m_newTime) {
+            const double u = (t - m_time.front()) / dt;
+            const int j0 = std::min((int)std::floor(u), n - 1);
+            const int begin = (int)m_weights.size();
+            double sum = 0;
+            for (int j = std::max(j0 - a + 1, 0);
+                    j <= std::min(j0 + a, n - 1); ++j) {
+                const double x = SimTK_PI * (u - j);
+                const double weight = Signal::sinc(x) * Signal::sinc(x / a);
+                m_indices.push_back(j);
+                m_weights.push_back(weight);
+                sum += weight;
+            }
+            for (int k = begin; k < (int)m_weights.size(); ++k) {
+                m_weights[k] /= sum;
+            }
+            m_rowStart.push_back((int)m_weights.size());
+        }
+        return;
+    }
+
+    // QuinticSpline uses the same degree as GCVSplineSet(table, {},
+    // min(n - 1, 5)), which GCVSpline reduces to an odd degree; with fewer
+    // than 6 times, it is the same as the Linear or NaturalCubic kernel.
+    if (kernel == Kernel::Linear) {
+        m_degree = 1;
+    } else if (kernel == Kernel::NaturalCubic) {
+        m_degree = 3;
+    } else {
+        m_degree = 2 * ((std::min(n - 1, 5) + 1) / 2) - 1;
+    }
+
+    const int numWeightsPerRow = m_degree + 1;
+    m_indices.reserve((size_t)numNewRows * numWeightsPerRow);
+    m_weights.reserve((size_t)numNewRows * numWeightsPerRow);
+    // The new times are sorted, so the interval containing each new time is
+    // at or after the interval containing the previous new time.
+    int k = 0;
+    for (const double t : m_newTime) {
+        while (k < n - 2 && t > m_time[k + 1]) ++k;
+        const double h = m_time[k + 1] - m_time[k];
+        const double A = (m_time[k + 1] - t) / h;
+        const double B = (t - m_time[k]) / h;
+        if (m_degree == 5) {
+            // The derivatives are scaled by the length of the interval.
+            const double scale[6] = {1, h, h * h, 1, h, h * h};
+            const int index[6] = {k, n + 2 * k, n + 2 * k + 1, k + 1,
+                    n + 2 * k + 2, n + 2 * k + 3};
+            for (int j = 0; j < 6; ++j) {
+                m_indices.push_back(index[j]);
+                m_weights.push_back(scale[j] * evalQuinticHermiteBasis(j, B));
+            }
+        } else {
+            m_indices.push_back(k);
+            m_weights.push_back(A);
+            m_indices.push_back(k + 1);
+            m_weights.push_back(B);
+        }
+        if (m_degree == 3) {
+            m_indices.push_back(n + k);
+            m_weights.push_back((A * A * A - A) * h * h / 6.0);
+            m_indices.push_back(n + k + 1);
+            m_weights.push_back((B * B * B - B) * h * h / 6.0);
+        }
+        m_rowStart.push_back((int)m_weights.size());
+    }
+
+    if (m_degree == 3 && n > 2) {
+        // Row r of the tridiagonal system is for the second derivative at
+        // time r + 1:
+        // h[r] M[r] + 2 (h[r] + h[r + 1]) M[r + 1] + h[r + 1] M[r + 2] = ...
+        const int m = n - 2;
+        m_splineLower.resize(m);
+        m_splineUpper.resize(m);
+        m_splinePivotInverse.resize(m);
+        for (int r = 0; r < m; ++r) {
+            const double hPrev = m_time[r + 1] - m_time[r];
+            const double hNext = m_time[r + 2] - m_time[r + 1];
+            const double diagonal = 2 * (hPrev + hNext);
+            const double pivot = r == 0 ? diagonal
+                                        : diagonal - hPrev * m_splineUpper[r - 1];
+            m_splineLower[r] = hPrev;
+            m_splinePivotInverse[r] = 1.0 / pivot;
+            m_splineUpper[r] = hNext / pivot;
+        }
+    }
+
+    if (m_degree == 5) {
+        // The interpolating natural quintic spline minimizes the integral of
+        // its squared third derivative, so its first and second derivatives
+        // at the times minimize the sum of this integral over the quintic
+        // Hermite interpolants on each interval. The minimum solves a
+        // symmetric positive-definite banded system, whose Cholesky factor is
+        // computed here; the right-hand side is a combination of the samples
+        // at the previous, same, and next times.
+        const int w = quinticHalfBandwidth;
+        const int size = 2 * n;
+        m_quinticFactor.assign((size_t)size * (w + 1), 0.0);
+        m_quinticRhs.assign((size_t)size * 3, 0.0);
+        for (int interval = 0; interval < n - 1; ++interval) {
+            const int first = interval;
+            const int last = interval + 1;
+            const double h = m_time[last] - m_time[first];
+            const double scale[6] = {1, h, h * h, 1, h, h * h};
+            const double h5 = h * h * h * h * h;
+            // The unknown for each basis function, or -1 for the samples.
+            const int unknown[6] = {-1, 2 * first, 2 * first + 1, -1,
+                    2 * last, 2 * last + 1};
+            const int sample[6] = {first, -1, -1, last, -1, -1};
+            for (int i = 0; i < 6; ++i) {
+                const int r = unknown[i];
+                if (r < 0) continue;
+                for (int j = 0; j < 6; ++j) {
+                    const double value = quinticHermiteStiffness[i][j] *
+                            scale[i] * scale[j] / h5;
+                    if (unknown[j] < 0) {
+                        m_quinticRhs[3 * r + sample[j] - r / 2 + 1] -= value;
+                    } else if (unknown[j] <= r) {
+                        m_quinticFactor[r * (w + 1) + r - unknown[j]] +=
+                                value;
+                    }
+                }
+            }
+        }
+        // Element (r, c) of the factor, for r - w <= c <= r, is stored at
+        // m_quinticFactor[r * (w + 1) + r - c].
+        const auto L = [&](int r, int c) -> double& {
+            return m_quinticFactor[r * (w + 1) + r - c];
+        };
+        for (int r = 0; r < size; ++r) {
+            for (int c = std::max(0, r - w); c <= r; ++c) {
+                double sum = L(r, c);
+                for (int j = std::max(0, r - w); j < c; ++j) {
+                    sum -= L(r, j) * L(c, j);
+                }
+                L(r, c) = r == c ? std::sqrt(sum) : sum / L(c, c);
+            }
+        }
+    }
+}
+
+TableResampler TableResampler::createWithInterval(std::vector<double> time,
+        double interval, Kernel kernel, int sincHalfWidth) {
+    OPENSIM_THROW_IF(interval <= 0, Exception,
+            "Expected the interval to be positive, but got {}.", interval);
+    OPENSIM_THROW_IF(time.empty(), Exception,
+            "Cannot resample if number of times is 0 or 1.");
+    std::vector<double> newTime;
+    double t = time.front();
+    while (t <= time.back()) {
+        newTime.push_back(t);
+        t += interval;
+    }
+    return TableResampler(
+            std::move(time), std::move(newTime), kernel, sincHalfWidth);
+}
+
+void TableResampler::calcSplineSecondDerivatives(
+        const double* y, double* M) const {
+    const int n = (int)m_time.size();
+    M[0] = 0;
+    M[n - 1] = 0;
+    const int m = n - 2;
+    // Forward elimination.
+    for (int r = 0; r < m; ++r) {
+        const double hPrev = m_time[r + 1] - m_time[r];
+        const double hNext = m_time[r + 2] - m_time[r + 1];
+        const double rhs = 6.0 * ((y[r + 2] - y[r + 1]) / hNext -
+                                         (y[r + 1] - y[r]) / hPrev);
+        M[r + 1] = r == 0 ? rhs * m_splinePivotInverse[r]
+                          : (rhs - m_splineLower[r] * M[r]) *
+                                    m_splinePivotInverse[r];
+    }
+    // Back substitution.
+    for (int r = m - 2; r >= 0; --r) {
+        M[r + 1] -= m_splineUpper[r] * M[r + 2];
+    }
+}
+
+void TableResampler::calcQuinticSplineDerivatives(
+        const double* y, double* u) const {
+    const int n = (int)m_time.size();
+    const int w = quinticHalfBandwidth;
+    const int size = 2 * n;
+    const auto L = [&](int r, int c) {
+        return m_quinticFactor[r * (w + 1) + r - c];
+    };
+    // Forward substitution.
+    for (int r = 0; r < size; ++r) {
+        const int i = r / 2;
+        double value = m_quinticRhs[3 * r + 1] * y[i];
+        if (i > 0) value += m_quinticRhs[3 * r] * y[i - 1];
+        if (i < n - 1) value += m_quinticRhs[3 * r + 2] * y[i + 1];
+        for (int c = std::max(0, r - w); c < r; ++c) value -= L(r, c) * u[c];
+        u[r] = value / L(r, r);
+    }
+    // Back substitution.
+    for (int r = size - 1; r >= 0; --r) {
+        double value = u[r];
+        for (int c = r + 1; c <= std::min(size - 1, r + w); ++c) {
+            value -= L(c, r) * u[c];
+        }
+        u[r] = value / L(r, r);
+    }
+}
+
+SimTK::Matrix TableResampler::resample(
+        const SimTK::MatrixBase<double>& data) const {
+    const int n = (int)m_time.size();
+    OPENSIM_THROW_IF(data.nrow() != n, Exception,
+            "Expected the data to have {} rows, but it has {} rows.", n,
+            data.nrow());
+    const int numColumns = data.ncol();
+    const int numNewRows = (int)m_newTime.size();
+    SimTK::Matrix result(numNewRows, numColumns);
+
+    const auto resampleColumns = [&](int thread, int numThreads) {
+        // The column, followed by the spline's derivatives (if any).
+        std::vector<double> source(
+                m_degree <= 1 ? n : n * (m_degree + 1) / 2);
+        for (int icol = thread; icol < numColumns; icol += numThreads) {
+            const auto column = data.col(icol);
+            for (int i = 0; i < n; ++i) source[i] = column[i];
+            if (m_degree == 3) {
+                calcSplineSecondDerivatives(source.data(), source.data() + n);
+            } else if (m_degree == 5) {
+                calcQuinticSplineDerivatives(
+                        source.data(), source.data() + n);
+            }
+            double* out = result.updCol(icol).updContiguousScalarData();
+            for (int i = 0; i < numNewRows; ++i) {
+                double value = 0;
+                for (int k = m_rowStart[i]; k < m_rowStart[i + 1]; ++k) {
+                    value += m_weights[k] * source[m_indices[k]];
+                }
+                out[i] = value;
+            }
+        }
+    };
+
+    const int numThreads = (int)std::max(1LL,
+            std::min({(long long)std::thread::hardware_concurrency(),
+                    (long long)numColumns,
+                    (long long)numNewRows * numColumns /
+                            minSamplesPerThread}));
+    std::vector<std::thread> threads;
+    for (int thread = 1; thread < numThreads; ++thread) {
+        threads.emplace_back(resampleColumns, thread, numThreads);
+    }
+    resampleColumns(0, numThreads);
+    for (auto& thread : threads) thread.join();
+    return result;
+}
+
+TimeSeriesTable TableResampler::resample(const TimeSeriesTable& table) const {
+    OPENSIM_THROW_IF(table.getIndependentColumn() != m_time, Exception,
+            "Expected the table to have the times given to the "
+            "TableResampler.");
+    TimeSeriesTable out(
+            m_newTime, resample(table.getMatrix()), table.getColumnLabels());
+    out.updTableMetaData() = table.getTableMetaData();
+    out.setIndependentMetaData(table.getIndependentMetaData());
+    out.setDependentsMetaData(table.getDependentsMetaData());
+    return out;
+}
@@ -0,0 +1,140 @@
+#ifndef OPENSIM_TABLERESAMPLER_H_
+#define OPENSIM_TABLERESAMPLER_H_
+/* -------------------------------------------------------------------------- *
+ *                          OpenSim:  TableResampler.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "TimeSeriesTable.h"
+#include "osimCommonDLL.h"
+
+#include <vector>
+
+namespace OpenSim {
+
+/** Resample (interpolate) the columns of tables from one set of times to
+another. The interpolation weights depend only on the original and new times,
+so they are computed once, when the resampler is constructed. Each table is
+then resampled by applying the weights to all of its columns (as a sparse
+matrix product), dividing the columns among threads for large tables. Use this
+class instead of TableUtilities::resample() to resample tables with many
+columns, or many tables with the same times (e.g., marker and EMG data from
+the same trial).
+
+The following kernels are available:
+- **Linear**: linear interpolation between the neighboring samples (the same
+  as PiecewiseLinearFunction).
+- **NaturalCubic**: a cubic spline through the samples whose second derivative
+  is zero at the first and last times. The spline for each column requires
+  solving a tridiagonal system; the factorization of this system is computed
+  once.
+- **WindowedSinc**: band-limited interpolation with a sinc kernel and a
+  Lanczos window that spans `2 * sincHalfWidth` samples. This kernel requires
+  that the original times are uniformly spaced. The weights for each new time
+  are normalized to sum to 1, including near the first and last times, where
+  fewer samples are available.
+- **QuinticSpline**: the interpolating quintic spline that GCVSpline fits
+  with an error variance of 0 (of lower degree if there are fewer than 6
+  original times). This is the natural quintic spline through the samples,
+  whose first and second derivatives at the original times solve a banded
+  linear system; as for NaturalCubic, the factorization of this system is
+  computed once. Use this kernel to reproduce the resampling done with
+  GCVSplineSet (e.g., by MocoTrajectory).
+
+@code
+TableResampler resampler(emg.getIndependentColumn(), newTimes,
+        TableResampler::Kernel::WindowedSinc);
+TimeSeriesTable emgResampled = resampler.resample(emg);
+@endcode */
+class OSIMCOMMON_API TableResampler {
+public:
+    enum class Kernel { Linear, NaturalCubic, WindowedSinc, QuinticSpline };
+
+    /// The new times must be non-decreasing and within the range of the
+    /// original times, which must be increasing.
+    /// @throws Exception if the times do not satisfy these conditions, if
+    /// there are fewer than 2 original times, or if the kernel is
+    /// WindowedSinc and the original times are not uniformly spaced.
+    TableResampler(std::vector<double> time, std::vector<double> newTime,
+            Kernel kernel = Kernel::Linear, int sincHalfWidth = 8);
+
+    /// Resample at the given interval, starting at the first original time.
+    /// As with TableUtilities::resampleWithInterval(), the new final time is
+    /// not guaranteed to match the original final time.
+    static TableResampler createWithInterval(std::vector<double> time,
+            double interval, Kernel kernel = Kernel::Linear,
+            int sincHalfWidth = 8);
+
+    const std::vector<double>& getTime() const { return m_time; }
+    const std::vector<double>& getNewTime() const { return m_newTime; }
+    Kernel getKernel() const { return m_kernel; }
+
+    /// Resample a table whose independent column is getTime(). The
+    /// resampled table has the same column labels and metadata.
+    /// @throws Exception if the table's times differ from getTime().
+    TimeSeriesTable resample(const TimeSeriesTable& table) const;
+
+    /// Resample each column of a matrix whose rows correspond to getTime().
+    /// The result has a row for each of getNewTime().
+    SimTK::Matrix resample(const SimTK::MatrixBase<double>& data) const;
+
+private:
+    // Evaluate the second derivatives of the natural cubic spline through the
+    // column y (with getTime().size() samples).
+    void calcSplineSecondDerivatives(const double* y, double* M) const;
+    // Evaluate the first and second derivatives (interleaved) of the natural
+    // quintic spline through the column y at the original times.
+    void calcQuinticSplineDerivatives(const double* y, double* u) const;
+
+    std::vector<double> m_time;
+    std::vector<double> m_newTime;
+    Kernel m_kernel;
+    // The degree of the Linear, NaturalCubic, or QuinticSpline spline (1, 3,
+    // or 5); 0 for the WindowedSinc kernel.
+    int m_degree = 0;
+
+    // The weights as a sparse matrix in compressed row storage: new row i is
+    // the sum of m_weights[k] * source[m_indices[k]] for k from m_rowStart[i]
+    // to m_rowStart[i + 1]. For a spline of degree 3, source is the column
+    // followed by the spline's second derivatives at the original times; for
+    // degree 5, it is followed by the first and second derivatives
+    // (interleaved).
+    std::vector<int> m_rowStart;
+    std::vector<int> m_indices;
+    std::vector<double> m_weights;
+
+    // The factorization of the tridiagonal system for the second derivatives
+    // of the natural cubic spline at the interior times (Thomas algorithm).
+    std::vector<double> m_splineLower;
+    std::vector<double> m_splineUpper;
+    std::vector<double> m_splinePivotInverse;
+
+    // The Cholesky factor of the symmetric banded system for the derivatives
+    // of the quintic spline (2 unknowns per time), with the 4 elements of
+    // row r on and left of the diagonal at [4 * r + r - c] for column c, and
+    // the coefficients of the samples at the previous, same, and next times
+    // in the right-hand side of row r at [3 * r + 0, 1, 2].
+    std::vector<double> m_quinticFactor;
+    std::vector<double> m_quinticRhs;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_TABLERESAMPLER_H_
@@ -29,6 +29,10 @@
 #include "PiecewiseLinearFunction.h"
 #include "Signal.h"
 #include "Storage.h"
+#include "TableResampler.h"
+
+#include <algorithm>
+#include <thread>
 
 using namespace OpenSim;
 
@@ -119,19 +123,204 @@ int TableUtilities::findStateLabelIndexInternal(const std::string* begin,
     return -1;
 }
 
-void TableUtilities::filterLowpass(
-        TimeSeriesTable& table, double cutoffFreq, bool padData) {
-    OPENSIM_THROW_IF(cutoffFreq < 0, Exception,
-            "Cutoff frequency must be non-negative; got {}.", cutoffFreq);
+namespace {
+// The filters below process the columns of a table in blocks. Within a block,
+// the samples of the columns are interleaved so that the inner loops of the
+// filters run across the columns of the block and can be vectorized. Each
+// column is filtered exactly as by the corresponding function in Signal.
+constexpr int filterBlockSize = 8;
+
+// Tables are only divided among threads if each thread filters at least this
+// many samples.
+constexpr long long minSamplesPerThread = 1 << 16;
+
+// Call filterBlock(firstColumn, numColumnsInBlock, buffer) for each block of
+// columns. The buffer holds bufferRows interleaved rows for the block. The
+// blocks are divided among threads for large tables.
+template <typename FilterBlock>
+void forEachColumnBlock(int numRows, int numColumns, int bufferRows,
+        const FilterBlock& filterBlock) {
+    const int numBlocks = (numColumns + filterBlockSize - 1) / filterBlockSize;
+    const int numThreads = (int)std::max(1LL,
+            std::min({(long long)std::thread::hardware_concurrency(),
+                    (long long)numBlocks,
+                    (long long)numRows * numColumns / minSamplesPerThread}));
+    const auto filterBlocks = [&](int thread) {
+        std::vector<double> buffer((size_t)bufferRows * filterBlockSize);
+        for (int iblock = thread; iblock < numBlocks; iblock += numThreads) {
+            const int first = iblock * filterBlockSize;
+            filterBlock(first, std::min(filterBlockSize, numColumns - first),
+                    buffer.data());
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int thread = 1; thread < numThreads; ++thread) {
+        threads.emplace_back(filterBlocks, thread);
+    }
+    filterBlocks(0);
+    for (auto& thread : threads) thread.join();
+}
 
-    if (padData) { pad(table, (int)table.getNumRows() / 2); }
+// Copy the columns [first, first + width) into the interleaved buffer, with
+// numPad reflected rows before and after the data. As in Signal::Pad(), the
+// reflected rows are negated about the first and last values if negate is
+// true. Unused columns of the block are set to zero.
+void gatherBlock(const std::vector<const double*>& columns, int numRows,
+        int first, int width, int numPad, bool negate, double* buffer) {
+    const int B = filterBlockSize;
+    for (int c = 0; c < width; ++c) {
+        const double* x = columns[first + c];
+        double* s = buffer + c;
+        for (int i = 0; i < numPad; ++i) {
+            const double reflected = x[numPad - i];
+            s[i * B] = negate ? 2.0 * x[0] - reflected : reflected;
+        }
+        for (int i = 0; i < numRows; ++i) s[(numPad + i) * B] = x[i];
+        s += (numPad + numRows) * B;
+        for (int i = 0; i < numPad; ++i) {
+            const double reflected = x[numRows - 2 - i];
+            s[i * B] = negate ? 2.0 * x[numRows - 1] - reflected : reflected;
+        }
+    }
+    for (int i = 0; i < numRows + 2 * numPad; ++i) {
+        for (int c = width; c < B; ++c) buffer[i * B + c] = 0;
+    }
+}
 
-    const int numRows = (int)table.getNumRows();
-    OPENSIM_THROW_IF(numRows < 4, Exception,
-            "Expected at least 4 rows to filter, but got {} rows.", numRows);
+// Copy numRows interleaved rows of the buffer into the columns
+// [first, first + width).
+void scatterBlock(const double* buffer, int numRows, int first, int width,
+        const std::vector<double*>& columns) {
+    const int B = filterBlockSize;
+    for (int c = 0; c < width; ++c) {
+        double* y = columns[first + c];
+        for (int i = 0; i < numRows; ++i) y[i] = buffer[i * B + c];
+    }
+}
 
-    const auto& time = table.getIndependentColumn();
+// The coefficients of the 3rd-order Butterworth filter in Signal::LowpassIIR().
+struct LowpassIIRCoefficients {
+    double a[4];
+    double b[4];
+};
+
+LowpassIIRCoefficients calcLowpassIIRCoefficients(double T, double fc) {
+    const double fs = 1 / T;
+    if (fc >= 0.5 * fs) {
+        fc = 0.49 * fs;
+        log_warn("Cutoff frequency should be less than half sample frequency. "
+                 "Changing the cutoff frequency to 0.49*(Sample Frequency)..."
+                 "cutoff = {}", fc);
+    }
+    const double wc = 2 * SimTK_PI * fc;
+    const double wa = tan(wc * T / 2.0);
+    const double wa2 = wa * wa;
+    const double wa3 = wa * wa * wa;
+    const double denom = (wa + 1) * (wa * wa + wa + 1.0);
+    LowpassIIRCoefficients k;
+    k.a[0] = wa3 / denom;
+    k.a[1] = 3 * wa3 / denom;
+    k.a[2] = 3 * wa3 / denom;
+    k.a[3] = wa3 / denom;
+    k.b[0] = 1;
+    k.b[1] = (3 * wa3 + 2 * wa2 - 2 * wa - 3) / denom;
+    k.b[2] = (3 * wa3 - 2 * wa2 - 2 * wa + 3) / denom;
+    k.b[3] = (wa - 1) * (wa2 - wa + 1) / denom;
+    return k;
+}
+
+// Filter the n interleaved rows of the buffer forward and then backward, in
+// place. As in Signal::LowpassIIR(), the first three samples are not changed
+// by the forward pass, and the last three are not changed by the backward
+// pass.
+void filtfiltBlock(const LowpassIIRCoefficients& k, int n, double* buffer) {
+    const int B = filterBlockSize;
+    const double a0 = k.a[0], a1 = k.a[1], a2 = k.a[2], a3 = k.a[3];
+    const double b1 = k.b[1], b2 = k.b[2], b3 = k.b[3];
+    // The unfiltered samples preceding the current sample.
+    double x1[B], x2[B], x3[B];
+
+    for (int c = 0; c < B; ++c) {
+        x3[c] = buffer[c];
+        x2[c] = buffer[B + c];
+        x1[c] = buffer[2 * B + c];
+    }
+    for (int i = 3; i < n; ++i) {
+        double* y = buffer + i * B;
+        for (int c = 0; c < B; ++c) {
+            const double x = y[c];
+            y[c] = a0 * x + a1 * x1[c] + a2 * x2[c] + a3 * x3[c] -
+                   b1 * y[c - B] - b2 * y[c - 2 * B] - b3 * y[c - 3 * B];
+            x3[c] = x2[c];
+            x2[c] = x1[c];
+            x1[c] = x;
+        }
+    }
+
+    for (int c = 0; c < B; ++c) {
+        x3[c] = buffer[(n - 1) * B + c];
+        x2[c] = buffer[(n - 2) * B + c];
+        x1[c] = buffer[(n - 3) * B + c];
+    }
+    for (int i = n - 4; i >= 0; --i) {
+        double* y = buffer + i * B;
+        for (int c = 0; c < B; ++c) {
+            const double x = y[c];
+            y[c] = a0 * x + a1 * x1[c] + a2 * x2[c] + a3 * x3[c] -
+                   b1 * y[c + B] - b2 * y[c + 2 * B] - b3 * y[c + 3 * B];
+            x3[c] = x2[c];
+            x2[c] = x1[c];
+            x1[c] = x;
+        }
+    }
+}
+
+// The coefficients of the FIR filters in Signal::LowpassFIR() (if lowFreq is
+// 0) and Signal::BandpassFIR(), for k = -M, ..., M.
+std::vector<double> calcFIRCoefficients(
+        int M, double T, double lowFreq, double highFreq) {
+    const double w1 = 2 * SimTK_PI * lowFreq;
+    const double w2 = 2 * SimTK_PI * highFreq;
+    std::vector<double> coefs(2 * M + 1);
+    for (int k = -M; k <= M; ++k) {
+        const double x1 = (double)k * w1 * T;
+        const double x2 = (double)k * w2 * T;
+        if (lowFreq == 0) {
+            coefs[k + M] = (Signal::sinc(x2) * T * w2 / SimTK_PI) *
+                           Signal::hamming(k, M);
+        } else {
+            coefs[k + M] = (Signal::sinc(x2) * T * w2 / SimTK_PI -
+                                   Signal::sinc(x1) * T * w1 / SimTK_PI) *
+                           Signal::hamming(k, M);
+        }
+    }
+    return coefs;
+}
+
+// Convolve the interleaved, padded input (n + 2M rows) with the coefficients
+// and write the n rows of the result to output. The result is normalized for
+// unity gain at DC.
+void firBlock(const std::vector<double>& coefs, int n, const double* input,
+        double* output) {
+    const int B = filterBlockSize;
+    const int M = ((int)coefs.size() - 1) / 2;
+    double sumCoefs = 0;
+    for (const double coef : coefs) sumCoefs += coef;
+    for (int i = 0; i < n; ++i) {
+        double sum[B] = {};
+        for (int k = -M; k <= M; ++k) {
+            const double coef = coefs[k + M];
+            const double* s = input + (M + i - k) * B;
+            for (int c = 0; c < B; ++c) sum[c] += coef * s[c];
+        }
+        for (int c = 0; c < B; ++c) output[i * B + c] = sum[c] / sumCoefs;
+    }
+}
 
+// The smallest sampling interval. isUniform is set to false if the sampling
+// interval varies.
+double calcSamplingInterval(const std::vector<double>& time, bool& isUniform) {
+    const int numRows = (int)time.size();
     double dtMin = SimTK::Infinity;
     for (int irow = 1; irow < numRows; ++irow) {
         double dt = time[irow] - time[irow - 1];
@@ -139,24 +328,133 @@ void TableUtilities::filterLowpass(
     }
     OPENSIM_THROW_IF(
             dtMin < SimTK::Eps, Exception, "Storage cannot be resampled.");
-
     double dtAvg = (time.back() - time.front()) / (numRows - 1);
+    isUniform = !(dtAvg - dtMin > SimTK::Eps);
+    return dtMin;
+}
+
+std::vector<const double*> getColumns(const TimeSeriesTable& table) {
+    std::vector<const double*> columns(table.getNumColumns());
+    for (int icol = 0; icol < (int)columns.size(); ++icol) {
+        columns[icol] = table.getMatrix().col(icol).getContiguousScalarData();
+    }
+    return columns;
+}
+
+std::vector<double*> updColumns(SimTK::MatrixBase<double>& matrix) {
+    std::vector<double*> columns(matrix.ncol());
+    for (int icol = 0; icol < (int)columns.size(); ++icol) {
+        columns[icol] = matrix.updCol(icol).updContiguousScalarData();
+    }
+    return columns;
+}
+
+void filterFIR(TimeSeriesTable& table, int order, double lowFreq,
+        double highFreq) {
+    OPENSIM_THROW_IF(order < 1, Exception,
+            "Expected the filter order to be positive, but got {}.", order);
+    OPENSIM_THROW_IF(lowFreq < 0 || highFreq < lowFreq, Exception,
+            "Expected 0 <= low frequency <= high frequency, but got {} and {}.",
+            lowFreq, highFreq);
+    OPENSIM_THROW_IF((int)table.getNumRows() < 2 * order, Exception,
+            "Expected at least twice as many rows as the filter order ({}), "
+            "but got {} rows.",
+            order, table.getNumRows());
+
+    bool isUniform;
+    const double dt =
+            calcSamplingInterval(table.getIndependentColumn(), isUniform);
+    if (!isUniform) table = TableUtilities::resampleWithInterval(table, dt);
+
+    const int numRows = (int)table.getNumRows();
+    const std::vector<double> coefs =
+            calcFIRCoefficients(order, dt, lowFreq, highFreq);
+    const std::vector<const double*> input = getColumns(table);
+    // The filtered columns are written to a new matrix, since the input of
+    // each block must not change while it is filtered.
+    SimTK::Matrix filtered(numRows, (int)table.getNumColumns());
+    const std::vector<double*> output = updColumns(filtered);
+    const int paddedRows = numRows + 2 * order;
+    forEachColumnBlock(numRows, (int)input.size(), paddedRows + numRows,
+            [&](int first, int width, double* buffer) {
+                double* result = buffer + paddedRows * filterBlockSize;
+                gatherBlock(input, numRows, first, width, order, lowFreq == 0,
+                        buffer);
+                firBlock(coefs, numRows, buffer, result);
+                scatterBlock(result, numRows, first, width, output);
+            });
+    table.updMatrix() = filtered;
+}
+} // namespace
+
+void TableUtilities::filterLowpass(
+        TimeSeriesTable& table, double cutoffFreq, bool padData) {
+    OPENSIM_THROW_IF(cutoffFreq < 0, Exception,
+            "Cutoff frequency must be non-negative; got {}.", cutoffFreq);
+
+    // Only the time column is padded here; the data is padded as it is
+    // filtered.
+    int numPad = padData ? (int)table.getNumRows() / 2 : 0;
+    std::vector<double> time = Signal::Pad(numPad, (int)table.getNumRows(),
+            table.getIndependentColumn().data());
+
+    OPENSIM_THROW_IF(time.size() < 4, Exception,
+            "Expected at least 4 rows to filter, but got {} rows.",
+            time.size());
+
+    bool isUniform;
+    const double dt = calcSamplingInterval(time, isUniform);
 
     // Resample if the sampling interval is not uniform.
-    if (dtAvg - dtMin > SimTK::Eps) {
-        table = resampleWithInterval(table, dtMin);
+    if (!isUniform) {
+        pad(table, numPad);
+        table = resampleWithInterval(table, dt);
+        time = table.getIndependentColumn();
+        numPad = 0;
     }
 
-    SimTK::Vector filtered(numRows);
-    for (int icol = 0; icol < (int)table.getNumColumns(); ++icol) {
-        SimTK::VectorView column = table.getDependentColumnAtIndex(icol);
-        Signal::LowpassIIR(dtMin, cutoffFreq, numRows,
-                column.getContiguousScalarData(),
-                filtered.updContiguousScalarData());
-        table.updDependentColumnAtIndex(icol) = filtered;
+    const int numRows = (int)time.size();
+    const int numColumns = (int)table.getNumColumns();
+    const LowpassIIRCoefficients coefs =
+            calcLowpassIIRCoefficients(dt, cutoffFreq);
+    const std::vector<const double*> input = getColumns(table);
+    const int numInputRows = (int)table.getNumRows();
+    const auto filterColumns = [&](const std::vector<double*>& output) {
+        forEachColumnBlock(numRows, numColumns, numRows,
+                [&](int first, int width, double* buffer) {
+                    gatherBlock(input, numInputRows, first, width, numPad,
+                            true, buffer);
+                    filtfiltBlock(coefs, numRows, buffer);
+                    scatterBlock(buffer, numRows, first, width, output);
+                });
+    };
+
+    if (numPad == 0) {
+        // Each block is read into the buffer before it is written, so the
+        // table can be filtered in place.
+        filterColumns(updColumns(table.updMatrix()));
+    } else {
+        SimTK::Matrix filtered(numRows, numColumns);
+        filterColumns(updColumns(filtered));
+        table._indData = std::move(time);
+        table.updMatrix() = filtered;
     }
 }
 
+void TableUtilities::filterLowpassFIR(
+        TimeSeriesTable& table, int order, double cutoffFreq) {
+    OPENSIM_THROW_IF(cutoffFreq < 0, Exception,
+            "Cutoff frequency must be non-negative; got {}.", cutoffFreq);
+    filterFIR(table, order, 0, cutoffFreq);
+}
+
+void TableUtilities::filterBandpassFIR(TimeSeriesTable& table, int order,
+        double lowFreq, double highFreq) {
+    OPENSIM_THROW_IF(lowFreq <= 0, Exception,
+            "Expected the low frequency to be positive, but got {}.", lowFreq);
+    filterFIR(table, order, lowFreq, highFreq);
+}
+
 void TableUtilities::pad(
         TimeSeriesTable& table, int numRowsToPrependAndAppend) {
     if (numRowsToPrependAndAppend == 0) return;
@@ -240,24 +538,32 @@ TimeSeriesTable TableUtilities::resample(
                 itime, itime - 1, newTime[itime], newTime[itime - 1]);
     }
 
-    // Copy over metadata.
-    TimeSeriesTable out = in;
-    for (int irow = (int)out.getNumRows() - 1; irow >= 0; --irow) {
-        out.removeRowAtIndex(irow);
+    std::vector<double> times((int)newTime.size());
+    for (int itime = 0; itime < (int)newTime.size(); ++itime) {
+        times[itime] = newTime[itime];
+    }
+
+    // Linear interpolation does not require fitting functions to the columns.
+    if (std::is_same<FunctionType, PiecewiseLinearFunction>::value) {
+        return TableResampler(time, std::move(times),
+                TableResampler::Kernel::Linear).resample(in);
     }
 
     std::unique_ptr<FunctionSet> functions =
             createFunctionSet<FunctionType>(in);
-    SimTK::Vector curTime(1);
-    SimTK::RowVector row(functions->getSize());
-    for (int itime = 0; itime < (int)newTime.size(); ++itime) {
-        curTime[0] = newTime[itime];
-        for (int icol = 0; icol < functions->getSize(); ++icol) {
-            row(icol) = functions->get(icol).calcValue(curTime);
+    SimTK::Matrix values((int)times.size(), functions->getSize());
+    for (int icol = 0; icol < functions->getSize(); ++icol) {
+        const Function& function = functions->get(icol);
+        for (int itime = 0; itime < (int)times.size(); ++itime) {
+            values(itime, icol) = function.calcValue1(times[itime]);
         }
-        // Not efficient!
-        out.appendRow(curTime[0], row);
     }
+
+    // Copy over metadata.
+    TimeSeriesTable out(times, values, in.getColumnLabels());
+    out.updTableMetaData() = in.getTableMetaData();
+    out.setIndependentMetaData(in.getIndependentMetaData());
+    out.setDependentsMetaData(in.getDependentsMetaData());
     return out;
 }
 
@@ -61,12 +61,32 @@ public:
             const std::vector<std::string>& labels, const std::string& desired);
 
     /// Lowpass filter the data in a TimeSeriesTable at a provided cutoff
-    /// frequency. If padData is true, then the data is first padded with pad()
-    /// using numRowsToPrependAndAppend = table.getNumRows() / 2.
-    /// The filtering is performed with Signal::LowpassIIR()
+    /// frequency. If padData is true, then the data is first padded as with
+    /// pad() using numRowsToPrependAndAppend = table.getNumRows() / 2.
+    /// Each column is filtered as with Signal::LowpassIIR(), but the columns
+    /// are filtered together in blocks (using multiple threads for large
+    /// tables), and the padded table is not created before filtering. If the
+    /// sampling interval is not uniform, the table is first resampled with the
+    /// smallest sampling interval.
     static void filterLowpass(TimeSeriesTable& table,
             double cutoffFreq, bool padData = false);
 
+    /// Lowpass filter the data in a TimeSeriesTable with a finite impulse
+    /// response filter of the given order. Each column is filtered as with
+    /// Signal::LowpassFIR(); the columns are filtered together as in
+    /// filterLowpass().
+    /// @throws Exception if the table has fewer than 2 * order rows.
+    static void filterLowpassFIR(TimeSeriesTable& table, int order,
+            double cutoffFreq);
+
+    /// Bandpass filter the data in a TimeSeriesTable with a finite impulse
+    /// response filter of the given order. Each column is filtered as with
+    /// Signal::BandpassFIR(); the columns are filtered together as in
+    /// filterLowpass().
+    /// @throws Exception if the table has fewer than 2 * order rows.
+    static void filterBandpassFIR(TimeSeriesTable& table, int order,
+            double lowFreq, double highFreq);
+
     /// Pad each column by the number of rows specified. The padded data is
     /// obtained by reflecting and negating the data in the table.
     /// Postcondition: the number of rows is table.getNumRows() + 2 *
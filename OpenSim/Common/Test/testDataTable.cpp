@@ -20,13 +20,17 @@
  * See the License for the specific language governing permissions and        *
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
+#include <functional>
 #include <iostream>
 
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 #include <catch2/catch_all.hpp>
 
 #include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/GCVSpline.h>
 #include <OpenSim/Common/PiecewiseLinearFunction.h>
+#include <OpenSim/Common/Signal.h>
+#include <OpenSim/Common/TableResampler.h>
 #include <OpenSim/Common/TableUtilities.h>
 #include <OpenSim/Common/STOFileAdapter.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
@@ -863,6 +867,100 @@ TEST_CASE("TableUtilities::filterLowpass") {
     }
 }
 
+namespace {
+TimeSeriesTable createRandomTable(int numRows, int numColumns, double dt) {
+    std::vector<double> time(numRows);
+    for (int i = 0; i < numRows; ++i) time[i] = i * dt;
+    std::vector<std::string> labels;
+    for (int j = 0; j < numColumns; ++j) labels.push_back(std::to_string(j));
+    SimTK::Matrix data(numRows, numColumns);
+    for (int j = 0; j < numColumns; ++j) {
+        data.updCol(j) = SimTK::Test::randVector(numRows);
+    }
+    return TimeSeriesTable(time, data, labels);
+}
+} // namespace
+
+TEST_CASE("TableUtilities multi-channel filters") {
+    // Enough rows and columns (including a partial block of columns) to use
+    // multiple threads.
+    const int numRows = 20000;
+    const int numColumns = 21;
+    const double dt = 0.001;
+    const TimeSeriesTable original = createRandomTable(numRows, numColumns, dt);
+
+    // Compare with filtering each column with Signal.
+    const auto check = [&](const TimeSeriesTable& table,
+                               const std::function<std::vector<double>(
+                                       const double*)>& filterColumn) {
+        REQUIRE(table.getNumColumns() == numColumns);
+        for (int icol = 0; icol < numColumns; ++icol) {
+            const std::vector<double> expected = filterColumn(
+                    original.getDependentColumnAtIndex(icol)
+                            .getContiguousScalarData());
+            const auto& column = table.getDependentColumnAtIndex(icol);
+            REQUIRE(column.size() == (int)expected.size());
+            for (int i = 0; i < column.size(); ++i) {
+                CHECK(column[i] == Approx(expected[i]).margin(1e-12));
+            }
+        }
+    };
+
+    SECTION("filterLowpass") {
+        TimeSeriesTable table = original;
+        TableUtilities::filterLowpass(table, 6.0);
+        CHECK(table.getIndependentColumn() == original.getIndependentColumn());
+        check(table, [&](const double* x) {
+            std::vector<double> y(numRows);
+            Signal::LowpassIIR(dt, 6.0, numRows, x, y.data());
+            return y;
+        });
+    }
+
+    SECTION("filterLowpass with padding") {
+        TimeSeriesTable table = original;
+        TableUtilities::filterLowpass(table, 6.0, true);
+        TimeSeriesTable padded = original;
+        TableUtilities::pad(padded, numRows / 2);
+        CHECK(table.getIndependentColumn() == padded.getIndependentColumn());
+        check(table, [&](const double* x) {
+            std::vector<double> s = Signal::Pad(numRows / 2, numRows, x);
+            std::vector<double> y(s.size());
+            Signal::LowpassIIR(dt, 6.0, (int)s.size(), s.data(), y.data());
+            return y;
+        });
+    }
+
+    SECTION("filterLowpassFIR") {
+        TimeSeriesTable table = original;
+        TableUtilities::filterLowpassFIR(table, 30, 50.0);
+        check(table, [&](const double* x) {
+            std::vector<double> s(x, x + numRows);
+            std::vector<double> y(numRows);
+            Signal::LowpassFIR(30, dt, 50.0, numRows, s.data(), y.data());
+            return y;
+        });
+    }
+
+    SECTION("filterBandpassFIR") {
+        TimeSeriesTable table = original;
+        TableUtilities::filterBandpassFIR(table, 30, 20.0, 200.0);
+        check(table, [&](const double* x) {
+            std::vector<double> s(x, x + numRows);
+            std::vector<double> y(numRows);
+            Signal::BandpassFIR(30, dt, 20.0, 200.0, numRows, s.data(),
+                    y.data());
+            return y;
+        });
+    }
+
+    SECTION("Too few rows") {
+        TimeSeriesTable table = createRandomTable(50, 2, dt);
+        CHECK_THROWS_WITH(TableUtilities::filterLowpassFIR(table, 30, 50.0),
+                ContainsSubstring("Expected at least twice as many rows"));
+    }
+}
+
 TEST_CASE("TableUtilities::pad") {
     Storage sto("test.sto");
     TimeSeriesTable paddedTable = sto.exportToTable();
@@ -919,6 +1017,138 @@ TEST_CASE("TableUtilities::resample") {
     }
 }
 
+TEST_CASE("TableResampler") {
+    const int numRows = 201;
+    const double dt = 0.01;
+    std::vector<double> time(numRows);
+    for (int i = 0; i < numRows; ++i) time[i] = i * dt;
+    TimeSeriesTable table(time);
+    SimTK::Vector line(numRows), sine(numRows);
+    for (int i = 0; i < numRows; ++i) {
+        line[i] = 3.0 * time[i] - 1.0;
+        sine[i] = std::sin(2 * SimTK::Pi * time[i]);
+    }
+    table.appendColumn("line", line);
+    table.appendColumn("sine", sine);
+    table.addTableMetaData("inDegrees", std::string("no"));
+
+    std::vector<double> newTime;
+    for (double t = 0; t <= time.back(); t += 0.0037) newTime.push_back(t);
+    newTime.push_back(time.back());
+
+    for (const auto kernel : {TableResampler::Kernel::Linear,
+                 TableResampler::Kernel::NaturalCubic,
+                 TableResampler::Kernel::WindowedSinc,
+                 TableResampler::Kernel::QuinticSpline}) {
+        CAPTURE((int)kernel);
+        TableResampler resampler(time, newTime, kernel);
+        const TimeSeriesTable resampled = resampler.resample(table);
+        CHECK(resampled.getIndependentColumn() == newTime);
+        CHECK(resampled.getColumnLabels() == table.getColumnLabels());
+        CHECK(resampled.getTableMetaDataAsString("inDegrees") == "no");
+        const auto& lineOut = resampled.getDependentColumn("line");
+        const auto& sineOut = resampled.getDependentColumn("sine");
+        for (int i = 0; i < (int)newTime.size(); ++i) {
+            const double t = newTime[i];
+            // The windowed sinc kernel is only accurate away from the ends.
+            if (kernel == TableResampler::Kernel::WindowedSinc &&
+                    (t < 0.1 || t > time.back() - 0.1)) {
+                continue;
+            }
+            CHECK(lineOut[i] == Approx(3.0 * t - 1.0).margin(1e-3));
+            CHECK(sineOut[i] ==
+                    Approx(std::sin(2 * SimTK::Pi * t)).margin(2e-3));
+        }
+
+        // The original samples are reproduced.
+        TableResampler identity(time, time, kernel);
+        const SimTK::Matrix same = identity.resample(table.getMatrix());
+        for (int i = 0; i < numRows; ++i) {
+            CHECK(same(i, 1) == Approx(sine[i]).margin(1e-12));
+        }
+    }
+
+    SECTION("Linear kernel matches PiecewiseLinearFunction") {
+        PiecewiseLinearFunction function(
+                numRows, time.data(), sine.getContiguousScalarData());
+        const SimTK::Matrix resampled =
+                TableResampler(time, newTime).resample(table.getMatrix());
+        for (int i = 0; i < (int)newTime.size(); ++i) {
+            CHECK(resampled(i, 1) == Approx(function.calcValue1(newTime[i])));
+        }
+    }
+
+    SECTION("Natural cubic kernel is more accurate than linear") {
+        const SimTK::Matrix linear =
+                TableResampler(time, newTime).resample(table.getMatrix());
+        const SimTK::Matrix cubic = TableResampler(time, newTime,
+                TableResampler::Kernel::NaturalCubic)
+                        .resample(table.getMatrix());
+        double linearError = 0;
+        double cubicError = 0;
+        for (int i = 0; i < (int)newTime.size(); ++i) {
+            const double expected = std::sin(2 * SimTK::Pi * newTime[i]);
+            linearError = std::max(linearError, std::abs(linear(i, 1) - expected));
+            cubicError = std::max(cubicError, std::abs(cubic(i, 1) - expected));
+        }
+        CHECK(cubicError < 0.01 * linearError);
+    }
+
+    SECTION("Quintic spline kernel matches GCVSpline") {
+        const GCVSpline spline(5, numRows, time.data(),
+                sine.getContiguousScalarData(), "sine", 0.0);
+        const SimTK::Matrix resampled = TableResampler(time, newTime,
+                TableResampler::Kernel::QuinticSpline)
+                        .resample(table.getMatrix());
+        for (int i = 0; i < (int)newTime.size(); ++i) {
+            CHECK(resampled(i, 0) ==
+                    Approx(3.0 * newTime[i] - 1.0).margin(1e-8));
+            CHECK(resampled(i, 1) ==
+                    Approx(spline.calcValue(SimTK::Vector(1, newTime[i])))
+                            .margin(1e-10));
+        }
+    }
+
+    SECTION("Quintic spline kernel matches GCVSpline with few times") {
+        // With fewer than 6 times, the spline has a lower degree.
+        for (int numTimes = 2; numTimes <= 8; ++numTimes) {
+            CAPTURE(numTimes);
+            std::vector<double> fewTimes(numTimes);
+            SimTK::Vector values(numTimes);
+            for (int i = 0; i < numTimes; ++i) {
+                fewTimes[i] = std::pow(i / double(numTimes - 1), 1.5);
+                values[i] = std::sin(3.0 * fewTimes[i]);
+            }
+            const GCVSpline spline(std::min(numTimes - 1, 5), numTimes,
+                    fewTimes.data(), &values[0], "sine", 0.0);
+            std::vector<double> fewNewTimes;
+            for (int i = 0; i <= 50; ++i) fewNewTimes.push_back(i / 50.0);
+            const SimTK::Matrix resampled = TableResampler(fewTimes,
+                    fewNewTimes, TableResampler::Kernel::QuinticSpline)
+                            .resample(SimTK::Matrix(values));
+            for (int i = 0; i < (int)fewNewTimes.size(); ++i) {
+                CHECK(resampled(i, 0) ==
+                        Approx(spline.calcValue(
+                                       SimTK::Vector(1, fewNewTimes[i])))
+                                .margin(1e-10));
+            }
+        }
+    }
+
+    SECTION("Errors") {
+        CHECK_THROWS_WITH(TableResampler(time, {-1.0}),
+                ContainsSubstring("cannot be less than"));
+        CHECK_THROWS_WITH(TableResampler(time, {0.5, 0.4}),
+                ContainsSubstring("non-decreasing"));
+        CHECK_THROWS_WITH(TableResampler({0.0, 0.1, 0.3}, {0.2},
+                                  TableResampler::Kernel::WindowedSinc),
+                ContainsSubstring("uniformly spaced"));
+        TableResampler resampler({0.0, 1.0}, {0.5});
+        CHECK_THROWS_WITH(resampler.resample(table),
+                ContainsSubstring("Expected the table to have the times"));
+    }
+}
+
 TEST_CASE("TimeSeriesTable trim methods") {
     // make time table
     TimeSeriesTable_<double> table{};
@@ -24,9 +24,16 @@
 #include "ComponentsForTesting.h"
 
 #include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/Constant.h>
+#include <OpenSim/Common/FunctionAdapter.h>
+#include <OpenSim/Common/GCVSpline.h>
+#include <OpenSim/Common/LinearFunction.h>
+#include <OpenSim/Common/MultiplierFunction.h>
 #include <OpenSim/Common/MultivariatePolynomialFunction.h>
+#include <OpenSim/Common/PiecewiseLinearFunction.h>
 #include <OpenSim/Common/Reporter.h>
 #include <OpenSim/Common/SignalGenerator.h>
+#include <OpenSim/Common/SimmSpline.h>
 #include <OpenSim/Common/Sine.h>
 #include <OpenSim/Common/ExpressionBasedFunction.h>
 
@@ -349,4 +356,172 @@ TEST_CASE("ExpressionBasedFunction") {
         REQUIRE_THAT(f.calcDerivative({2}, createVector({x, y, z})), 
                 Catch::Matchers::WithinAbs(-y*std::sin(z), 1e-10));
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Scalar evaluation of Functions") {
+    const double x[] = {-1.0, -0.2, 0.3, 0.9, 1.5, 2.0};
+    const double y[] = {0.5, 0.1, -0.4, 0.2, 0.8, 0.3};
+    const int n = 6;
+
+    std::vector<std::unique_ptr<OpenSim::Function>> functions;
+    functions.emplace_back(new OpenSim::SimmSpline(n, x, y));
+    functions.emplace_back(new OpenSim::GCVSpline(3, n, x, y));
+    functions.emplace_back(new OpenSim::PiecewiseLinearFunction(n, x, y));
+    functions.emplace_back(new OpenSim::LinearFunction(1.3, -0.2));
+    functions.emplace_back(new OpenSim::Constant(2.5));
+    functions.emplace_back(new OpenSim::MultiplierFunction(
+            new OpenSim::SimmSpline(n, x, y), 3.0));
+    // Uses the default implementation.
+    functions.emplace_back(new OpenSim::Sine(1.5, 3.1, 0.3, 0.1));
+
+    for (const auto& f : functions) {
+        CAPTURE(f->getConcreteClassName());
+        // The SimTK::Function used by joints and constraints.
+        std::unique_ptr<SimTK::Function> simtk(f->createSimTKFunction());
+        // Include points outside the range of the data and at the data.
+        for (double xi : {-1.5, -1.0, -0.5, 0.0, 0.3, 0.6, 1.99, 2.0, 2.5}) {
+            CAPTURE(xi);
+            const Vector vx(1, xi);
+            CHECK(f->calcValue1(xi) == Approx(f->calcValue(vx)));
+            CHECK(simtk->calcValue(vx) == Approx(f->calcValue(vx)));
+            // A derivative of order 0 is the value.
+            CHECK(f->calcDerivs1(xi, 0) == Approx(f->calcValue1(xi)));
+            int hint = 0;
+            CHECK(f->calcDerivs1WithHint(xi, 0, hint) ==
+                    Approx(f->calcValue1(xi)));
+            const int maxOrder = std::min(f->getMaxDerivativeOrder(), 2);
+            for (int order = 1; order <= maxOrder; ++order) {
+                CAPTURE(order);
+                const std::vector<int> derivComponents(order, 0);
+                const double expected = f->calcDerivative(derivComponents, vx);
+                CHECK(f->calcDerivs1(xi, order) == Approx(expected));
+                CHECK(simtk->calcDerivative(
+                              SimTK::Array_<int>(order, 0), vx) ==
+                        Approx(expected));
+            }
+        }
+    }
+}
+
+namespace {
+// Exposes the SimTK::Function that a GCVSpline uses for evaluation, so that
+// tests can check whether copies share it.
+class GCVSplineWithSimTKFunction : public OpenSim::GCVSpline {
+public:
+    using OpenSim::GCVSpline::GCVSpline;
+    using OpenSim::GCVSpline::getSimTKFunction;
+};
+} // anonymous namespace
+
+TEST_CASE("Copies of Functions share the SimTK::Function until modified") {
+    const double x[] = {-1.0, -0.2, 0.3, 0.9, 1.5, 2.0};
+    const double y[] = {0.5, 0.1, -0.4, 0.2, 0.8, 0.3};
+    const int n = 6;
+
+    SECTION("GCVSpline") {
+        GCVSplineWithSimTKFunction spline(3, n, x, y);
+        const double value = spline.calcValue1(0.5);
+        GCVSplineWithSimTKFunction copy(spline);
+        // The copy does not fit the spline again.
+        CHECK(&copy.getSimTKFunction() == &spline.getSimTKFunction());
+        CHECK(copy.calcValue1(0.5) == value);
+        std::unique_ptr<SimTK::Function> simtk(copy.createSimTKFunction());
+        CHECK(simtk->calcValue(Vector(1, 0.5)) == Approx(value));
+        CHECK(&copy.getSimTKFunction() == &spline.getSimTKFunction());
+
+        copy.setY(2, 0.4);
+        CHECK(copy.calcValue1(0.5) != Approx(value));
+        CHECK(&copy.getSimTKFunction() != &spline.getSimTKFunction());
+        CHECK(spline.calcValue1(0.5) == value);
+        OpenSim::GCVSpline expected(3, n, x, y);
+        expected.setY(2, 0.4);
+        CHECK(copy.calcValue1(0.5) == Approx(expected.calcValue1(0.5)));
+        simtk.reset(copy.createSimTKFunction());
+        CHECK(simtk->calcValue(Vector(1, 0.5)) ==
+                Approx(expected.calcValue1(0.5)));
+
+        GCVSplineWithSimTKFunction assigned;
+        assigned = spline;
+        CHECK(&assigned.getSimTKFunction() == &spline.getSimTKFunction());
+        CHECK(assigned.calcValue1(0.5) == value);
+
+        // A spline that has not been evaluated has nothing to share.
+        GCVSplineWithSimTKFunction unevaluated(3, n, x, y);
+        GCVSplineWithSimTKFunction unevaluatedCopy(unevaluated);
+        CHECK(&unevaluatedCopy.getSimTKFunction() !=
+                &unevaluated.getSimTKFunction());
+        CHECK(unevaluatedCopy.calcValue1(0.5) == Approx(value));
+    }
+
+    SECTION("ExpressionBasedFunction") {
+        ExpressionBasedFunction f("x^2", {"x"});
+        CHECK(f.calcValue(createVector({3.0})) == Approx(9.0));
+        ExpressionBasedFunction copy(f);
+        CHECK(copy.calcValue(createVector({3.0})) == Approx(9.0));
+        copy.setExpression("x^3");
+        CHECK(copy.calcValue(createVector({3.0})) == Approx(27.0));
+        CHECK(f.calcValue(createVector({3.0})) == Approx(9.0));
+        // Modifying the original does not affect the copy.
+        f.setExpression("2*x");
+        CHECK(f.calcValue(createVector({3.0})) == Approx(6.0));
+        CHECK(copy.calcValue(createVector({3.0})) == Approx(27.0));
+    }
+
+    SECTION("MultivariatePolynomialFunction") {
+        MultivariatePolynomialFunction f(createVector({1.0, 2.0}), 1, 1);
+        CHECK(f.calcValue(createVector({3.0})) == Approx(7.0));
+        MultivariatePolynomialFunction copy(f);
+        CHECK(copy.calcValue(createVector({3.0})) == Approx(7.0));
+        copy.setCoefficients(createVector({1.0, 3.0}));
+        CHECK(copy.calcValue(createVector({3.0})) == Approx(10.0));
+        CHECK(f.calcValue(createVector({3.0})) == Approx(7.0));
+    }
+}
+
+TEST_CASE("Sequential and batch evaluation of piecewise Functions") {
+    const int n = 200;
+    std::vector<double> x(n), y(n);
+    for (int i = 0; i < n; ++i) {
+        x[i] = 0.01 * i + 0.001 * std::sin(i);
+        y[i] = std::cos(0.1 * i);
+    }
+    std::vector<std::unique_ptr<OpenSim::Function>> functions;
+    functions.emplace_back(new OpenSim::SimmSpline(n, x.data(), y.data()));
+    functions.emplace_back(
+            new OpenSim::PiecewiseLinearFunction(n, x.data(), y.data()));
+
+    // Increasing, decreasing, and unordered arguments, including arguments
+    // outside the range of the knots and at the knots.
+    const int m = 1000;
+    Vector increasing(m), decreasing(m), unordered(m);
+    for (int i = 0; i < m; ++i) {
+        increasing[i] = -0.1 + 2.2 * i / (m - 1);
+        decreasing[m - 1 - i] = increasing[i];
+        unordered[i] = -0.1 + 2.2 * std::fmod(0.618034 * i, 1.0);
+    }
+    increasing[m / 2] = x[n / 2];
+
+    for (const auto& f : functions) {
+        CAPTURE(f->getConcreteClassName());
+        for (const Vector* xs : {&increasing, &decreasing, &unordered}) {
+            Vector values;
+            f->calcValues(*xs, values);
+            REQUIRE(values.size() == m);
+            // The hint is owned by the caller; calcValue1() and
+            // calcDerivs1() search without a hint.
+            int hint = 0;
+            int derivHint = 0;
+            for (int i = 0; i < m; ++i) {
+                const double xi = (*xs)[i];
+                CHECK(values[i] == Approx(f->calcValue1(xi)));
+                CHECK(f->calcValue1WithHint(xi, hint) == Approx(values[i]));
+                CHECK(f->calcDerivs1WithHint(xi, 1, derivHint) ==
+                        Approx(f->calcDerivs1(xi, 1)));
+            }
+            // Hints outside of the range of intervals are ignored.
+            for (int badHint : {-1, n - 1, 10 * n}) {
+                CHECK(f->calcValue1WithHint(x[n / 3], badHint) ==
+                        Approx(y[n / 3]));
+            }
+        }
+    }
+}
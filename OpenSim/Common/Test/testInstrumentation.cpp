@@ -0,0 +1,132 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  testInstrumentation.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Common/Instrumentation.h>
+
+#include <OpenSim/Common/Exception.h>
+#include <catch2/catch_all.hpp>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace OpenSim;
+using Catch::Matchers::ContainsSubstring;
+
+TEST_CASE("Instrumentation") {
+    Instrumentation::clear();
+
+    SECTION("Nothing is recorded while disabled") {
+        Instrumentation::setEnabled(false);
+        { Instrumentation::Scope scope("testInstrumentation::disabled"); }
+        CHECK_THAT(Instrumentation::createSummary(),
+                !ContainsSubstring("testInstrumentation::disabled"));
+    }
+
+    SECTION("Scopes and counters from multiple threads") {
+        Instrumentation::setEnabled(true);
+        const int numThreads = 4;
+        const int numCalls = 100;
+        std::vector<std::thread> threads;
+        for (int ithread = 0; ithread < numThreads; ++ithread) {
+            threads.emplace_back([=]() {
+                for (int icall = 0; icall < numCalls; ++icall) {
+                    Instrumentation::Scope scope("testInstrumentation::work");
+                    Instrumentation::recordCounter(
+                            "testInstrumentation::counter", 2.0);
+                }
+            });
+        }
+        for (auto& thread : threads) { thread.join(); }
+        Instrumentation::setEnabled(false);
+
+        // The threads have exited, but their data is kept.
+        const std::string summary = Instrumentation::createSummary();
+        std::istringstream lines(summary);
+        std::string line;
+        bool foundScope = false;
+        bool foundCounter = false;
+        while (std::getline(lines, line)) {
+            std::istringstream fields(line);
+            std::string name;
+            long long count;
+            fields >> name >> count;
+            if (name == "testInstrumentation::work") {
+                CHECK(count == numThreads * numCalls);
+                foundScope = true;
+            } else if (name == "testInstrumentation::counter") {
+                CHECK(count == numThreads * numCalls);
+                double sum;
+                fields >> sum;
+                CHECK(sum == Catch::Approx(2.0 * numThreads * numCalls));
+                foundCounter = true;
+            }
+        }
+        CHECK(foundScope);
+        CHECK(foundCounter);
+
+        const std::string filename = "testInstrumentation_trace.json";
+        Instrumentation::writeChromeTrace(filename);
+        std::ifstream file(filename);
+        std::stringstream trace;
+        trace << file.rdbuf();
+        CHECK_THAT(trace.str(), ContainsSubstring("\"traceEvents\":["));
+        CHECK_THAT(trace.str(),
+                ContainsSubstring("{\"name\":\"testInstrumentation::work\","
+                                  "\"ph\":\"X\""));
+        CHECK_THAT(trace.str(),
+                ContainsSubstring("{\"name\":\"testInstrumentation::counter\","
+                                  "\"ph\":\"C\""));
+
+        Instrumentation::clear();
+        CHECK_THAT(Instrumentation::createSummary(),
+                !ContainsSubstring("testInstrumentation::work"));
+    }
+
+    SECTION("Events beyond the maximum are only included in the totals") {
+        const int maxEvents = Instrumentation::getMaxEventsPerThread();
+        Instrumentation::setMaxEventsPerThread(1);
+        Instrumentation::setEnabled(true);
+        for (int i = 0; i < 3; ++i) {
+            Instrumentation::Scope scope("testInstrumentation::limited");
+        }
+        Instrumentation::setEnabled(false);
+        Instrumentation::setMaxEventsPerThread(maxEvents);
+
+        const std::string filename = "testInstrumentation_limited.json";
+        Instrumentation::writeChromeTrace(filename);
+        std::ifstream file(filename);
+        std::stringstream trace;
+        trace << file.rdbuf();
+        const std::string str = trace.str();
+        const std::string event = "testInstrumentation::limited";
+        CHECK(str.find(event) != std::string::npos);
+        CHECK(str.find(event, str.find(event) + 1) == std::string::npos);
+        CHECK_THAT(Instrumentation::createSummary(),
+                ContainsSubstring("testInstrumentation::limited"));
+
+        CHECK_THROWS_AS(Instrumentation::setMaxEventsPerThread(-1),
+                Exception);
+    }
+
+    Instrumentation::clear();
+}
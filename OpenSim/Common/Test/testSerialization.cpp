@@ -380,3 +380,20 @@ TEST_CASE("Object Serialization")
     ASSERT(notFound == -1);
     SimTK_TEST_MUST_THROW(SerializableObject bad("obj1Bad.xml"));
 }
+
+TEST_CASE("Registered type names are sorted")
+{
+    Object::registerType(SerializableObject());
+    Object::registerType(SerializableObject2());
+    Array<std::string> typeNames;
+    Object::getRegisteredTypenames(typeNames);
+    REQUIRE(typeNames.getSize() >= 2);
+    for (int i = 1; i < typeNames.getSize(); ++i) {
+        CHECK(typeNames[i - 1] < typeNames[i]);
+    }
+    // Renamed types are found by their old names.
+    Object::renameType("OldSerializableObject2", "SerializableObject2");
+    std::unique_ptr<Object> renamed(
+            Object::newInstanceOfType("OldSerializableObject2"));
+    CHECK(renamed->getConcreteClassName() == "SerializableObject2");
+}
@@ -29,6 +29,7 @@
 
 using namespace OpenSim;
 using namespace std;
+using Catch::Approx;
 
 namespace {
     // helper function
@@ -48,6 +49,22 @@ namespace {
 
         ASSERT(numCols == labels.size());
     }
+
+    Storage createStorage(int numRows, int numColumns) {
+        Array<std::string> labels("", numColumns + 1);
+        labels[0] = "time";
+        for (int j = 0; j < numColumns; ++j) {
+            labels[j + 1] = "c" + std::to_string(j);
+        }
+        Storage sto(numRows);
+        sto.setColumnLabels(labels);
+        SimTK::Vector row(numColumns);
+        for (int i = 0; i < numRows; ++i) {
+            for (int j = 0; j < numColumns; ++j) row[j] = i + 0.001 * j;
+            sto.append(0.01 * i, row);
+        }
+        return sto;
+    }
 }
 
 TEST_CASE("Test Storage Legacy Behavior")
@@ -194,3 +211,52 @@ TEST_CASE("Verify the loading of marker data (14 markers) from .trc into a Stora
 {
     loadStorageWithNColsFromFile("dataWithNaNsOfDifferentCases.trc", 43);
 }
+
+TEST_CASE("Storage conversion to and from TimeSeriesTable")
+{
+    Storage sto = createStorage(50, 3);
+    sto.setName("converted");
+    sto.setInDegrees(true);
+    const TimeSeriesTable table = sto.exportToTable();
+    CHECK(table.getNumRows() == 50);
+    CHECK(table.getColumnLabels() ==
+            std::vector<std::string>{"c0", "c1", "c2"});
+    CHECK(table.getIndependentColumn()[10] == Approx(0.1));
+    CHECK(table.getMatrix()(10, 2) == Approx(10.002));
+
+    const Storage roundTrip(table);
+    CHECK(roundTrip.getName() == "converted");
+    CHECK(roundTrip.isInDegrees());
+    CHECK((roundTrip.getColumnLabels() == sto.getColumnLabels()));
+    REQUIRE(roundTrip.getSize() == sto.getSize());
+    for (int i = 0; i < sto.getSize(); ++i) {
+        CHECK((*roundTrip.getStateVector(i) == *sto.getStateVector(i)));
+    }
+
+    // As before, rows whose size does not match the column labels cannot be
+    // exported.
+    Storage ragged = createStorage(2, 3);
+    double value = 1.0;
+    ragged.append(0.5, 1, &value);
+    CHECK_THROWS(ragged.exportToTable());
+}
+
+TEST_CASE("Storage findIndex")
+{
+    const Storage sto = createStorage(100, 1);
+    for (int i = 0; i < 100; ++i) {
+        CHECK(sto.findIndex(0.01 * i + 0.005) == i);
+        CHECK(sto.findIndex(0, 0.01 * i + 0.005) == i);
+        CHECK(sto.findIndex(99 - i, 0.01 * i + 0.005) == i);
+    }
+    CHECK(sto.findIndex(-1.0) == 0);
+    CHECK(sto.findIndex(10.0) == 99);
+    CHECK(sto.findIndex(50, 0.0) == 0);
+
+    // Interpolation uses the cached index from the previous lookup.
+    SimTK::Vector values(1);
+    sto.getDataAtTime(0.125, 1, values);
+    CHECK(values[0] == Approx(12.5));
+    sto.getDataAtTime(0.015, 1, values);
+    CHECK(values[0] == Approx(1.5));
+}
@@ -34,6 +34,7 @@
 #include "GCVSpline.h"
 #include "GCVSplineSet.h"
 #include "IO.h"
+#include "Instrumentation.h"
 #include "LatinHypercubeDesign.h"
 #include "LinearFunction.h"
 #include "LoadOpenSimLibrary.h"
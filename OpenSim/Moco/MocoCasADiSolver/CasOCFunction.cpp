@@ -20,8 +20,112 @@
 
 #include "CasOCProblem.h"
 
+#include <OpenSim/Common/CommonUtilities.h>
+
+#include <algorithm>
+#include <atomic>
+
 using namespace CasOC;
 
+CallbackProfiler::CallbackProfiler()
+        : m_id([] {
+              static std::atomic<long long> nextId(0);
+              return nextId++;
+          }()) {}
+
+int CallbackProfiler::addCallback(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = std::find(
+            m_callbackNames.begin(), m_callbackNames.end(), name);
+    if (it != m_callbackNames.end()) {
+        return (int)std::distance(m_callbackNames.begin(), it);
+    }
+    m_callbackNames.push_back(name);
+    return (int)m_callbackNames.size() - 1;
+}
+
+std::vector<CallbackProfiler::Record>& CallbackProfiler::updThreadRecords() {
+    const auto threadId = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_threadIndices.find(threadId);
+    if (it == m_threadIndices.end()) {
+        it = m_threadIndices.emplace(threadId, (int)m_threadRecords.size())
+                     .first;
+        m_threadRecords.push_back(
+                OpenSim::make_unique<std::vector<Record>>(
+                        m_callbackNames.size()));
+    }
+    return *m_threadRecords[it->second];
+}
+
+void CallbackProfiler::record(
+        int callbackIndex, long long wallTimeNs, double cpuTime) {
+    // Each thread remembers its counters for the profiler it recorded to
+    // last, so the lock is taken only when a thread records to a profiler
+    // for the first time.
+    struct ThreadCache {
+        long long profilerId = -1;
+        std::vector<Record>* records = nullptr;
+    };
+    thread_local ThreadCache cache;
+    if (cache.profilerId != m_id) {
+        cache.records = &updThreadRecords();
+        cache.profilerId = m_id;
+    }
+    auto& records = *cache.records;
+    // Callbacks may be added after this thread's counters were created
+    // (e.g., by the next solve of a mesh refinement).
+    if (callbackIndex >= (int)records.size()) {
+        records.resize(callbackIndex + 1);
+    }
+    Record& rec = records[callbackIndex];
+    ++rec.numCalls;
+    rec.wallTimeNs += wallTimeNs;
+    rec.cpuTime += cpuTime;
+}
+
+void CallbackProfiler::recordSolve(
+        const casadi::Dict& stats, long long solveWallTimeNs) {
+    for (const auto& stat : stats) {
+        const std::string& key = stat.first;
+        if (key.compare(0, 7, "t_wall_") != 0) continue;
+        if (!stat.second.is_double()) continue;
+        const std::string function = key.substr(7);
+        Record r;
+        r.wallTimeNs = (long long)(stat.second.as_double() * 1e9);
+        const auto procIt = stats.find("t_proc_" + function);
+        if (procIt != stats.end() && procIt->second.is_double()) {
+            r.cpuTime = procIt->second.as_double();
+        }
+        const auto callsIt = stats.find("n_call_" + function);
+        if (callsIt != stats.end() && callsIt->second.is_int()) {
+            r.numCalls = callsIt->second.as_int();
+        }
+        m_solverRecords[function] += r;
+    }
+    ++m_solveRecord.numCalls;
+    m_solveRecord.wallTimeNs += solveWallTimeNs;
+}
+
+int CallbackProfiler::getNumThreads() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (int)m_threadRecords.size();
+}
+
+CallbackProfiler::Records CallbackProfiler::getRecords() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Records records;
+    for (int ithread = 0; ithread < (int)m_threadRecords.size(); ++ithread) {
+        const auto& threadRecords = *m_threadRecords[ithread];
+        for (int i = 0; i < (int)threadRecords.size(); ++i) {
+            if (threadRecords[i].numCalls) {
+                records[{i, ithread}] = threadRecords[i];
+            }
+        }
+    }
+    return records;
+}
+
 casadi::Sparsity calcJacobianSparsityWithPerturbation(const VectorDM& x0s,
         int numOutputs,
         std::function<void(const casadi::DM&, casadi::DM&)> function) {
@@ -114,6 +218,8 @@ void Function::constructFunction(const Problem* casProblem,
         std::shared_ptr<const std::vector<VariablesDM>>
                 pointsForSparsityDetection) {
     m_casProblem = casProblem;
+    m_profiler = casProblem->getCallbackProfiler();
+    if (m_profiler) m_profilerIndex = m_profiler->addCallback(name);
     m_finite_difference_scheme = finiteDiffScheme;
     m_fullPointsForSparsityDetection = pointsForSparsityDetection;
     casadi::Dict opts;
@@ -140,6 +246,7 @@ casadi::Sparsity Function::get_sparsity_in(casadi_int i) {
 }
 
 VectorDM PathConstraint::eval(const VectorDM& args) const {
+    CallbackProfiler::Scope profilerScope(m_profiler, m_profilerIndex);
     Problem::ContinuousInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5)};
     VectorDM out{casadi::DM(sparsity_out(0))};
@@ -148,6 +255,7 @@ VectorDM PathConstraint::eval(const VectorDM& args) const {
 }
 
 VectorDM CostIntegrand::eval(const VectorDM& args) const {
+    CallbackProfiler::Scope profilerScope(m_profiler, m_profilerIndex);
     Problem::ContinuousInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5)};
     VectorDM out{casadi::DM(casadi::Sparsity::scalar())};
@@ -156,6 +264,7 @@ VectorDM CostIntegrand::eval(const VectorDM& args) const {
 }
 
 VectorDM EndpointConstraintIntegrand::eval(const VectorDM& args) const {
+    CallbackProfiler::Scope profilerScope(m_profiler, m_profilerIndex);
     Problem::ContinuousInput input{args.at(0).scalar(), args.at(1), args.at(2),
                                    args.at(3), args.at(4), args.at(5)};
     VectorDM out{casadi::DM(casadi::Sparsity::scalar())};
@@ -227,6 +336,7 @@ casadi::DM Endpoint::getSubsetPoint(const VariablesDM& fullPoint,
     }
 }
 VectorDM Cost::eval(const VectorDM& args) const {
+    CallbackProfiler::Scope profilerScope(m_profiler, m_profilerIndex);
     Problem::CostInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5).scalar(), args.at(6), args.at(7),
             args.at(8), args.at(9), args.at(10), args.at(11).scalar()};
@@ -235,6 +345,7 @@ VectorDM Cost::eval(const VectorDM& args) const {
     return out;
 }
 VectorDM EndpointConstraint::eval(const VectorDM& args) const {
+    CallbackProfiler::Scope profilerScope(m_profiler, m_profilerIndex);
     Problem::CostInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5).scalar(), args.at(6), args.at(7),
             args.at(8), args.at(9), args.at(10), args.at(11).scalar()};
@@ -269,6 +380,7 @@ casadi::Sparsity MultibodySystemExplicit<calcKCErr>::get_sparsity_out(
 
 template <bool calcKCErr>
 VectorDM MultibodySystemExplicit<calcKCErr>::eval(const VectorDM& args) const {
+    CallbackProfiler::Scope profilerScope(m_profiler, m_profilerIndex);
     Problem::ContinuousInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5)};
     VectorDM out((int)n_out());
@@ -326,6 +438,7 @@ casadi::DM VelocityCorrection::getSubsetPoint(
 }
 
 VectorDM VelocityCorrection::eval(const VectorDM& args) const {
+    CallbackProfiler::Scope profilerScope(m_profiler, m_profilerIndex);
     VectorDM out{casadi::DM(sparsity_out(0))};
     m_casProblem->calcVelocityCorrection(
             args.at(0).scalar(), args.at(1), args.at(2), args.at(3), out[0]);
@@ -375,6 +488,7 @@ casadi::DM StateProjection::getSubsetPoint(
 }
 
 VectorDM StateProjection::eval(const VectorDM& args) const {
+    CallbackProfiler::Scope profilerScope(m_profiler, m_profilerIndex);
     VectorDM out{casadi::DM(sparsity_out(0))};
     m_casProblem->calcStateProjection(
             args.at(0).scalar(), args.at(1), args.at(2), args.at(3), out[0]);
@@ -407,6 +521,7 @@ casadi::Sparsity MultibodySystemImplicit<calcKCErr>::get_sparsity_out(
 
 template <bool calcKCErr>
 VectorDM MultibodySystemImplicit<calcKCErr>::eval(const VectorDM& args) const {
+    CallbackProfiler::Scope profilerScope(m_profiler, m_profilerIndex);
     Problem::ContinuousInput input{args.at(0).scalar(), args.at(1), args.at(2),
             args.at(3), args.at(4), args.at(5)};
     VectorDM out((int)n_out());
@@ -22,12 +22,118 @@
 
 #include <OpenSim/Common/Exception.h>
 
+#include <SimTKcommon/internal/Timing.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 namespace CasOC {
 
 class Problem;
 
 using VectorDM = std::vector<casadi::DM>;
 
+/// This class records the number of calls and the wall-clock and CPU time
+/// spent in each Function, broken down by the thread that made the call.
+/// A single profiler is shared by all Functions of a Problem (see
+/// Problem::setCallbackProfiler()), and can be shared by several Problems to
+/// accumulate a profile over several solves. Recording is thread-safe: each
+/// thread accumulates into its own counters, so only a thread's first call
+/// takes a lock. The profiler also accumulates CasADi's timing statistics of
+/// each solve (see recordSolve()).
+class CallbackProfiler {
+public:
+    struct Record {
+        long long numCalls = 0;
+        long long wallTimeNs = 0;
+        /// Units: seconds.
+        double cpuTime = 0;
+        Record& operator+=(const Record& other) {
+            numCalls += other.numCalls;
+            wallTimeNs += other.wallTimeNs;
+            cpuTime += other.cpuTime;
+            return *this;
+        }
+    };
+    /// Records keyed by (callback index, thread index).
+    using Records = std::map<std::pair<int, int>, Record>;
+
+    /// Times a single call and records it when destroyed. This does nothing
+    /// if the profiler is null.
+    class Scope {
+    public:
+        Scope(CallbackProfiler* profiler, int callbackIndex)
+                : m_profiler(profiler), m_callbackIndex(callbackIndex) {
+            if (m_profiler) {
+                m_startWallTimeNs = SimTK::realTimeInNs();
+                m_startCpuTime = SimTK::threadCpuTime();
+            }
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope() {
+            if (m_profiler) {
+                m_profiler->record(m_callbackIndex,
+                        SimTK::realTimeInNs() - m_startWallTimeNs,
+                        SimTK::threadCpuTime() - m_startCpuTime);
+            }
+        }
+    private:
+        CallbackProfiler* m_profiler;
+        int m_callbackIndex;
+        long long m_startWallTimeNs = 0;
+        double m_startCpuTime = 0;
+    };
+
+    CallbackProfiler();
+
+    /// Register a callback by name and obtain the index to use when recording
+    /// calls to it. Registering the same name again returns the same index.
+    int addCallback(const std::string& name);
+    /// Record one call to the callback with the given index from the calling
+    /// thread.
+    void record(int callbackIndex, long long wallTimeNs, double cpuTime);
+    /// Add CasADi's timing statistics (`t_wall_<function>`,
+    /// `t_proc_<function>`, and `n_call_<function>`) from the stats of one
+    /// solve, and the wall-clock time of the whole solve.
+    void recordSolve(const casadi::Dict& stats, long long solveWallTimeNs);
+
+    /// The methods below must not be invoked while callbacks are being
+    /// recorded (e.g., call them after the solve).
+    /// @{
+    const std::vector<std::string>& getCallbackNames() const {
+        return m_callbackNames;
+    }
+    /// The number of distinct threads that have made calls so far.
+    int getNumThreads() const;
+    /// The records so far.
+    Records getRecords() const;
+    /// CasADi's timing statistics, keyed by CasADi function name (e.g.,
+    /// "nlp_f"), summed over all recorded solves.
+    const std::map<std::string, Record>& getSolverRecords() const {
+        return m_solverRecords;
+    }
+    /// The number of recorded solves and their total wall-clock time.
+    const Record& getSolveRecord() const { return m_solveRecord; }
+    /// @}
+
+private:
+    /// Find or create the counters of the calling thread.
+    std::vector<Record>& updThreadRecords();
+
+    /// Distinguishes profilers in the per-thread cache of record().
+    const long long m_id;
+    mutable std::mutex m_mutex;
+    std::vector<std::string> m_callbackNames;
+    std::map<std::thread::id, int> m_threadIndices;
+    /// Indexed by thread index, then by callback index. Each thread writes
+    /// only to its own vector.
+    std::vector<std::unique_ptr<std::vector<Record>>> m_threadRecords;
+    std::map<std::string, Record> m_solverRecords;
+    Record m_solveRecord;
+};
+
 class Function : public casadi::Callback {
 public:
     virtual ~Function() = default;
@@ -66,6 +172,10 @@ public:
 
 protected:
     const Problem* m_casProblem;
+    /// Null unless the problem has a CallbackProfiler. Create a
+    /// CallbackProfiler::Scope with these at the start of eval().
+    CallbackProfiler* m_profiler = nullptr;
+    int m_profilerIndex = -1;
 
 private:
     /// Here, "point" refers to a vector of all variables in the optimization
@@ -345,6 +345,55 @@ public:
     virtual std::vector<std::string>
     createKinematicConstraintEquationNamesImpl() const;
 
+    /// The transcription invokes this with the times of the grid points if
+    /// the initial and final times are fixed, and with an empty vector
+    /// otherwise, so that the problem can precompute quantities needed at
+    /// these times (e.g., reference data for tracking costs).
+    virtual void initializeOnGrid(const std::vector<double>& /*times*/) const {}
+
+    /// @name Interface for changing bounds between solves.
+    /// Use these to change the bounds of variables that were added in the
+    /// constructor, then invoke Transcription::updateVariableBounds() to
+    /// re-solve a transcription of this problem with the new bounds. The
+    /// number and order of the variables cannot change.
+    /// @{
+    void updateTimeBounds(Bounds initial, Bounds final) {
+        setTimeBounds(std::move(initial), std::move(final));
+    }
+    void updateStateBounds(int index, Bounds bounds, Bounds initialBounds,
+            Bounds finalBounds) {
+        clipEndpointBounds(bounds, initialBounds);
+        clipEndpointBounds(bounds, finalBounds);
+        auto& info = m_stateInfos.at(index);
+        info.bounds = std::move(bounds);
+        info.initialBounds = std::move(initialBounds);
+        info.finalBounds = std::move(finalBounds);
+    }
+    void updateControlBounds(int index, Bounds bounds, Bounds initialBounds,
+            Bounds finalBounds) {
+        clipEndpointBounds(bounds, initialBounds);
+        clipEndpointBounds(bounds, finalBounds);
+        auto& info = m_controlInfos.at(index);
+        info.bounds = std::move(bounds);
+        info.initialBounds = std::move(initialBounds);
+        info.finalBounds = std::move(finalBounds);
+    }
+    void updateParameterBounds(int index, Bounds bounds) {
+        m_paramInfos.at(index).bounds = std::move(bounds);
+    }
+    /// @}
+
+    /// Record the number of calls and the time spent in each Function of this
+    /// problem. This must be set before initialize() is invoked; pass nullptr
+    /// to disable profiling (the default).
+    void setCallbackProfiler(std::shared_ptr<CallbackProfiler> profiler) {
+        m_callbackProfiler = std::move(profiler);
+    }
+    /// Returns nullptr if profiling is disabled.
+    CallbackProfiler* getCallbackProfiler() const {
+        return m_callbackProfiler.get();
+    }
+
     void intermediateCallback() const { intermediateCallbackImpl(); }
     void intermediateCallbackWithIterate(const CasOC::Iterate& it) const {
         intermediateCallbackWithIterateImpl(it);
@@ -717,6 +766,7 @@ private:
             m_implicitMultibodyFuncIgnoringConstraints;
     std::unique_ptr<VelocityCorrection> m_velocityCorrectionFunc;
     std::unique_ptr<StateProjection> m_stateProjectionFunc;
+    std::shared_ptr<CallbackProfiler> m_callbackProfiler;
 };
 
 } // namespace CasOC
@@ -116,6 +116,11 @@ void Solver::setParallelism(std::string parallelism, int numThreads) {
 }
 
 Solution Solver::solve(const Iterate& guess) const {
+    return initializeTranscription(guess)->solve(guess);
+}
+
+std::unique_ptr<Transcription> Solver::initializeTranscription(
+        const Iterate& guess) const {
     auto transcription = createTranscription();
     auto pointsForSparsityDetection =
             std::make_shared<std::vector<VariablesDM>>();
@@ -144,7 +149,7 @@ Solution Solver::solve(const Iterate& guess) const {
     m_problem.initialize(m_finite_difference_scheme,
             std::const_pointer_cast<const std::vector<VariablesDM>>(
                     pointsForSparsityDetection));
-    return transcription->solve(guess);
+    return transcription;
 }
 
 } // namespace CasOC
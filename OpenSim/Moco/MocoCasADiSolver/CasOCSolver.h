@@ -210,6 +210,14 @@ public:
 
     Solution solve(const Iterate& guess) const;
 
+    /// Create a transcription of the problem and initialize the problem
+    /// (including sparsity detection, which may use the guess), without
+    /// solving. Use this to solve the same NLP repeatedly with
+    /// Transcription::solve(); this solver and the problem must outlive the
+    /// transcription.
+    std::unique_ptr<Transcription> initializeTranscription(
+            const Iterate& guess) const;
+
 private:
     std::unique_ptr<Transcription> createTranscription() const;
 
@@ -70,6 +70,9 @@ public:
         ++evalCount;
         return {0};
     }
+    /// Invoke this before each solve of a reused NLP so that iterations are
+    /// numbered from 0.
+    void resetIterationCount() { evalCount = 0; }
 
 private:
     const Transcription& m_transcription;
@@ -235,12 +238,85 @@ void Transcription::createVariablesAndSetBounds(const casadi::DM& grid,
     initializeScalingDM(m_shift);
     initializeScalingDM(m_scale);
 
+    setVariableBoundsAndScaling();
+
+    m_unscaledVars = unscaleVariables(m_scaledVars);
+
+    m_duration = m_unscaledVars[final_time] - m_unscaledVars[initial_time];
+    m_times = createTimes(
+            m_unscaledVars[initial_time], m_unscaledVars[final_time]);
+    m_paramsTrajGrid =
+            MX::repmat(m_unscaledVars[parameters], 1, m_numGridPoints);
+    m_paramsTrajMesh =
+            MX::repmat(m_unscaledVars[parameters], 1, m_numMeshPoints);
+    m_paramsTrajMeshInterior =
+            MX::repmat(m_unscaledVars[parameters], 1, m_numMeshInteriorPoints);
+    m_paramsTrajPathCon =
+            MX::repmat(m_unscaledVars[parameters], 1, m_numPathConstraintPoints);
+    m_paramsTrajProjState =
+            MX::repmat(m_unscaledVars[parameters], 1, m_numMeshIntervals);
+
+    casadi_int istart = 0;
+    int numStates = m_problem.getNumStates();
+    for (int imesh = 0; imesh < m_numMeshIntervals; ++imesh) {
+        casadi_int numPts = m_numPointsPerMeshInterval;
+        casadi_int iend = istart + numPts - 1;
+        if (m_numProjectionStates) {
+            // The states at all points in the mesh interval except the last
+            // point are the regular state variables.
+            m_statesByMeshInterval[imesh](Slice(), Slice(0, numPts-1)) =
+                    m_unscaledVars[states](Slice(), Slice(istart, iend));
+
+            // The multibody states at the last point in the mesh interval are
+            // the projection states.
+            m_statesByMeshInterval[imesh]
+                    (Slice(0, m_numProjectionStates), numPts-1) =
+                            m_unscaledVars[projection_states](Slice(), imesh);
+
+            // The non-multibody states at the last point (i.e., auxiliary state
+            // variables for muscles) are also the same as the regular state
+            // variables (there are no projection states for these variables).
+            m_statesByMeshInterval[imesh](
+                    Slice(m_numProjectionStates, numStates), numPts-1) =
+                    m_unscaledVars[states](
+                            Slice(m_numProjectionStates, numStates), iend);
+
+            // Calculate the distance between the regular multibody states and
+            // the projection multibody states.
+            m_projectionStateDistances(Slice(), imesh) =
+                m_unscaledVars[projection_states](Slice(), imesh) -
+                m_unscaledVars[states](Slice(0, m_numProjectionStates), iend);
+        } else {
+            m_statesByMeshInterval[imesh](Slice(), Slice()) =
+                    m_unscaledVars[states](Slice(), Slice(istart, iend+1));
+        }
+        istart = iend;
+    }
+}
+
+void Transcription::setVariableBoundsAndScaling() {
     setVariableBounds(initial_time, 0, 0, m_problem.getTimeInitialBounds());
     setVariableBounds(final_time, 0, 0, m_problem.getTimeFinalBounds());
 
     setVariableScaling(initial_time, 0, 0, m_problem.getTimeInitialBounds());
     setVariableScaling(final_time, 0, 0, m_problem.getTimeFinalBounds());
 
+    // If the initial and final times are fixed, so are the times of the grid
+    // points.
+    {
+        const auto& initialBounds = m_problem.getTimeInitialBounds();
+        const auto& finalBounds = m_problem.getTimeFinalBounds();
+        std::vector<double> gridTimes;
+        if (initialBounds.lower == initialBounds.upper &&
+                finalBounds.lower == finalBounds.upper) {
+            const double duration = finalBounds.lower - initialBounds.lower;
+            for (const double point : m_grid.nonzeros()) {
+                gridTimes.push_back(duration * point + initialBounds.lower);
+            }
+        }
+        m_problem.initializeOnGrid(gridTimes);
+    }
+
     {
         const auto& stateInfos = m_problem.getStateInfos();
         int is = 0;
@@ -332,58 +408,16 @@ void Transcription::createVariablesAndSetBounds(const casadi::DM& grid,
             ++ip;
         }
     }
-    m_unscaledVars = unscaleVariables(m_scaledVars);
-
-    m_duration = m_unscaledVars[final_time] - m_unscaledVars[initial_time];
-    m_times = createTimes(
-            m_unscaledVars[initial_time], m_unscaledVars[final_time]);
-    m_paramsTrajGrid =
-            MX::repmat(m_unscaledVars[parameters], 1, m_numGridPoints);
-    m_paramsTrajMesh =
-            MX::repmat(m_unscaledVars[parameters], 1, m_numMeshPoints);
-    m_paramsTrajMeshInterior =
-            MX::repmat(m_unscaledVars[parameters], 1, m_numMeshInteriorPoints);
-    m_paramsTrajPathCon =
-            MX::repmat(m_unscaledVars[parameters], 1, m_numPathConstraintPoints);
-    m_paramsTrajProjState =
-            MX::repmat(m_unscaledVars[parameters], 1, m_numMeshIntervals);
-
-    casadi_int istart = 0;
-    int numStates = m_problem.getNumStates();
-    for (int imesh = 0; imesh < m_numMeshIntervals; ++imesh) {
-        casadi_int numPts = m_numPointsPerMeshInterval;
-        casadi_int iend = istart + numPts - 1;
-        if (m_numProjectionStates) {
-            // The states at all points in the mesh interval except the last
-            // point are the regular state variables.
-            m_statesByMeshInterval[imesh](Slice(), Slice(0, numPts-1)) =
-                    m_unscaledVars[states](Slice(), Slice(istart, iend));
-
-            // The multibody states at the last point in the mesh interval are
-            // the projection states.
-            m_statesByMeshInterval[imesh]
-                    (Slice(0, m_numProjectionStates), numPts-1) =
-                            m_unscaledVars[projection_states](Slice(), imesh);
-
-            // The non-multibody states at the last point (i.e., auxiliary state
-            // variables for muscles) are also the same as the regular state
-            // variables (there are no projection states for these variables).
-            m_statesByMeshInterval[imesh](
-                    Slice(m_numProjectionStates, numStates), numPts-1) =
-                    m_unscaledVars[states](
-                            Slice(m_numProjectionStates, numStates), iend);
+}
 
-            // Calculate the distance between the regular multibody states and
-            // the projection multibody states.
-            m_projectionStateDistances(Slice(), imesh) =
-                m_unscaledVars[projection_states](Slice(), imesh) -
-                m_unscaledVars[states](Slice(0, m_numProjectionStates), iend);
-        } else {
-            m_statesByMeshInterval[imesh](Slice(), Slice()) =
-                    m_unscaledVars[states](Slice(), Slice(istart, iend+1));
-        }
-        istart = iend;
-    }
+void Transcription::updateVariableBounds() {
+    // The scaled variables are already part of the NLP, so the scaling
+    // must not change even if it was computed from the bounds.
+    const VariablesDM shift = m_shift;
+    const VariablesDM scale = m_scale;
+    setVariableBoundsAndScaling();
+    m_shift = shift;
+    m_scale = scale;
 }
 
 void Transcription::transcribe() {
@@ -930,11 +964,73 @@ void Transcription::setObjectiveAndEndpointConstraints() {
     }
 }
 
+void Transcription::createNlpFunction() {
+    transcribe();
+
+    // Create the CasADi NLP function.
+    // -------------------------------
+    // Option handling is copied from casadi::OptiNode::solver().
+    casadi::Dict options = m_solver.getPluginOptions();
+    if (!options.empty()) {
+        options[m_solver.getOptimSolver()] = m_solver.getSolverOptions();
+    }
+
+    auto x = flattenVariables(m_scaledVars);
+    casadi_int numVariables = x.numel();
+
+    // The m_constraints symbolic vector holds all of the expressions for
+    // the constraint functions.
+    auto g = flattenConstraints(m_constraints);
+    casadi_int numConstraints = g.numel();
+
+    m_callback = OpenSim::make_unique<NlpsolCallback>(*this, m_problem,
+            numVariables, numConstraints, m_solver.getCallbackInterval());
+    options["iteration_callback"] = *m_callback;
+
+    // The inputs to nlpsol() are symbolic (casadi::MX).
+    casadi::MXDict nlp;
+    nlp.emplace(std::make_pair("x", x));
+    // The objective symbolic variable holds an expression graph including
+    // all the calculations performed on the variables x.
+    casadi::MX objective = MX::sum1(m_objectiveTerms);
+    if (m_objectiveTerms.numel() == 0) {
+        objective = 0;
+    }
+    nlp.emplace(std::make_pair("f", objective));
+    nlp.emplace(std::make_pair("g", g));
+    if (!m_solver.getWriteSparsity().empty()) {
+        const auto prefix = m_solver.getWriteSparsity();
+        auto gradient = casadi::MX::gradient(nlp["f"], nlp["x"]);
+        gradient.sparsity().to_file(
+                prefix + "_objective_gradient_sparsity.mtx");
+        auto hessian = casadi::MX::hessian(nlp["f"], nlp["x"]);
+        hessian.sparsity().to_file(prefix + "_objective_Hessian_sparsity.mtx");
+        auto lagrangian = objective +
+                          casadi::MX::dot(casadi::MX::ones(nlp["g"].sparsity()),
+                                  nlp["g"]);
+        auto hessian_lagr = casadi::MX::hessian(lagrangian, nlp["x"]);
+        hessian_lagr.sparsity().to_file(
+                prefix + "_Lagrangian_Hessian_sparsity.mtx");
+        auto jacobian = casadi::MX::jacobian(nlp["g"], nlp["x"]);
+        jacobian.sparsity().to_file(
+                prefix + "constraint_Jacobian_sparsity.mtx");
+    }
+    m_nlpFunc = casadi::nlpsol("nlp", m_solver.getOptimSolver(), nlp, options);
+
+    // These are used to report the objective breakdown and the constraint
+    // values of the solution.
+    m_objectiveFunc = casadi::Function("objective", {x}, {m_objectiveTerms});
+    m_constraintFunc = casadi::Function("constraints", {x}, {g});
+}
+
+Transcription::~Transcription() = default;
+
 Solution Transcription::solve(const Iterate& guessOrig) {
 
     // Define the NLP.
     // ---------------
-    transcribe();
+    // The NLP is built on the first solve and reused by subsequent solves.
+    if (m_nlpFunc.is_null()) { createNlpFunction(); }
 
     // Resample the guess.
     // -------------------
@@ -1017,61 +1113,12 @@ Solution Transcription::solve(const Iterate& guessOrig) {
                 m_numMeshIntervals, projection_states.size2());
     }
 
-    // Create the CasADi NLP function.
-    // -------------------------------
-    // Option handling is copied from casadi::OptiNode::solver().
-    casadi::Dict options = m_solver.getPluginOptions();
-    if (!options.empty()) {
-        options[m_solver.getOptimSolver()] = m_solver.getSolverOptions();
-    }
-
-    auto x = flattenVariables(m_scaledVars);
-    casadi_int numVariables = x.numel();
-
-    // The m_constraints symbolic vector holds all of the expressions for
-    // the constraint functions.
-    auto g = flattenConstraints(m_constraints);
-    casadi_int numConstraints = g.numel();
-
-    NlpsolCallback callback(*this, m_problem, numVariables, numConstraints,
-            m_solver.getCallbackInterval());
-    options["iteration_callback"] = callback;
-
-    // The inputs to nlpsol() are symbolic (casadi::MX).
-    casadi::MXDict nlp;
-    nlp.emplace(std::make_pair("x", x));
-    // The objective symbolic variable holds an expression graph including
-    // all the calculations performed on the variables x.
-    casadi::MX objective = MX::sum1(m_objectiveTerms);
-    if (m_objectiveTerms.numel() == 0) {
-        objective = 0;
-    }
-    nlp.emplace(std::make_pair("f", objective));
-    nlp.emplace(std::make_pair("g", g));
-    if (!m_solver.getWriteSparsity().empty()) {
-        const auto prefix = m_solver.getWriteSparsity();
-        auto gradient = casadi::MX::gradient(nlp["f"], nlp["x"]);
-        gradient.sparsity().to_file(
-                prefix + "_objective_gradient_sparsity.mtx");
-        auto hessian = casadi::MX::hessian(nlp["f"], nlp["x"]);
-        hessian.sparsity().to_file(prefix + "_objective_Hessian_sparsity.mtx");
-        auto lagrangian = objective +
-                          casadi::MX::dot(casadi::MX::ones(nlp["g"].sparsity()),
-                                  nlp["g"]);
-        auto hessian_lagr = casadi::MX::hessian(lagrangian, nlp["x"]);
-        hessian_lagr.sparsity().to_file(
-                prefix + "_Lagrangian_Hessian_sparsity.mtx");
-        auto jacobian = casadi::MX::jacobian(nlp["g"], nlp["x"]);
-        jacobian.sparsity().to_file(
-                prefix + "constraint_Jacobian_sparsity.mtx");
-    }
-    const casadi::Function nlpFunc =
-            casadi::nlpsol("nlp", m_solver.getOptimSolver(), nlp, options);
+    m_callback->resetIterationCount();
 
     // Run the optimization (evaluate the CasADi NLP function).
     // --------------------------------------------------------
     // The inputs and outputs of nlpFunc are numeric (casadi::DM).
-    const casadi::DMDict nlpResult = nlpFunc(casadi::DMDict{
+    const casadi::DMDict nlpResult = m_nlpFunc(casadi::DMDict{
                     {"x0", flattenVariables(scaleVariables(guess.variables))},
                     {"lbx", flattenVariables(scaleVariables(m_lowerBounds))},
                     {"ubx", flattenVariables(scaleVariables(m_upperBounds))},
@@ -1086,14 +1133,13 @@ Solution Transcription::solve(const Iterate& guessOrig) {
     solution.objective = nlpResult.at("f").scalar();
 
     casadi::DMVector finalVarsDMV{finalVariables};
-    casadi::Function objectiveFunc("objective", {x}, {m_objectiveTerms});
     casadi::DMVector objectiveOut;
-    objectiveFunc.call(finalVarsDMV, objectiveOut);
+    m_objectiveFunc.call(finalVarsDMV, objectiveOut);
     solution.objective_breakdown = expandObjectiveTerms(objectiveOut[0]);
 
     solution.times = createTimes(
             solution.variables[initial_time], solution.variables[final_time]);
-    solution.stats = nlpFunc.stats();
+    solution.stats = m_nlpFunc.stats();
 
     // Print breakdown of objective.
     printObjectiveBreakdown(solution, objectiveOut[0]);
@@ -1102,9 +1148,8 @@ Solution Transcription::solve(const Iterate& guessOrig) {
 
         // For some reason, nlpResult.at("g") is all 0. So we calculate the
         // constraints ourselves.
-        casadi::Function constraintFunc("constraints", {x}, {g});
         casadi::DMVector constraintsOut;
-        constraintFunc.call(finalVarsDMV, constraintsOut);
+        m_constraintFunc.call(finalVarsDMV, constraintsOut);
         printConstraintValues(solution, expandConstraints(constraintsOut[0]));
     }
     return solution;
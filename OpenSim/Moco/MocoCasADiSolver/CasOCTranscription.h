@@ -22,6 +22,8 @@
 
 namespace CasOC {
 
+class NlpsolCallback;
+
 /// This is the base class for transcription schemes that convert a
 /// CasOC::Problem into a general nonlinear programming problem. If you are
 /// creating a new derived class, make sure to override all virtual functions
@@ -30,7 +32,7 @@ class Transcription {
 public:
     Transcription(const Solver& solver, const Problem& problem)
             : m_solver(solver), m_problem(problem) {}
-    virtual ~Transcription() = default;
+    virtual ~Transcription();
     Iterate createInitialGuessFromBounds() const;
     /// Use the provided random number generator to generate an iterate.
     /// Random::Uniform is used if a generator is not provided. The generator
@@ -62,8 +64,21 @@ public:
         return meshIndices;
     }
 
+    /// The NLP (including the CasADi nlpsol Function) is created on the
+    /// first invocation, and subsequent invocations solve the same NLP with
+    /// the given guess and the current variable bounds. Any change to the
+    /// problem other than the variable bounds (see updateVariableBounds())
+    /// or the values computed by the problem's callbacks (e.g., goal
+    /// weights) requires a new Transcription.
     Solution solve(const Iterate& guessOrig);
 
+    /// Read the variable bounds from the problem again (e.g., after
+    /// Problem::updateStateBounds()) for use in the next solve(). If the
+    /// initial and final times become fixed, the problem is initialized on
+    /// the new grid times. The scaling of the variables is not changed, even
+    /// if Solver::getScaleVariablesUsingBounds() is true.
+    void updateVariableBounds();
+
 protected:
     /// This must be called in the constructor of derived classes so that
     /// overridden virtual methods are accessible to the base class. This
@@ -203,6 +218,11 @@ private:
     Constraints<casadi::DM> m_constraintsLowerBounds;
     Constraints<casadi::DM> m_constraintsUpperBounds;
 
+    std::unique_ptr<NlpsolCallback> m_callback;
+    casadi::Function m_nlpFunc;
+    casadi::Function m_objectiveFunc;
+    casadi::Function m_constraintFunc;
+
 private:
     /// Override this function in your derived class to compute a vector of
     /// quadrature coeffecients (of length m_numGridPoints) required to set the
@@ -223,7 +243,9 @@ private:
                 "Must provide constraints for interpolating controls.")
     }
 
+    void setVariableBoundsAndScaling();
     void transcribe();
+    void createNlpFunction();
     void setObjectiveAndEndpointConstraints();
     void calcDefects() {
         calcDefectsImpl(m_statesByMeshInterval,
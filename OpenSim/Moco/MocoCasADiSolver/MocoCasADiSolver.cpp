@@ -20,13 +20,17 @@
 
 #include <OpenSim/Common/Assertion.h>
 #include <OpenSim/Moco/MocoUtilities.h>
+#include <algorithm>
+#include <cmath>
 
 #ifdef OPENSIM_WITH_CASADI
     #include "CasOCSolver.h"
+    #include "CasOCTranscription.h"
     #include "MocoCasOCProblem.h"
     #include <casadi/casadi.hpp>
 
     #include <OpenSim/Common/Stopwatch.h>
+    #include <numeric>
 
     using casadi::Callback;
     using casadi::Dict;
@@ -38,6 +42,79 @@
 
 using namespace OpenSim;
 
+#ifdef OPENSIM_WITH_CASADI
+namespace {
+/// Log a breakdown of the time spent in each callback and in CasADi/the
+/// optimizer over all solves recorded by the profiler, and return the same
+/// information as CSV.
+std::string reportCallbackProfile(const CasOC::CallbackProfiler& profiler) {
+    using Record = CasOC::CallbackProfiler::Record;
+    const auto& names = profiler.getCallbackNames();
+    const auto records = profiler.getRecords();
+
+    std::vector<Record> totals(names.size());
+    std::vector<Record> threadTotals(profiler.getNumThreads());
+    for (const auto& entry : records) {
+        totals[entry.first.first] += entry.second;
+        threadTotals[entry.first.second] += entry.second;
+    }
+    std::vector<int> order(names.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return totals[a].wallTimeNs > totals[b].wallTimeNs;
+    });
+
+    std::stringstream csv;
+    csv << "callback,thread,num_calls,wall_time,cpu_time\n";
+    const auto writeRow = [&](const std::string& name,
+                                  const std::string& thread, const Record& r) {
+        csv << name << "," << thread << "," << r.numCalls << ","
+            << SimTK::nsToSec(r.wallTimeNs) << "," << r.cpuTime << "\n";
+    };
+
+    log_info(std::string(72, '-'));
+    log_info("Callback profile (sorted by total wall time):");
+    log_info("{:<42} {:>10} {:>9} {:>9}", "callback", "calls", "wall (s)",
+            "cpu (s)");
+    for (int i : order) {
+        const Record& r = totals[i];
+        log_info("{:<42} {:>10} {:>9.3f} {:>9.3f}", names[i], r.numCalls,
+                SimTK::nsToSec(r.wallTimeNs), r.cpuTime);
+        writeRow(names[i], "all", r);
+        for (int ithread = 0; ithread < (int)threadTotals.size(); ++ithread) {
+            const auto it = records.find({i, ithread});
+            if (it != records.end()) {
+                writeRow(names[i], std::to_string(ithread), it->second);
+            }
+        }
+    }
+    log_info("Callback time per thread:");
+    for (int ithread = 0; ithread < (int)threadTotals.size(); ++ithread) {
+        const Record& r = threadTotals[ithread];
+        log_info("  thread {:>3}: {:>10} calls, {:>9.3f} s wall, {:>9.3f} s cpu",
+                ithread, r.numCalls, SimTK::nsToSec(r.wallTimeNs), r.cpuTime);
+        writeRow("all_callbacks", std::to_string(ithread), r);
+    }
+
+    // CasADi's timing statistics for the NLP functions it evaluates (which
+    // wrap the callbacks above) and for the whole solve, including the time
+    // spent inside the optimizer (e.g., IPOPT's linear algebra).
+    log_info("CasADi/optimizer timing:");
+    for (const auto& entry : profiler.getSolverRecords()) {
+        const Record& r = entry.second;
+        log_info("  {:<40} {:>10} {:>9.3f} {:>9.3f}", entry.first, r.numCalls,
+                SimTK::nsToSec(r.wallTimeNs), r.cpuTime);
+        writeRow("casadi_" + entry.first, "all", r);
+    }
+    // With mesh refinement, there is one solve per refinement iteration.
+    Record solve = profiler.getSolveRecord();
+    solve.cpuTime = std::numeric_limits<double>::quiet_NaN();
+    writeRow("solve", "all", solve);
+    return csv.str();
+}
+} // anonymous namespace
+#endif
+
 MocoCasADiSolver::MocoCasADiSolver() { constructProperties(); }
 
 void MocoCasADiSolver::constructProperties() {
@@ -47,6 +124,10 @@ void MocoCasADiSolver::constructProperties() {
     constructProperty_optim_write_sparsity("");
     constructProperty_optim_finite_difference_scheme("central");
     constructProperty_parallel();
+    constructProperty_profile_callbacks(false);
+    constructProperty_mesh_refinement_max_iterations(0);
+    constructProperty_mesh_refinement_tolerance(1e-3);
+    constructProperty_mesh_refinement_max_mesh_intervals(500);
     constructProperty_output_interval(0);
 
     constructProperty_minimize_implicit_multibody_accelerations(false);
@@ -354,7 +435,244 @@ std::unique_ptr<CasOC::Solver> MocoCasADiSolver::createCasOCSolver(
 #endif
 }
 
+std::vector<double> MocoCasADiSolver::estimateMeshIntervalErrors(
+        const MocoTrajectory& trajectory, const std::vector<double>& mesh) {
+    OPENSIM_THROW_IF(mesh.size() < 2, Exception,
+            "Expected the mesh to contain at least 2 points, but it contains "
+            "{}.", mesh.size());
+    const int numIntervals = (int)mesh.size() - 1;
+    std::vector<double> errors(numIntervals, 0.0);
+    const int numTimes = trajectory.getNumTimes();
+    const int numStates = (int)trajectory.getStateNames().size();
+    if (numTimes < 3 || numStates == 0) return errors;
+
+    const auto& time = trajectory.getTime();
+    const auto& states = trajectory.getStatesTrajectory();
+    const double initialTime = time[0];
+    const double duration = time[numTimes - 1] - initialTime;
+
+    std::vector<double> scale(numStates);
+    for (int j = 0; j < numStates; ++j) {
+        scale[j] = 1.0 + SimTK::max(SimTK::abs(states.col(j)));
+    }
+
+    // Largest normalized second divided difference at each time point. The
+    // first and last time points use the values of their neighbors.
+    std::vector<double> curvature(numTimes, 0.0);
+    for (int i = 1; i < numTimes - 1; ++i) {
+        const double hLeft = time[i] - time[i - 1];
+        const double hRight = time[i + 1] - time[i];
+        if (hLeft <= 0 || hRight <= 0) continue;
+        for (int j = 0; j < numStates; ++j) {
+            const double slopeLeft = (states(i, j) - states(i - 1, j)) / hLeft;
+            const double slopeRight =
+                    (states(i + 1, j) - states(i, j)) / hRight;
+            const double secondDiff =
+                    2.0 * (slopeRight - slopeLeft) / (hLeft + hRight);
+            curvature[i] =
+                    std::max(curvature[i], std::abs(secondDiff) / scale[j]);
+        }
+    }
+    curvature[0] = curvature[1];
+    curvature[numTimes - 1] = curvature[numTimes - 2];
+
+    int itime = 0;
+    for (int k = 0; k < numIntervals; ++k) {
+        const double start = initialTime + mesh[k] * duration;
+        const double end = initialTime + mesh[k + 1] * duration;
+        const double tol = SimTK::SignificantReal * (1.0 + std::abs(end));
+        while (itime < numTimes - 1 && time[itime + 1] < start - tol) {
+            ++itime;
+        }
+        double maxCurvature = 0;
+        for (int i = itime; i < numTimes && time[i] <= end + tol; ++i) {
+            if (time[i] >= start - tol) {
+                maxCurvature = std::max(maxCurvature, curvature[i]);
+            }
+        }
+        const double h = end - start;
+        errors[k] = h * h * maxCurvature / 8.0;
+    }
+    return errors;
+}
+
+std::vector<double> MocoCasADiSolver::refineMesh(
+        const std::vector<double>& mesh, const std::vector<double>& errors,
+        double tolerance, int maxMeshIntervals) {
+    OPENSIM_THROW_IF(errors.size() + 1 != mesh.size(), Exception,
+            "Expected {} interval errors for a mesh with {} points, but got "
+            "{}.", mesh.size() - 1, mesh.size(), errors.size());
+    OPENSIM_THROW_IF(tolerance <= 0, Exception,
+            "Expected the tolerance to be positive, but got {}.", tolerance);
+    std::vector<double> refined;
+    refined.reserve(mesh.size());
+    refined.push_back(mesh[0]);
+    for (int k = 0; k < (int)errors.size(); ++k) {
+        int numSubintervals = 1;
+        if (errors[k] > tolerance) {
+            numSubintervals = std::min(4,
+                    (int)std::ceil(std::sqrt(errors[k] / tolerance)));
+            numSubintervals = std::max(2, numSubintervals);
+        }
+        const double h = mesh[k + 1] - mesh[k];
+        for (int i = 1; i < numSubintervals; ++i) {
+            refined.push_back(mesh[k] + i * h / numSubintervals);
+        }
+        refined.push_back(mesh[k + 1]);
+    }
+    if ((int)refined.size() - 1 > maxMeshIntervals) return mesh;
+    return refined;
+}
+
 MocoSolution MocoCasADiSolver::solveImpl() const {
+#ifdef OPENSIM_WITH_CASADI
+    if (get_mesh_refinement_max_iterations() > 0) {
+        return solveWithMeshRefinement();
+    }
+    return solveOnMesh({}, getGuess());
+#else
+    OPENSIM_THROW(MocoCasADiSolverNotAvailable);
+#endif
+}
+
+MocoSolution MocoCasADiSolver::solveWithMeshRefinement() const {
+#ifdef OPENSIM_WITH_CASADI
+    checkPropertyValueIsInRangeOrSet(getProperty_mesh_refinement_tolerance(),
+            SimTK::SignificantReal, SimTK::NTraits<double>::getInfinity(), {});
+    checkPropertyValueIsInRangeOrSet(
+            getProperty_mesh_refinement_max_mesh_intervals(), 1,
+            std::numeric_limits<int>::max(), {});
+    const Stopwatch stopwatch;
+    const double tolerance = get_mesh_refinement_tolerance();
+
+    std::vector<double> mesh;
+    if (getProperty_mesh().size() > 0) {
+        for (int i = 0; i < getProperty_mesh().size(); ++i) {
+            mesh.push_back(get_mesh(i));
+        }
+    } else {
+        const int numMeshIntervals = get_num_mesh_intervals();
+        OPENSIM_THROW_IF_FRMOBJ(numMeshIntervals < 1, Exception,
+                "Mesh refinement requires at least 1 initial mesh interval.");
+        for (int i = 0; i <= numMeshIntervals; ++i) {
+            mesh.push_back(i / (double)numMeshIntervals);
+        }
+    }
+
+    // Accumulate the callback profile over all refinement iterations.
+    std::shared_ptr<CasOC::CallbackProfiler> profiler;
+    if (get_profile_callbacks()) {
+        profiler = std::make_shared<CasOC::CallbackProfiler>();
+    }
+
+    MocoTrajectory guess = getGuess();
+    MocoSolution solution;
+    int totalIterations = 0;
+    long long gridPointEvaluations = 0;
+    std::vector<double> previousMesh;
+    for (int iteration = 0;; ++iteration) {
+        MocoSolution attempt = solveOnMesh(mesh, guess, profiler);
+        if (!attempt && iteration > 0) {
+            // Keep the solution from the previous (coarser) mesh, which is
+            // better than no solution.
+            log_warn("MocoCasADiSolver: the solve on the refined mesh with {} "
+                     "mesh intervals failed (status: {}); returning the "
+                     "solution from the previous mesh with {} mesh "
+                     "intervals.",
+                    mesh.size() - 1, attempt.getStatus(),
+                    previousMesh.size() - 1);
+            totalIterations += attempt.getNumIterations();
+            gridPointEvaluations += (long long)attempt.getNumIterations() *
+                                    attempt.getNumTimes();
+            mesh = std::move(previousMesh);
+            break;
+        }
+        solution = std::move(attempt);
+        if (!solution) break;
+        totalIterations += solution.getNumIterations();
+        // Each NLP iteration evaluates the model at every grid point (at
+        // least once).
+        gridPointEvaluations += (long long)solution.getNumIterations() *
+                                solution.getNumTimes();
+
+        const auto errors = estimateMeshIntervalErrors(solution, mesh);
+        const double maxError =
+                *std::max_element(errors.begin(), errors.end());
+        const auto numAboveTolerance = std::count_if(errors.begin(),
+                errors.end(), [&](double e) { return e > tolerance; });
+        if (get_verbosity()) {
+            log_info("Mesh refinement iteration {}: {} mesh intervals, "
+                     "max. estimated error {:.3e}, {} intervals above "
+                     "tolerance.",
+                    iteration, mesh.size() - 1, maxError, numAboveTolerance);
+        }
+        if (numAboveTolerance == 0) break;
+        if (iteration == get_mesh_refinement_max_iterations()) {
+            log_warn("MocoCasADiSolver: reached the maximum number of mesh "
+                     "refinement iterations ({}) with {} mesh intervals "
+                     "above the tolerance.",
+                    iteration, numAboveTolerance);
+            break;
+        }
+        auto refined = refineMesh(mesh, errors, tolerance,
+                get_mesh_refinement_max_mesh_intervals());
+        if (refined.size() == mesh.size()) {
+            log_warn("MocoCasADiSolver: stopping mesh refinement, since the "
+                     "refined mesh would exceed {} mesh intervals.",
+                    get_mesh_refinement_max_mesh_intervals());
+            break;
+        }
+        previousMesh = std::move(mesh);
+        mesh = std::move(refined);
+        guess = solution;
+    }
+
+    if (solution) {
+        std::vector<std::pair<std::string, double>> objectiveBreakdown;
+        for (const auto& name : solution.getObjectiveTermNames()) {
+            objectiveBreakdown.emplace_back(
+                    name, solution.getObjectiveTerm(name));
+        }
+        const long long elapsed = stopwatch.getElapsedTimeInNs();
+        setSolutionStats(solution, true, solution.getObjective(),
+                solution.getStatus(), totalIterations,
+                SimTK::nsToSec(elapsed), objectiveBreakdown);
+
+        double minInterval = SimTK::Infinity;
+        for (int k = 0; k < (int)mesh.size() - 1; ++k) {
+            minInterval = std::min(minInterval, mesh[k + 1] - mesh[k]);
+        }
+        const int numUniformIntervals =
+                (int)std::ceil(1.0 / minInterval - SimTK::SqrtEps);
+        if (get_verbosity()) {
+            log_info(std::string(72, '-'));
+            log_info("Mesh refinement finished with {} mesh intervals in {}.",
+                    mesh.size() - 1, stopwatch.formatNs(elapsed));
+            log_info("Grid-point evaluations over all refinement iterations "
+                     "(NLP iterations x grid points): {}.",
+                    gridPointEvaluations);
+            log_info("A uniform mesh with the same finest resolution would "
+                     "have {} mesh intervals ({} vs. {} grid points per NLP "
+                     "iteration).",
+                    numUniformIntervals,
+                    (long long)solution.getNumTimes() * numUniformIntervals /
+                            ((int)mesh.size() - 1),
+                    solution.getNumTimes());
+            log_info(std::string(72, '-'));
+        }
+    }
+    if (profiler) {
+        setSolutionProfile(solution, reportCallbackProfile(*profiler));
+    }
+    return solution;
+#else
+    OPENSIM_THROW(MocoCasADiSolverNotAvailable);
+#endif
+}
+
+MocoSolution MocoCasADiSolver::solveOnMesh(const std::vector<double>& mesh,
+        const MocoTrajectory& guess,
+        std::shared_ptr<CasOC::CallbackProfiler> profiler) const {
 #ifdef OPENSIM_WITH_CASADI
     const Stopwatch stopwatch;
 
@@ -366,36 +684,85 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
         getProblemRep().printDescription();
     }
     auto casProblem = createCasOCProblem();
+    // Report the profile here only if the caller is not accumulating it.
+    const bool reportProfile = !profiler && get_profile_callbacks();
+    if (reportProfile) {
+        profiler = std::make_shared<CasOC::CallbackProfiler>();
+    }
+    if (profiler) casProblem->setCallbackProfiler(profiler);
     auto casSolver = createCasOCSolver(*casProblem);
+    if (!mesh.empty()) casSolver->setMesh(mesh);
     if (get_verbosity()) {
         log_info("Number of threads: {}", casProblem->getJarSize());
     }
 
-    std::vector<int> inputControlIndexes =
-            getProblemRep().getInputControlIndexes();
-    MocoTrajectory guess = getGuess();
-    CasOC::Iterate casGuess;
-    if (guess.empty()) {
-        casGuess = casSolver->createInitialGuessFromBounds();
-    } else {
-        std::vector<std::string> expectedSlackNames;
-        for (const auto& info : casProblem->getSlackInfos()) {
-            expectedSlackNames.push_back(info.name);
+    const CasOC::Iterate casGuess =
+            createCasOCGuess(*casProblem, *casSolver, guess);
+
+    std::unique_ptr<CasOC::Transcription> transcription;
+    CasOC::Solution casSolution;
+    MocoSolution mocoSolution = solveTranscription(
+            *casSolver, transcription, casGuess, casSolution);
+
+    const long long elapsed = stopwatch.getElapsedTimeInNs();
+    setSolutionStats(mocoSolution, casSolution.stats.at("success"),
+            casSolution.objective, casSolution.stats.at("return_status"),
+            casSolution.stats.at("iter_count"), SimTK::nsToSec(elapsed),
+            casSolution.objective_breakdown);
+    if (profiler) profiler->recordSolve(casSolution.stats, elapsed);
+    if (reportProfile) {
+        // The profile is logged even if verbosity is 0, since the user
+        // requested it explicitly.
+        setSolutionProfile(mocoSolution, reportCallbackProfile(*profiler));
+    }
+
+    if (get_verbosity()) {
+        log_info(std::string(72, '-'));
+        log_info("Elapsed real time: {}.", stopwatch.formatNs(elapsed));
+        log_info(getFormattedDateTime(false, "%c"));
+        if (mocoSolution) {
+            log_info("MocoCasADiSolver succeeded!");
+        } else {
+            log_warn("MocoCasADiSolver did NOT succeed:");
+            log_warn("  {}", mocoSolution.getStatus());
         }
-        // We do not need to append projection states here since they will be
-        // appended later when the guess is resampled by the solver (if needed).
-        bool appendProjectionStates = false;
-        casGuess = convertToCasOCIterate(guess, expectedSlackNames,
-                appendProjectionStates, inputControlIndexes);
+        log_info(std::string(72, '='));
     }
+    return mocoSolution;
+#else
+    OPENSIM_THROW(MocoCasADiSolverNotAvailable);
+#endif
+}
 
+#ifdef OPENSIM_WITH_CASADI
+CasOC::Iterate MocoCasADiSolver::createCasOCGuess(
+        const MocoCasOCProblem& casProblem, const CasOC::Solver& casSolver,
+        const MocoTrajectory& guess) const {
+    if (guess.empty()) { return casSolver.createInitialGuessFromBounds(); }
+    std::vector<std::string> expectedSlackNames;
+    for (const auto& info : casProblem.getSlackInfos()) {
+        expectedSlackNames.push_back(info.name);
+    }
+    // We do not need to append projection states here since they will be
+    // appended later when the guess is resampled by the solver (if needed).
+    bool appendProjectionStates = false;
+    return convertToCasOCIterate(guess, expectedSlackNames,
+            appendProjectionStates, getProblemRep().getInputControlIndexes());
+}
+
+MocoSolution MocoCasADiSolver::solveTranscription(
+        const CasOC::Solver& casSolver,
+        std::unique_ptr<CasOC::Transcription>& transcription,
+        const CasOC::Iterate& casGuess, CasOC::Solution& casSolution) const {
     // Temporarily disable printing of negative muscle force warnings so the
     // log isn't flooded while computing finite differences.
     Logger::Level origLoggerLevel = Logger::getLevel();
     Logger::setLevel(Logger::Level::Warn);
-    CasOC::Solution casSolution;
     try {
-        casSolution = casSolver->solve(casGuess);
+        if (!transcription) {
+            transcription = casSolver.initializeTranscription(casGuess);
+        }
+        casSolution = transcription->solve(casGuess);
     } catch(const Exception& ex) {
         OPENSIM_THROW_FRMOBJ(Exception,
             fmt::format("MocoCasADiSolver failed internally with message: {}",
@@ -410,7 +777,7 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
     OpenSim::Logger::setLevel(origLoggerLevel);
 
     MocoSolution mocoSolution = convertToMocoTrajectory<MocoSolution>(
-            casSolution, inputControlIndexes);
+            casSolution, getProblemRep().getInputControlIndexes());
 
     // If enforcing model constraints and not minimizing Lagrange multipliers,
     // check the rank of the constraint Jacobian and if rank-deficient, print
@@ -421,24 +788,163 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
         checkConstraintJacobianRank(mocoSolution);
     }
     checkSlackVariables(mocoSolution);
+    return mocoSolution;
+}
+#endif
+
+// ============================================================================
+// MocoCasADiSession
+// ============================================================================
+
+#ifdef OPENSIM_WITH_CASADI
+class MocoCasADiSession::Impl {
+public:
+    std::unique_ptr<MocoCasOCProblem> casProblem;
+    std::unique_ptr<CasOC::Solver> casSolver;
+    // Created by the first solve.
+    std::unique_ptr<CasOC::Transcription> transcription;
+    CasOC::Iterate guess;
+    bool boundsChanged = false;
+};
+
+namespace {
+template <typename Info>
+int findInfoIndex(const std::vector<Info>& infos, const std::string& name,
+        const std::string& description) {
+    for (int i = 0; i < (int)infos.size(); ++i) {
+        if (infos[i].name == name) { return i; }
+    }
+    OPENSIM_THROW(Exception, "No {} variable with name '{}' found.",
+            description, name);
+}
+} // anonymous namespace
+#else
+class MocoCasADiSession::Impl {};
+#endif
+
+MocoCasADiSession::MocoCasADiSession(const MocoCasADiSolver& solver)
+        : m_solver(solver), m_impl(OpenSim::make_unique<Impl>()) {
+#ifdef OPENSIM_WITH_CASADI
+    if (solver.get_mesh_refinement_max_iterations() > 0) {
+        log_warn("MocoCasADiSession does not perform mesh refinement; "
+                 "ignoring 'mesh_refinement_max_iterations'.");
+    }
+    // The problem may have been edited (e.g., goals added) since the solver
+    // was initialized.
+    solver.recreateProblemRep();
+    m_impl->casProblem = solver.createCasOCProblem();
+    m_impl->casSolver = solver.createCasOCSolver(*m_impl->casProblem);
+    m_impl->guess = solver.createCasOCGuess(
+            *m_impl->casProblem, *m_impl->casSolver, solver.getGuess());
+#else
+    OPENSIM_THROW(MocoCasADiSolverNotAvailable);
+#endif
+}
+
+MocoCasADiSession::~MocoCasADiSession() = default;
+
+void MocoCasADiSession::setTimeBounds(
+        const MocoInitialBounds& initial, const MocoFinalBounds& final) {
+#ifdef OPENSIM_WITH_CASADI
+    m_impl->casProblem->updateTimeBounds(
+            convertBounds(initial), convertBounds(final));
+    m_impl->boundsChanged = true;
+#endif
+}
+
+void MocoCasADiSession::setStateInfo(const std::string& name,
+        const MocoBounds& bounds, const MocoInitialBounds& init,
+        const MocoFinalBounds& final) {
+#ifdef OPENSIM_WITH_CASADI
+    auto& casProblem = *m_impl->casProblem;
+    const int index =
+            findInfoIndex(casProblem.getStateInfos(), name, "state");
+    casProblem.updateStateBounds(index, convertBounds(bounds),
+            convertBounds(init), convertBounds(final));
+    m_impl->boundsChanged = true;
+#endif
+}
+
+void MocoCasADiSession::setControlInfo(const std::string& name,
+        const MocoBounds& bounds, const MocoInitialBounds& init,
+        const MocoFinalBounds& final) {
+#ifdef OPENSIM_WITH_CASADI
+    auto& casProblem = *m_impl->casProblem;
+    const int index =
+            findInfoIndex(casProblem.getControlInfos(), name, "control");
+    casProblem.updateControlBounds(index, convertBounds(bounds),
+            convertBounds(init), convertBounds(final));
+    m_impl->boundsChanged = true;
+#endif
+}
+
+void MocoCasADiSession::setParameterBounds(
+        const std::string& name, const MocoBounds& bounds) {
+#ifdef OPENSIM_WITH_CASADI
+    auto& casProblem = *m_impl->casProblem;
+    const int index = findInfoIndex(
+            casProblem.getParameterInfos(), name, "parameter");
+    casProblem.updateParameterBounds(index, convertBounds(bounds));
+    m_impl->boundsChanged = true;
+#endif
+}
+
+void MocoCasADiSession::setCostWeight(const std::string& name, double weight) {
+#ifdef OPENSIM_WITH_CASADI
+    // Throws if there is no such cost.
+    m_solver.getProblemRep().getCost(name);
+    m_impl->casProblem->setCostWeight(name, weight);
+#endif
+}
+
+void MocoCasADiSession::setPrescribedKinematics(
+        const PositionMotion& positionMotion) {
+#ifdef OPENSIM_WITH_CASADI
+    // Keep the solver's MocoProblemRep consistent with the session's.
+    m_solver.getProblemRep().updatePrescribedKinematics(positionMotion);
+    m_impl->casProblem->updatePrescribedKinematics(positionMotion);
+#endif
+}
+
+void MocoCasADiSession::setGuess(const MocoTrajectory& guess) {
+#ifdef OPENSIM_WITH_CASADI
+    m_solver.checkGuess(guess);
+    m_impl->guess = m_solver.createCasOCGuess(
+            *m_impl->casProblem, *m_impl->casSolver, guess);
+#endif
+}
+
+MocoSolution MocoCasADiSession::solve() {
+#ifdef OPENSIM_WITH_CASADI
+    const Stopwatch stopwatch;
+    auto& impl = *m_impl;
+    // The first solve reads the bounds when creating the transcription.
+    if (impl.transcription && impl.boundsChanged) {
+        impl.transcription->updateVariableBounds();
+    }
+    impl.boundsChanged = false;
+
+    CasOC::Solution casSolution;
+    MocoSolution mocoSolution = m_solver.solveTranscription(
+            *impl.casSolver, impl.transcription, impl.guess, casSolution);
+    ++m_numSolves;
 
     const long long elapsed = stopwatch.getElapsedTimeInNs();
-    setSolutionStats(mocoSolution, casSolution.stats.at("success"),
-            casSolution.objective, casSolution.stats.at("return_status"),
+    MocoCasADiSolver::setSolutionStats(mocoSolution,
+            casSolution.stats.at("success"), casSolution.objective,
+            casSolution.stats.at("return_status"),
             casSolution.stats.at("iter_count"), SimTK::nsToSec(elapsed),
             casSolution.objective_breakdown);
+    if (m_solver.get_verbosity()) {
+        log_info("MocoCasADiSession solve {} {} in {} ({} iterations).",
+                m_numSolves, mocoSolution ? "succeeded" : "did NOT succeed",
+                stopwatch.formatNs(elapsed), mocoSolution.getNumIterations());
+    }
 
-    if (get_verbosity()) {
-        log_info(std::string(72, '-'));
-        log_info("Elapsed real time: {}.", stopwatch.formatNs(elapsed));
-        log_info(getFormattedDateTime(false, "%c"));
-        if (mocoSolution) {
-            log_info("MocoCasADiSolver succeeded!");
-        } else {
-            log_warn("MocoCasADiSolver did NOT succeed:");
-            log_warn("  {}", mocoSolution.getStatus());
-        }
-        log_info(std::string(72, '='));
+    // Start the next solve from this solution.
+    if (mocoSolution) {
+        impl.guess = m_solver.createCasOCGuess(
+                *impl.casProblem, *impl.casSolver, mocoSolution);
     }
     return mocoSolution;
 #else
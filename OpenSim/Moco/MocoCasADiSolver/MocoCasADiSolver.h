@@ -21,13 +21,17 @@
 #include <OpenSim/Moco/MocoDirectCollocationSolver.h>
 
 namespace CasOC {
+class CallbackProfiler;
 class Solver;
+class Transcription;
+struct Iterate;
 struct Solution;
 } // namespace CasOC
 
 namespace OpenSim {
 
 class MocoCasOCProblem;
+class PositionMotion;
 
 class MocoCasADiSolverNotAvailable : public Exception {
 public:
@@ -99,6 +103,52 @@ not affect the solution. We encourage you to use the environment variable
 instead, as this allows different users to solve the same problem with the
 parallelization they prefer.
 
+Profiling
+=========
+To find out where a long solve spends its time, enable the
+`profile_callbacks` property. The solver then records how many times each
+CasADi callback was evaluated (including evaluations for finite differences)
+and the wall-clock and CPU time spent in each, per thread. Callbacks are named
+after the goals and constraints they evaluate (e.g., `cost_<goal>_integrand`,
+`path_constraint_<constraint>`, `explicit_multibody_system`). The time spent
+by CasADi and the optimizer itself (e.g., IPOPT's linear algebra) is reported
+from CasADi's own timing statistics. The breakdown is logged at the end of
+solve() and is available through MocoSolution::getSolverProfile(); MocoStudy
+writes it next to the solution file when `write_solution` is enabled. With
+mesh refinement, the profile covers all refinement iterations. Each thread
+accumulates into its own counters, so profiling adds little more than reading
+the clocks to each callback evaluation.
+
+Adaptive mesh refinement
+========================
+Problems whose solutions contain brief transients (e.g., heel strike in a
+gait cycle) need a fine mesh near the transients but not elsewhere. Instead of
+over-resolving the whole trajectory, set `mesh_refinement_max_iterations` to
+a positive number. The solver then solves the problem on the initial mesh
+(from `num_mesh_intervals` or `mesh`), estimates the error in each mesh
+interval from the curvature of the state trajectories (see
+estimateMeshIntervalErrors()), subdivides only the intervals whose estimated
+error exceeds `mesh_refinement_tolerance`, and solves again on the refined
+mesh using the previous solution as the initial guess. This repeats until all
+intervals are within the tolerance, the maximum number of refinement
+iterations is reached, or the mesh would exceed
+`mesh_refinement_max_mesh_intervals`. If the solve on a refined mesh fails,
+the solver logs a warning and returns the solution from the previous mesh.
+The number of iterations and solver duration in the returned solution are
+totals over all refinement iterations.
+At the end, the solver logs the number of grid-point evaluations used over
+all refinement iterations, along with the size of a uniform mesh with the
+same finest resolution.
+
+Solving repeatedly
+==================
+Every call to solve() creates the optimization problem from scratch: the
+problem is transcribed into CasADi's symbolic graph and a new IPOPT solver is
+created. For large problems, this setup can take a substantial fraction of
+the solve time. If you solve the same problem many times, changing only
+variable bounds, cost weights, or the initial guess (e.g., for a parameter
+sweep), use a MocoCasADiSession instead, which performs this setup only once.
+
 Parameter variables
 ===================
 By default, MocoCasADiSolver is much slower than MocoTroperSolver at
@@ -149,6 +199,21 @@ public:
             "0: not parallel; 1: use all cores (default); greater than 1: use"
             "this number of parallel jobs. This overrides the OPENSIM_MOCO_PARALLEL "
             "environment variable.");
+    OpenSim_DECLARE_PROPERTY(profile_callbacks, bool,
+            "Record the number of calls and the wall-clock and CPU time spent "
+            "in each callback (multibody system, each goal, each path "
+            "constraint), broken down by thread. The profile is logged at the "
+            "end of solve() and stored in the solution. Default: false.");
+    OpenSim_DECLARE_PROPERTY(mesh_refinement_max_iterations, int,
+            "The maximum number of times the mesh is adaptively refined and "
+            "the problem solved again. 0 (default) disables mesh refinement.");
+    OpenSim_DECLARE_PROPERTY(mesh_refinement_tolerance, double,
+            "Mesh intervals whose estimated (normalized) state error exceeds "
+            "this value are subdivided during mesh refinement "
+            "(default: 1e-3).");
+    OpenSim_DECLARE_PROPERTY(mesh_refinement_max_mesh_intervals, int,
+            "Mesh refinement stops if refining would create more than this "
+            "number of mesh intervals (default: 500).");
     OpenSim_DECLARE_PROPERTY(output_interval, int,
             "Write intermediate trajectories to file. 0, the default, "
             "indicates no intermediate trajectories are saved, 1 indicates "
@@ -242,6 +307,30 @@ public:
 
     /// @}
 
+    /// @name Mesh refinement
+    /// @{
+
+    /// Estimate the error in each mesh interval of a trajectory. The `mesh`
+    /// contains normalized mesh points (from 0 to 1, as in the `mesh`
+    /// property), and the result has one entry per mesh interval. The
+    /// estimate for an interval of duration \f$ h \f$ is
+    /// \f$ h^2 |\ddot{y}|_{max} / 8 \f$, the error bound for linear
+    /// interpolation, where \f$ |\ddot{y}|_{max} \f$ is the largest second
+    /// divided difference of any state within the interval. Each state is
+    /// normalized by 1 plus its largest magnitude over the trajectory.
+    static std::vector<double> estimateMeshIntervalErrors(
+            const MocoTrajectory& trajectory, const std::vector<double>& mesh);
+
+    /// Subdivide each mesh interval whose error exceeds the tolerance into
+    /// \f$ \lceil \sqrt{e / tol} \rceil \f$ equal intervals (at most 4),
+    /// since the error estimate scales with the square of the interval
+    /// duration. If the refined mesh would have more than `maxMeshIntervals`
+    /// intervals, the original mesh is returned.
+    static std::vector<double> refineMesh(const std::vector<double>& mesh,
+            const std::vector<double>& errors, double tolerance,
+            int maxMeshIntervals);
+    /// @}
+
 protected:
     MocoSolution solveImpl() const override;
 
@@ -256,6 +345,33 @@ protected:
 private:
     void constructProperties();
 
+    /// Solve the problem once. If `mesh` is empty, the mesh is determined by
+    /// the `num_mesh_intervals` and `mesh` properties. If `profiler` is
+    /// provided, the callbacks are recorded into it and the caller reports
+    /// the profile; otherwise, if `profile_callbacks` is enabled, the profile
+    /// of this solve is reported and stored on the solution.
+    MocoSolution solveOnMesh(const std::vector<double>& mesh,
+            const MocoTrajectory& guess,
+            std::shared_ptr<CasOC::CallbackProfiler> profiler = nullptr) const;
+    MocoSolution solveWithMeshRefinement() const;
+
+    /// Convert the guess into a CasOC::Iterate, or create a guess from the
+    /// bounds if the guess is empty.
+    CasOC::Iterate createCasOCGuess(const MocoCasOCProblem& casProblem,
+            const CasOC::Solver& casSolver,
+            const MocoTrajectory& guess) const;
+    /// Solve the transcription, which is created and initialized first if it
+    /// is null, and convert the result into a MocoSolution. The solution
+    /// stats are left for the caller to set from `casSolution`.
+    MocoSolution solveTranscription(const CasOC::Solver& casSolver,
+            std::unique_ptr<CasOC::Transcription>& transcription,
+            const CasOC::Iterate& casGuess,
+            CasOC::Solution& casSolution) const;
+
+    friend class MocoCasADiSession;
+    // Allow hashing the guess.
+    friend class MocoSolutionCache;
+
     // When a copy of the solver is made, we want to keep any guess specified
     // by the API, but want to discard anything we've cached by loading a file.
     MocoTrajectory m_guessFromAPI;
@@ -263,6 +379,83 @@ private:
     mutable SimTK::ReferencePtr<const MocoTrajectory> m_guessToUse;
 };
 
+/** Solve the problem of a MocoCasADiSolver repeatedly, changing only
+variable bounds, cost weights, or the initial guess between solves. The first
+solve() transcribes the problem and creates the IPOPT solver, as
+MocoCasADiSolver::solve() does; subsequent solves reuse them, so only the
+optimization itself is repeated.
+@code
+MocoCasADiSolver& solver = study.initCasADiSolver();
+MocoCasADiSession session(solver);
+MocoSolution solution = session.solve();
+for (double weight : {0.1, 1.0, 10.0}) {
+    session.setCostWeight("effort", weight);
+    solution = session.solve();
+}
+@endcode
+The session uses the settings of the solver and the problem as they were when
+the session was created, including edits to the MocoProblem made after the
+solver was initialized; later changes to the solver or MocoProblem do not
+affect the session. The MocoStudy and its solver must outlive the session,
+and must not be solved or reinitialized while the session is in use.
+Each solve uses the previous solution as the initial guess unless you call
+setGuess().
+
+Only changes that do not alter the structure of the optimization problem are
+supported. The prescribed kinematics can change (see
+setPrescribedKinematics()). Bounds on the time-varying variables and the parameters can
+change, but whether a variable is bounded does not affect the variable
+scaling (see `scale_variables_using_bounds`), which is computed from the
+bounds at the first solve. Only costs (not endpoint constraints) can be
+reweighted. Mesh refinement is not performed. */
+class OSIMMOCO_API MocoCasADiSession {
+public:
+    /// The solver must have been initialized (e.g., with
+    /// MocoStudy::initCasADiSolver()). This recreates the solver's
+    /// MocoProblemRep from its MocoProblem.
+    explicit MocoCasADiSession(const MocoCasADiSolver& solver);
+    ~MocoCasADiSession();
+    MocoCasADiSession(const MocoCasADiSession&) = delete;
+    MocoCasADiSession& operator=(const MocoCasADiSession&) = delete;
+
+    /// @name Changing the problem between solves
+    /// These replace the bounds of existing variables for this session only,
+    /// with the same meaning as the corresponding functions of MocoPhase,
+    /// except that a variable whose `bounds` are not set is unconstrained
+    /// (the bounds are not taken from the model).
+    /// @{
+    void setTimeBounds(const MocoInitialBounds&, const MocoFinalBounds&);
+    void setStateInfo(const std::string& name, const MocoBounds& bounds,
+            const MocoInitialBounds& init = {},
+            const MocoFinalBounds& final = {});
+    void setControlInfo(const std::string& name, const MocoBounds& bounds,
+            const MocoInitialBounds& init = {},
+            const MocoFinalBounds& final = {});
+    void setParameterBounds(const std::string& name, const MocoBounds& bounds);
+    /// Change the weight of a goal in cost mode.
+    void setCostWeight(const std::string& name, double weight);
+    /// For a problem whose model prescribes the kinematics with a
+    /// PositionMotion (e.g., from MocoInverse), prescribe the kinematics of
+    /// the given PositionMotion instead. It must prescribe the same
+    /// coordinates. The models of the session are updated in place.
+    void setPrescribedKinematics(const PositionMotion& positionMotion);
+    /// The guess must be compatible with the problem, as for
+    /// MocoCasADiSolver::setGuess().
+    void setGuess(const MocoTrajectory& guess);
+    /// @}
+
+    MocoSolution solve();
+
+    /// The number of times solve() has been invoked.
+    int getNumSolves() const { return m_numSolves; }
+
+private:
+    const MocoCasADiSolver& m_solver;
+    class Impl;
+    std::unique_ptr<Impl> m_impl;
+    int m_numSolves = 0;
+};
+
 } // namespace OpenSim
 
 #endif // OPENSIM_MOCOCASADISOLVER_H
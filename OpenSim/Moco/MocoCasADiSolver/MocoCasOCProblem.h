@@ -332,6 +332,8 @@ private:
                 input.parameters, mocoProblemRep);
 
         // Compute the accelerations.
+        mocoProblemRep->calcMuscleInfosDisabledConstraints(
+                simtkStateDisabledConstraints);
         modelDisabledConstraints.realizeAcceleration(
                 simtkStateDisabledConstraints);
 
@@ -378,6 +380,8 @@ private:
                 input.controls, input.multipliers, input.derivatives,
                 input.parameters, mocoProblemRep);
 
+        mocoProblemRep->calcMuscleInfosDisabledConstraints(
+                simtkStateDisabledConstraints);
         modelDisabledConstraints.realizeAcceleration(
                 simtkStateDisabledConstraints);
 
@@ -486,6 +490,40 @@ private:
 
         m_jar->leave(std::move(mocoProblemRep));
     }
+    void initializeOnGrid(const std::vector<double>& times) const override {
+        // Each MocoProblemRep in the jar has its own copy of the goals, so we
+        // take all of them from the jar.
+        const AllProblemReps reps(*m_jar);
+        for (const auto& rep : reps) {
+            for (int i = 0; i < rep->getNumCosts(); ++i) {
+                rep->getCostByIndex(i).initializeOnGrid(times);
+            }
+            for (int i = 0; i < rep->getNumEndpointConstraints(); ++i) {
+                rep->getEndpointConstraintByIndex(i).initializeOnGrid(times);
+            }
+        }
+    }
+    /// Change the weight of a cost in each MocoProblemRep in the jar. The
+    /// weight is applied in calcCost(), so the transcription need not
+    /// change.
+    /// @precondition The problem has a cost with the given name.
+    void setCostWeight(const std::string& name, double weight) const {
+        const AllProblemReps reps(*m_jar);
+        for (const auto& rep : reps) {
+            rep->getCost(name).setWeightToUse(weight);
+        }
+    }
+    /// Prescribe other kinematics in each MocoProblemRep in the jar (see
+    /// MocoProblemRep::updatePrescribedKinematics()). The functions of the
+    /// problem are evaluated with the models in the jar, so the
+    /// transcription need not change.
+    void updatePrescribedKinematics(
+            const PositionMotion& positionMotion) const {
+        const AllProblemReps reps(*m_jar);
+        for (const auto& rep : reps) {
+            rep->updatePrescribedKinematics(positionMotion);
+        }
+    }
     void calcCostIntegrand(int index, const ContinuousInput& input,
             double& integrand) const override {
         auto mocoProblemRep = m_jar->take();
@@ -872,6 +910,33 @@ private:
         }
     }
 
+    /// Takes every MocoProblemRep out of the jar, and returns them to the jar
+    /// when destroyed, so that they are returned even if an exception is
+    /// thrown while they are in use (otherwise, the next take() would block
+    /// forever).
+    class AllProblemReps {
+    public:
+        using Reps = std::vector<std::unique_ptr<const MocoProblemRep>>;
+        explicit AllProblemReps(ThreadsafeJar<const MocoProblemRep>& jar)
+                : m_jar(jar) {
+            const int jarSize = jar.size();
+            // Reserve first so that push_back() cannot throw after take().
+            m_reps.reserve(jarSize);
+            for (int i = 0; i < jarSize; ++i) { m_reps.push_back(jar.take()); }
+        }
+        ~AllProblemReps() {
+            for (auto& rep : m_reps) { m_jar.leave(std::move(rep)); }
+        }
+        AllProblemReps(const AllProblemReps&) = delete;
+        AllProblemReps& operator=(const AllProblemReps&) = delete;
+        Reps::const_iterator begin() const { return m_reps.begin(); }
+        Reps::const_iterator end() const { return m_reps.end(); }
+
+    private:
+        ThreadsafeJar<const MocoProblemRep>& m_jar;
+        Reps m_reps;
+    };
+
     std::unique_ptr<ThreadsafeJar<const MocoProblemRep>> m_jar;
     bool m_paramsRequireInitSystem = true;
     std::string m_formattedTimeString;
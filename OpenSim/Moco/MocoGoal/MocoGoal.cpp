@@ -20,6 +20,9 @@
 
 #include <OpenSim/Moco/Components/ControlDistributor.h>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace OpenSim;
 
 MocoGoal::MocoGoal() {
@@ -49,6 +52,17 @@ void MocoGoal::printDescription() const {
     printDescriptionImpl();
 }
 
+int MocoGoal::getGridIndex(double time) const {
+    if (m_gridTimes.empty()) { return -1; }
+    // The solver computes the times from the (scaled) initial and final time
+    // variables, which may differ from the grid times by roundoff.
+    const double tolerance = 1e-9 * (1.0 + std::abs(time));
+    const auto it = std::lower_bound(
+            m_gridTimes.begin(), m_gridTimes.end(), time - tolerance);
+    if (it == m_gridTimes.end() || *it > time + tolerance) { return -1; }
+    return (int)(it - m_gridTimes.begin());
+}
+
 double MocoGoal::calcSystemDisplacement(const GoalInput& input) const {
     const SimTK::Vec3 comInitial =
             getModel().calcMassCenterPosition(input.initial_state);
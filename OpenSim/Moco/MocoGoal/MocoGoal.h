@@ -296,6 +296,7 @@ public:
     ///       getInputControls() are valid.
     void initializeOnModel(const Model& model) const {
         m_model.reset(&model);
+        m_gridTimes.clear();
         if (model.hasComponent<ControlDistributor>("/control_distributor")) {
             m_control_distributor.reset(
                     &model.getComponent<ControlDistributor>(
@@ -348,6 +349,32 @@ public:
                 "but it was not.");
     }
 
+    /// Cache quantities that depend only on the times at which the integrand
+    /// is evaluated (e.g., reference data), so that they need not be computed
+    /// in every call to calcIntegrand(). Solvers invoke this after
+    /// initializeOnModel() with the times of the grid if the initial and
+    /// final times are fixed, and with an empty vector (to clear the cache)
+    /// otherwise. The times must be sorted.
+    /// @precondition initializeOnModel() has been invoked.
+    void initializeOnGrid(const std::vector<double>& times) const {
+        m_gridTimes = times;
+        if (!get_enabled()) { return; }
+        initializeOnGridImpl(times);
+    }
+
+    /// Change the weight by which calcGoal() scales this goal, without
+    /// editing the `weight` property or re-initializing the goal. Solvers
+    /// that re-solve an already-transcribed problem (see MocoCasADiSession)
+    /// use this to update cost weights in place.
+    /// @precondition initializeOnModel() has been invoked, and the goal is
+    /// in cost mode.
+    void setWeightToUse(double weight) const {
+        OPENSIM_THROW_IF_FRMOBJ(m_modeToUse != Mode::Cost, Exception,
+                "Cannot set the weight of a goal in endpoint constraint "
+                "mode.");
+        m_weightToUse = weight;
+    }
+
     /// Get a vector of the MocoScaleFactors added to this MocoGoal.
     /// @details Note: the return value is constructed fresh on every call from
     /// the internal property. Avoid repeated calls to this function.
@@ -412,6 +439,16 @@ protected:
     /// Use this opportunity to check for errors in user input.
     virtual void initializeOnModelImpl(const Model&) const = 0;
 
+    /// Precompute quantities at the given grid times; see initializeOnGrid().
+    /// Use getGridIndex() in calcIntegrandImpl() to look them up, and compute
+    /// them as usual if the time is not on the grid (e.g., if the initial or
+    /// final time is free).
+    virtual void initializeOnGridImpl(const std::vector<double>&) const {}
+
+    /// The index of the given time in the times passed to initializeOnGrid(),
+    /// or -1 if the time is not one of those times.
+    int getGridIndex(double time) const;
+
     /// Set the number of integral terms required by this goal and the length
     /// of the vector passed into calcGoalImpl().
     /// This must be set within initializeOnModelImpl(), otherwise an exception
@@ -529,6 +566,7 @@ private:
     mutable Mode m_modeToUse;
     mutable SimTK::Stage m_stageDependency = SimTK::Stage::Acceleration;
     mutable int m_numIntegrals = -1;
+    mutable std::vector<double> m_gridTimes;
 };
 
 inline void MocoGoal::calcIntegrandImpl(
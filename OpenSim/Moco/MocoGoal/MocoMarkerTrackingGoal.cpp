@@ -125,13 +125,36 @@ void MocoMarkerTrackingGoal::initializeOnModelImpl(const Model& model) const {
     setRequirements(1, 1, SimTK::Stage::Position);
 }
 
+void MocoMarkerTrackingGoal::initializeOnGridImpl(
+        const std::vector<double>& times) const {
+    const int numMarkers = (int)m_model_markers.size();
+    m_refValuesOnGrid.resize(times.size() * numMarkers);
+    SimTK::Vector timeVec(1);
+    for (int itime = 0; itime < (int)times.size(); ++itime) {
+        timeVec[0] = times[itime];
+        for (int i = 0; i < numMarkers; ++i) {
+            const int refidx = m_refindices[i];
+            auto& refValue = m_refValuesOnGrid[itime * numMarkers + i];
+            refValue[0] = m_refsplines[3 * refidx].calcValue(timeVec);
+            refValue[1] = m_refsplines[3 * refidx + 1].calcValue(timeVec);
+            refValue[2] = m_refsplines[3 * refidx + 2].calcValue(timeVec);
+        }
+    }
+}
+
 void MocoMarkerTrackingGoal::calcIntegrandImpl(
         const IntegrandInput& input, SimTK::Real& integrand) const {
      const auto& time = input.state.getTime();
      getModel().realizePosition(input.state);
-     SimTK::Vector timeVec(1, time);
 
-    for (int i = 0; i < (int)m_model_markers.size(); ++i) {
+    // Use the reference values at the grid time, if available, rather than
+    // evaluating the splines.
+    const int numMarkers = (int)m_model_markers.size();
+    const int igrid = getGridIndex(time);
+    SimTK::Vector timeVec;
+    if (igrid == -1) { timeVec = SimTK::Vector(1, time); }
+
+    for (int i = 0; i < numMarkers; ++i) {
          const auto& modelValue =
                  m_model_markers[i]->getLocationInGround(input.state);
          SimTK::Vec3 refValue;
@@ -139,9 +162,13 @@ void MocoMarkerTrackingGoal::calcIntegrandImpl(
         // Get the markers reference index corresponding to the current
         // model marker and get the reference value.
         int refidx = m_refindices[i];
-        refValue[0] = m_refsplines[3 * refidx].calcValue(timeVec);
-        refValue[1] = m_refsplines[3 * refidx + 1].calcValue(timeVec);
-        refValue[2] = m_refsplines[3 * refidx + 2].calcValue(timeVec);
+        if (igrid == -1) {
+            refValue[0] = m_refsplines[3 * refidx].calcValue(timeVec);
+            refValue[1] = m_refsplines[3 * refidx + 1].calcValue(timeVec);
+            refValue[2] = m_refsplines[3 * refidx + 2].calcValue(timeVec);
+        } else {
+            refValue = m_refValuesOnGrid[igrid * numMarkers + i];
+        }
 
         // Apply scale factors for this marker, if they exist.
         const auto& scaleFactorRef = m_scaleFactorRefs[i];
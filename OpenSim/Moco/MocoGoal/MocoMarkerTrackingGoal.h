@@ -107,6 +107,7 @@ public:
 
 protected:
     void initializeOnModelImpl(const Model&) const override;
+    void initializeOnGridImpl(const std::vector<double>& times) const override;
     void calcIntegrandImpl(
             const IntegrandInput& input, SimTK::Real& integrand) const override;
     void calcGoalImpl(
@@ -127,6 +128,10 @@ protected:
             "not in the model (such data would be ignored). Default: false.");
 
     mutable GCVSplineSet m_refsplines;
+    // The reference location of each model marker at the grid times, if the
+    // grid is fixed, with one row (of length m_model_markers.size()) per grid
+    // time.
+    mutable std::vector<SimTK::Vec3> m_refValuesOnGrid;
     mutable std::vector<SimTK::ReferencePtr<const Marker>> m_model_markers;
     mutable std::vector<int> m_refindices;
     mutable SimTK::Array_<double> m_marker_weights;
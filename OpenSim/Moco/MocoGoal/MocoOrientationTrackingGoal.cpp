@@ -182,36 +182,63 @@ void MocoOrientationTrackingGoal::initializeOnModelImpl(const Model& model)
     setRequirements(1, 1, SimTK::Stage::Position);
 }
 
+SimTK::Rotation_<double> MocoOrientationTrackingGoal::calcReferenceRotation(
+        int iframe, const SimTK::Vector& timeVec) const {
+    // Construct a new quaternion object from the splined quaternion data.
+    // This constructor normalizes the provided values to ensure that a 
+    // valid unit quaternion is created. Other approaches, such as the 
+    // Slerp algorithm (https://en.wikipedia.org/wiki/Slerp) may also be
+    // valid. However, ensuring that the normalization step is included
+    // seems to be sufficient for the purposes of this cost. 
+    // https://keithmaggio.wordpress.com/2011/02/15/math-magician-lerp-slerp-and-nlerp/
+    const SimTK::Quaternion_<double> e(
+        m_ref_splines[4*iframe].calcValue(timeVec),
+        m_ref_splines[4*iframe + 1].calcValue(timeVec),
+        m_ref_splines[4*iframe + 2].calcValue(timeVec),
+        m_ref_splines[4*iframe + 3].calcValue(timeVec));
+    return SimTK::Rotation_<double>(e);
+}
+
+void MocoOrientationTrackingGoal::initializeOnGridImpl(
+        const std::vector<double>& times) const {
+    const int numFrames = (int)m_model_frames.size();
+    m_refRotationsOnGrid.resize(times.size() * numFrames);
+    SimTK::Vector timeVec(1);
+    for (int itime = 0; itime < (int)times.size(); ++itime) {
+        timeVec[0] = times[itime];
+        for (int iframe = 0; iframe < numFrames; ++iframe) {
+            m_refRotationsOnGrid[itime * numFrames + iframe] =
+                    calcReferenceRotation(iframe, timeVec);
+        }
+    }
+}
+
 void MocoOrientationTrackingGoal::calcIntegrandImpl(
         const IntegrandInput& input, SimTK::Real& integrand) const {
     const auto& time = input.state.getTime();
     getModel().realizePosition(input.state);
-    SimTK::Vector timeVec(1, time);
+
+    // Use the reference rotations at the grid time, if available, rather
+    // than evaluating the splines.
+    const int numFrames = (int)m_model_frames.size();
+    const int igrid = getGridIndex(time);
+    SimTK::Vector timeVec;
+    if (igrid == -1) { timeVec = SimTK::Vector(1, time); }
 
     // Rotation frame symbols: 
     //  G - ground
     //  D - data (reference)
     //  M - model
     integrand = 0;
-    for (int iframe = 0; iframe < (int)m_model_frames.size(); ++iframe) {
+    for (int iframe = 0; iframe < numFrames; ++iframe) {
         const auto& R_GM =
             m_model_frames[iframe]->getRotationInGround(input.state);
 
-        // Construct a new quaternion object from the splined quaternion data.
-        // This constructor normalizes the provided values to ensure that a 
-        // valid unit quaternion is created. Other approaches, such as the 
-        // Slerp algorithm (https://en.wikipedia.org/wiki/Slerp) may also be
-        // valid. However, ensuring that the normalization step is included
-        // seems to be sufficient for the purposes of this cost. 
-        // https://keithmaggio.wordpress.com/2011/02/15/math-magician-lerp-slerp-and-nlerp/
-        const SimTK::Quaternion_<double> e(
-            m_ref_splines[4*iframe].calcValue(timeVec),
-            m_ref_splines[4*iframe + 1].calcValue(timeVec),
-            m_ref_splines[4*iframe + 2].calcValue(timeVec),
-            m_ref_splines[4*iframe + 3].calcValue(timeVec));
         // Construct a Rotation object from which we'll calculate an angle-axis
         // representation of the current orientation error.
-        const SimTK::Rotation_<double> R_GD(e);
+        const SimTK::Rotation_<double> R_GD =
+                igrid == -1 ? calcReferenceRotation(iframe, timeVec)
+                            : m_refRotationsOnGrid[igrid * numFrames + iframe];
         const SimTK::Rotation_<double> R_MD = ~R_GM*R_GD;
         const SimTK::Vec4 aa_MD = R_MD.convertRotationToAngleAxis();
 
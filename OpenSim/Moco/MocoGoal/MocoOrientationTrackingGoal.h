@@ -143,6 +143,7 @@ public:
 
 protected:
     void initializeOnModelImpl(const Model& model) const override;
+    void initializeOnGridImpl(const std::vector<double>& times) const override;
     void calcIntegrandImpl(
             const IntegrandInput& input, SimTK::Real& integrand) const override;
     void calcGoalImpl(
@@ -177,8 +178,15 @@ private:
         constructProperty_rotation_weights(MocoWeightSet());
     }
 
+    // Evaluate the reference rotation of the given frame from the splines.
+    SimTK::Rotation_<double> calcReferenceRotation(
+            int iframe, const SimTK::Vector& timeVec) const;
+
     TimeSeriesTable_<SimTK::Rotation_<double>> m_rotation_table;
     mutable GCVSplineSet m_ref_splines;
+    // The reference rotation of each frame at the grid times, if the grid is
+    // fixed, with one row (of length m_model_frames.size()) per grid time.
+    mutable std::vector<SimTK::Rotation_<double>> m_refRotationsOnGrid;
     mutable std::vector<std::string> m_frame_paths;
     mutable std::vector<SimTK::ReferencePtr<const Frame>> m_model_frames;
     mutable std::vector<double> m_rotation_weights;
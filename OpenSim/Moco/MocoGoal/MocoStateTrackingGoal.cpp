@@ -139,18 +139,37 @@ void MocoStateTrackingGoal::initializeOnModelImpl(const Model& model) const {
     setRequirements(1, 1, SimTK::Stage::Time);
 }
 
+void MocoStateTrackingGoal::initializeOnGridImpl(
+        const std::vector<double>& times) const {
+    const int numRefs = m_refsplines.getSize();
+    m_refValuesOnGrid.resize(times.size() * numRefs);
+    SimTK::Vector timeVec(1);
+    for (int itime = 0; itime < (int)times.size(); ++itime) {
+        timeVec[0] = times[itime];
+        for (int iref = 0; iref < numRefs; ++iref) {
+            m_refValuesOnGrid[itime * numRefs + iref] =
+                    m_refsplines[iref].calcValue(timeVec);
+        }
+    }
+}
+
 void MocoStateTrackingGoal::calcIntegrandImpl(
         const IntegrandInput& input, SimTK::Real& integrand) const {
     const auto& time = input.time;
 
-    SimTK::Vector timeVec(1, time);
+    // Use the reference values at the grid time, if available, rather than
+    // evaluating the splines.
+    const int numRefs = m_refsplines.getSize();
+    const int igrid = getGridIndex(time);
+    SimTK::Vector timeVec;
+    if (igrid == -1) { timeVec = SimTK::Vector(1, time); }
 
-    // TODO cache the reference coordinate values at the mesh points, rather
-    // than evaluating the spline.
     integrand = 0;
-    for (int iref = 0; iref < m_refsplines.getSize(); ++iref) {
+    for (int iref = 0; iref < numRefs; ++iref) {
         const auto& modelValue = input.state.getY()[m_sysYIndices[iref]];
-        const auto& refValue = m_refsplines[iref].calcValue(timeVec);
+        const double refValue =
+                igrid == -1 ? m_refsplines[iref].calcValue(timeVec)
+                            : m_refValuesOnGrid[igrid * numRefs + iref];
 
         // If a scale factor exists for this state, retrieve its value.
         double scaleFactor = 1.0;
@@ -152,6 +152,7 @@ public:
 protected:
     // TODO check that the reference covers the entire possible time range.
     void initializeOnModelImpl(const Model&) const override;
+    void initializeOnGridImpl(const std::vector<double>& times) const override;
     void calcIntegrandImpl(
             const IntegrandInput& input, SimTK::Real& integrand) const override;
     void calcGoalImpl(
@@ -195,6 +196,9 @@ private:
     }
 
     mutable GCVSplineSet m_refsplines;
+    /// The reference values at the grid times, if the grid is fixed, with
+    /// one row (of length m_refsplines.getSize()) per grid time.
+    mutable std::vector<double> m_refValuesOnGrid;
     /// The indices in Y corresponding to the provided reference coordinates.
     mutable std::vector<int> m_sysYIndices;
     mutable std::vector<double> m_state_weights;
@@ -26,6 +26,8 @@
 #include "MocoStudy.h"
 #include "MocoUtilities.h"
 
+#include <OpenSim/Common/Stopwatch.h>
+
 using namespace OpenSim;
 
 void MocoInverse::constructProperties() {
@@ -47,13 +49,24 @@ TimeSeriesTable MocoInverse::initializeKinematics() const {
 }
 
 std::pair<MocoStudy, TimeSeriesTable> MocoInverse::initializeInternal() const {
+    MocoStudy study;
+    TimeInfo timeInfo;
+    TimeSeriesTable kinematics = prescribeKinematics(study,
+            get_model().process(getDocumentDirectory()), get_kinematics(),
+            timeInfo);
+    configureStudy(study, timeInfo.numMeshIntervals);
+    return std::make_pair(study, std::move(kinematics));
+}
+
+TimeSeriesTable MocoInverse::prescribeKinematics(MocoStudy& study,
+        Model model, const TableProcessor& kinematicsProcessor,
+        TimeInfo& timeInfo) const {
 
     // Process inputs.
     // ----------------
-    Model model = get_model().process(getDocumentDirectory());
     model.initSystem();
 
-    TimeSeriesTable kinematics = get_kinematics().processAndConvertToRadians(
+    TimeSeriesTable kinematics = kinematicsProcessor.processAndConvertToRadians(
             getDocumentDirectory(), model);
 
     // Prescribe the kinematics.
@@ -73,12 +86,10 @@ std::pair<MocoStudy, TimeSeriesTable> MocoInverse::initializeInternal() const {
 
     // Set up the MocoProblem.
     // -----------------------
-
-    MocoStudy study;
     auto& problem = study.updProblem();
     problem.setModelAsCopy(model);
 
-    TimeInfo timeInfo;
+    timeInfo = TimeInfo();
     updateTimeInfo("kinematics", kinematics.getIndependentColumn().front(),
             kinematics.getIndependentColumn().back(), timeInfo);
     if (get_clip_time_range()) {
@@ -87,6 +98,13 @@ std::pair<MocoStudy, TimeSeriesTable> MocoInverse::initializeInternal() const {
     }
     problem.setTimeBounds(timeInfo.initial, timeInfo.final);
 
+    return posmotPtr->exportToTable(kinematics.getIndependentColumn());
+}
+
+void MocoInverse::configureStudy(
+        MocoStudy& study, int numMeshIntervals) const {
+    auto& problem = study.updProblem();
+
     // TODO: Allow users to specify costs flexibly.
     auto* effort = problem.addGoal<MocoControlGoal>("excitation_effort");
     effort->setWeightForControlPattern(".*/reserve_.*", get_reserves_weight());
@@ -113,22 +131,16 @@ std::pair<MocoStudy, TimeSeriesTable> MocoInverse::initializeInternal() const {
     solver.set_optim_sparsity_detection("random");
     // Forward is 3x faster than central.
     solver.set_optim_finite_difference_scheme("forward");
-    solver.set_num_mesh_intervals(timeInfo.numMeshIntervals);
+    solver.set_num_mesh_intervals(numMeshIntervals);
     if (!getProperty_max_iterations().empty()) {
         solver.set_optim_max_iterations(get_max_iterations());
     }
-    return std::make_pair(
-            study, posmotPtr->exportToTable(kinematics.getIndependentColumn()));
 }
 
-MocoInverseSolution MocoInverse::solve() const {
-    std::pair<MocoStudy, TimeSeriesTable> init = initializeInternal();
-    const auto& study = init.first;
-
-    MocoSolution mocoSolution = study.solve().unseal();
-
-    const auto& statesTrajTable = init.second;
-    mocoSolution.insertStatesTrajectory(statesTrajTable);
+MocoInverseSolution MocoInverse::createSolution(const MocoStudy& study,
+        MocoSolution mocoSolution, const TimeSeriesTable& kinematics) const {
+    mocoSolution.unseal();
+    mocoSolution.insertStatesTrajectory(kinematics);
     MocoInverseSolution solution;
     solution.setMocoSolution(mocoSolution);
 
@@ -145,3 +157,83 @@ MocoInverseSolution MocoInverse::solve() const {
     }
     return solution;
 }
+
+MocoInverseSolution MocoInverse::solve() const {
+    std::pair<MocoStudy, TimeSeriesTable> init = initializeInternal();
+    const auto& study = init.first;
+    return createSolution(study, study.solve(), init.second);
+}
+
+std::vector<MocoInverseSolution> MocoInverse::solveTrials(
+        const std::vector<TableProcessor>& trialKinematics) const {
+    OPENSIM_THROW_IF_FRMOBJ(trialKinematics.empty(), Exception,
+            "Expected at least one trial.");
+    const Stopwatch stopwatch;
+    // Each trial uses a copy of the processed model.
+    const Model model = get_model().process(getDocumentDirectory());
+    const double modelDuration = stopwatch.getElapsedTime();
+
+    MocoStudy study;
+    const int numTrials = (int)trialKinematics.size();
+    std::vector<MocoInverseSolution> solutions;
+    solutions.reserve(numTrials);
+    // The session creates the MocoProblemRep and transcribes the problem
+    // once; for subsequent trials, only the prescribed kinematics, the time
+    // bounds, and the guess of the session change.
+    std::unique_ptr<MocoCasADiSession> session;
+    MocoTrajectory guess;
+    int numMeshIntervals = -1;
+    for (int itrial = 0; itrial < numTrials; ++itrial) {
+        const Stopwatch trialStopwatch;
+        TimeInfo timeInfo;
+        // This also sets the model of the study's problem, which is used to
+        // analyze the solution.
+        const TimeSeriesTable kinematics = prescribeKinematics(
+                study, model, trialKinematics[itrial], timeInfo);
+        if (!session) {
+            numMeshIntervals = timeInfo.numMeshIntervals;
+            configureStudy(study, numMeshIntervals);
+            session = OpenSim::make_unique<MocoCasADiSession>(
+                    study.updSolver<MocoCasADiSolver>());
+        } else {
+            session->setPrescribedKinematics(
+                    study.getProblem().getPhase(0).getModel()
+                            .getComponent<PositionMotion>("position_motion"));
+            session->setTimeBounds(timeInfo.initial, timeInfo.final);
+        }
+        if (!guess.empty()) {
+            // Scale the times of the previous solution to this trial's time
+            // range. Each trial has the same number of mesh intervals.
+            const double initialTime = guess.getInitialTime();
+            const double scale = (timeInfo.final - timeInfo.initial) /
+                                 (guess.getFinalTime() - initialTime);
+            SimTK::Vector time = guess.getTime();
+            for (int itime = 0; itime < time.size(); ++itime) {
+                time[itime] =
+                        timeInfo.initial + scale * (time[itime] - initialTime);
+            }
+            guess.setTime(time);
+            session->setGuess(guess);
+        }
+        const double setupDuration = trialStopwatch.getElapsedTime();
+
+        MocoSolution mocoSolution = session->solve();
+        if (mocoSolution.success()) guess = mocoSolution;
+        solutions.push_back(
+                createSolution(study, std::move(mocoSolution), kinematics));
+        const MocoSolution& solution = solutions.back().getMocoSolution();
+        log_info("MocoInverse trial {}/{}: {} in {} ({} iterations; setup: "
+                 "{:.3f} s, solver: {:.3f} s).",
+                itrial + 1, numTrials,
+                solution.success() ? "succeeded" : "did NOT succeed",
+                trialStopwatch.getElapsedTimeFormatted(),
+                solution.getNumIterations(), setupDuration,
+                solution.getSolverDuration());
+    }
+    log_info("MocoInverse solved {} trials with {} mesh intervals in {} "
+             "({:.3f} s per trial; processing the model took {:.3f} s).",
+            numTrials, numMeshIntervals, stopwatch.getElapsedTimeFormatted(),
+            (stopwatch.getElapsedTime() - modelDuration) / numTrials,
+            modelDuration);
+    return solutions;
+}
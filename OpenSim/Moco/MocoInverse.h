@@ -156,6 +156,30 @@ the problem does not become over-constrained.
 For example, if using a MocoControlBoundConstraint with MocoInverse,
 the constraint will be ignored at mesh interval midpoints if
 'enforce_path_constraint_midpoints' is set to false.
+
+# Solving many trials
+To solve the same problem for many trials (e.g., each gait cycle of a
+subject), use solveTrials() instead of calling solve() for each trial. The
+model is processed once, and the problem is created and transcribed once with
+a MocoCasADiSession; for each trial, the functions of the PositionMotion that
+prescribes the kinematics are updated in place, and only the time range of
+the problem and the initial guess change. Every trial uses the number of mesh intervals of the
+first trial, so that the solution for one trial (with its times scaled to the
+next trial's time range) is used as the initial guess for the next trial.
+The time taken for each trial is logged.
+
+@code
+MocoInverse inverse;
+inverse.setModel(ModelProcessor("model_file.osim") |
+                 ModOpAddExternalLoads("external_loads.xml") |
+                 ModOpAddReserves(1));
+inverse.set_mesh_interval(0.02);
+std::vector<TableProcessor> cycles;
+for (int i = 0; i < numCycles; ++i) {
+    cycles.emplace_back(fmt::format("cycle{}_kinematics.sto", i));
+}
+std::vector<MocoInverseSolution> solutions = inverse.solveTrials(cycles);
+@endcode
  */
 class OSIMMOCO_API MocoInverse : public MocoTool {
     OpenSim_DECLARE_CONCRETE_OBJECT(MocoInverse, MocoTool);
@@ -203,10 +227,32 @@ public:
     /// Solve the problem returned by initialize() and compute the outputs
     /// listed in output_paths.
     MocoInverseSolution solve() const;
+    /// Solve the problem for each of the provided kinematics, instead of the
+    /// kinematics property, and compute the outputs listed in output_paths;
+    /// see "Solving many trials" above. The solution for each trial is used
+    /// as the initial guess for the next trial if it succeeded. Trials whose
+    /// solution failed are included (sealed) in the returned solutions.
+    /// The initial_time and final_time properties, if set, apply to every
+    /// trial.
+    std::vector<MocoInverseSolution> solveTrials(
+            const std::vector<TableProcessor>& trialKinematics) const;
 
 private:
     void constructProperties();
     std::pair<MocoStudy, TimeSeriesTable> initializeInternal() const;
+    /// Prescribe the kinematics in the (processed) model, and set the model
+    /// and time bounds of the study's problem. The time info is updated with
+    /// the time range of the kinematics. Returns the prescribed kinematics.
+    TimeSeriesTable prescribeKinematics(MocoStudy& study, Model model,
+            const TableProcessor& kinematicsProcessor,
+            TimeInfo& timeInfo) const;
+    /// Add the goals and configure the solver of a study whose problem has a
+    /// model.
+    void configureStudy(MocoStudy& study, int numMeshIntervals) const;
+    /// Create the MocoInverseSolution from the solution of the study.
+    MocoInverseSolution createSolution(const MocoStudy& study,
+            MocoSolution mocoSolution,
+            const TimeSeriesTable& kinematics) const;
 };
 
 } // namespace OpenSim
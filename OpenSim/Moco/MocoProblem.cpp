@@ -22,6 +22,11 @@
 
 #include <OpenSim/Simulation/SimulationUtilities.h>
 
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 using namespace OpenSim;
 
 // ============================================================================
@@ -310,6 +315,52 @@ MocoGoal& MocoProblem::updGoal(const std::string& name) {
 void MocoProblem::constructProperties() {
     constructProperty_phases(Array<MocoPhase>(MocoPhase(), 1));
 }
+std::vector<std::unique_ptr<MocoProblemRep>> MocoProblem::createRepsHeap(
+        int count, int numThreads) const {
+    OPENSIM_THROW_IF_FRMOBJ(count < 0, Exception,
+            "Expected a non-negative count, but got {}.", count);
+    OPENSIM_THROW_IF_FRMOBJ(numThreads < 1, Exception,
+            "Expected a positive number of threads, but got {}.", numThreads);
+    std::vector<std::unique_ptr<MocoProblemRep>> reps(count);
+    if (count == 0) { return reps; }
+
+    // Processing the model (e.g., reading the model file and replacing its
+    // muscles) gives the same model for every MocoProblemRep, so we only do
+    // it once.
+    // Other problems may be initializing on other threads, so processing
+    // (which may read files relative to the working directory) holds the
+    // same mutex as MocoProblemRep::initialize().
+    std::shared_ptr<const Model> processedModel;
+    {
+        std::lock_guard<std::mutex> lock(
+                MocoProblemRep::getWorkingDirectoryMutex());
+        processedModel = std::make_shared<const Model>(
+                get_phases(0).getModelProcessor().process());
+    }
+
+    // Each thread creates every numThreads-th MocoProblemRep.
+    numThreads = std::min(numThreads, count);
+    std::vector<std::exception_ptr> exceptions(numThreads);
+    const auto createReps = [&](int thread) {
+        try {
+            for (int i = thread; i < count; i += numThreads) {
+                reps[i].reset(new MocoProblemRep(*this, processedModel));
+            }
+        } catch (...) {
+            exceptions[thread] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int thread = 1; thread < numThreads; ++thread) {
+        threads.emplace_back(createReps, thread);
+    }
+    createReps(0);
+    for (auto& thread : threads) { thread.join(); }
+    for (const auto& exception : exceptions) {
+        if (exception) { std::rethrow_exception(exception); }
+    }
+    return reps;
+}
 void MocoProblem::setStateInfoPattern(const std::string& pattern,
         const MocoBounds& bounds, const MocoInitialBounds& initial,
         const MocoFinalBounds& final) {
@@ -558,6 +558,18 @@ public:
     std::unique_ptr<MocoProblemRep> createRepHeap() const {
         return std::unique_ptr<MocoProblemRep>(new MocoProblemRep(*this));
     }
+#ifndef SWIG
+    /// Create multiple independent instances of MocoProblemRep (e.g., one per
+    /// thread of a solver) concurrently, using up to `numThreads` threads.
+    /// The ModelProcessor is processed once, and each MocoProblemRep starts
+    /// from a copy of the processed model. Connecting the models and
+    /// initializing the goals may read files relative to (or change) the
+    /// working directory, so each MocoProblemRep does only these steps in
+    /// turn. If creating any MocoProblemRep throws an exception, the first
+    /// such exception is rethrown.
+    std::vector<std::unique_ptr<MocoProblemRep>> createRepsHeap(
+            int count, int numThreads) const;
+#endif
 
     friend MocoProblemRep;
 
@@ -25,9 +25,12 @@
 #include "MocoScaleFactor.h"
 #include "OpenSim/Common/Exception.h"
 #include "OpenSim/Moco/Components/ControlDistributor.h"
+#include <functional>
+#include <mutex>
 #include <regex>
 #include <unordered_set>
 
+#include <OpenSim/Common/Stopwatch.h>
 #include <OpenSim/Simulation/Control/InputController.h>
 #include <OpenSim/Simulation/Control/PrescribedController.h>
 #include <OpenSim/Simulation/PositionMotion.h>
@@ -38,10 +41,20 @@ using namespace OpenSim;
 const std::vector<std::string> MocoProblemRep::m_disallowedJoints(
         {"FreeJoint", "BallJoint", "EllipsoidJoint", "ScapulothoracicJoint"});
 
+std::mutex& MocoProblemRep::getWorkingDirectoryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
 MocoProblemRep::MocoProblemRep(const MocoProblem& problem)
         : m_problem(&problem) {
     initialize();
 }
+MocoProblemRep::MocoProblemRep(const MocoProblem& problem,
+        std::shared_ptr<const Model> processedModel)
+        : m_problem(&problem), m_processed_model(std::move(processedModel)) {
+    initialize();
+}
 void MocoProblemRep::initialize() {
 
     // Clear member variables.
@@ -66,15 +79,45 @@ void MocoProblemRep::initialize() {
     m_kinematic_constraint_eq_names_without_derivatives.clear();
     m_implicit_component_refs.clear();
     m_implicit_residual_refs.clear();
+    m_initialization_times.clear();
+
+    Stopwatch stopwatch;
+    // The time spent waiting for the working directory mutex is not part of
+    // any step.
+    double waitTime = 0;
+    const auto recordTime = [&](std::string step) {
+        m_initialization_times.emplace_back(
+                std::move(step), stopwatch.getElapsedTime() - waitTime);
+        stopwatch.reset();
+        waitTime = 0;
+    };
+    // Processing the model, connecting it (or finalizing it from its
+    // properties), and initializing the goals may read files relative to the
+    // working directory, which some components change (see
+    // getWorkingDirectoryMutex()).
+    const auto withWorkingDirectory = [&](const std::function<void()>& f) {
+        const Stopwatch wait;
+        std::lock_guard<std::mutex> lock(getWorkingDirectoryMutex());
+        waitTime += wait.getElapsedTime();
+        f();
+    };
 
     if (!getTimeInitialBounds().isSet() && !getTimeFinalBounds().isSet()) {
         log_warn("No time bounds set.");
     }
 
     const auto& ph0 = m_problem->getPhase(0);
-    // TODO: Provide directory from which to load model file.
-    m_model_base = ph0.getModelProcessor().process();
-    m_model_base.initSystem();
+    if (m_processed_model) {
+        m_model_base = Model(*m_processed_model);
+        recordTime("copy model");
+    } else {
+        // TODO: Provide directory from which to load model file.
+        withWorkingDirectory([&] {
+            m_model_base = ph0.getModelProcessor().process();
+        });
+        recordTime("process model");
+    }
+    withWorkingDirectory([&] { m_model_base.initSystem(); });
 
     // Check for bodies with zero mass.
     for (const auto& body : m_model_base.getComponentList<Body>()) {
@@ -182,7 +225,7 @@ void MocoProblemRep::initialize() {
     }
     m_control_distributor_base.reset(&controlDistributor);
     m_model_base.addController(actuatorController.release());
-    m_model_base.finalizeConnections();
+    withWorkingDirectory([&] { m_model_base.finalizeConnections(); });
 
     // Scale factors
     // -------------
@@ -205,7 +248,7 @@ void MocoProblemRep::initialize() {
             ++numScaleFactors;
         }
     }
-    m_model_base.finalizeFromProperties();
+    withWorkingDirectory([&] { m_model_base.finalizeFromProperties(); });
 
     int countMotion = 0;
     for (const auto& comp : m_model_base.getComponentList<PositionMotion>()) {
@@ -230,7 +273,7 @@ void MocoProblemRep::initialize() {
         posmotBase.setDefaultEnabled(false);
     }
 
-    m_state_base = m_model_base.initSystem();
+    withWorkingDirectory([&] { m_state_base = m_model_base.initSystem(); });
 
     if (m_prescribedKinematics) {
         m_position_motion_base.reset(
@@ -262,6 +305,7 @@ void MocoProblemRep::initialize() {
     // the accelerations.
     // If there's a PrescribedMotion in the model, it's disabled by default
     // in this copied model.
+    recordTime("initialize model");
     m_model_disabled_constraints = Model(m_model_base);
 
     // The constraint forces will be applied to the copied model via an
@@ -272,7 +316,8 @@ void MocoProblemRep::initialize() {
     m_constraint_forces.reset(constraintForcesUPtr.get());
     m_model_disabled_constraints.addComponent(constraintForcesUPtr.release());
 
-    m_model_disabled_constraints.finalizeFromProperties();
+    withWorkingDirectory(
+            [&] { m_model_disabled_constraints.finalizeFromProperties(); });
     m_control_distributor_disabled_constraints.reset(
             &*m_model_disabled_constraints
                     .getComponentList<ControlDistributor>().begin());
@@ -293,7 +338,10 @@ void MocoProblemRep::initialize() {
 
     // Grab a writable state from the copied model -- we'll use this to disable
     // its constraints below.
-    m_state_disabled_constraints[0] = m_model_disabled_constraints.initSystem();
+    withWorkingDirectory([&] {
+        m_state_disabled_constraints[0] =
+                m_model_disabled_constraints.initSystem();
+    });
     m_state_disabled_constraints[1] = m_state_disabled_constraints[0];
 
     // See comment above for m_position_motion_base.
@@ -428,6 +476,8 @@ void MocoProblemRep::initialize() {
                 Exception, "Internal error.");
     }
 
+    recordTime("initialize model with disabled constraints");
+
     // State infos.
     // ------------
     // Set the regex pattern states first.
@@ -723,6 +773,8 @@ void MocoProblemRep::initialize() {
         ++iparam;
     }
 
+    recordTime("variable infos and parameters");
+
     // Goals.
     // ------
     std::unordered_set<std::string> goalNames;
@@ -735,7 +787,9 @@ void MocoProblemRep::initialize() {
         goalNames.insert(goal.getName());
         if (goal.getEnabled()) {
             std::unique_ptr<MocoGoal> item(goal.clone());
-            item->initializeOnModel(m_model_disabled_constraints);
+            withWorkingDirectory([&] {
+                item->initializeOnModel(m_model_disabled_constraints);
+            });
             if (item->getModeIsEndpointConstraint()) {
                 m_endpoint_constraints.push_back(std::move(item));
             } else {
@@ -762,11 +816,28 @@ void MocoProblemRep::initialize() {
                 pc.getName());
         pcNames.insert(pc.getName());
         m_path_constraints[i] = std::unique_ptr<MocoPathConstraint>(pc.clone());
-        m_path_constraints[i]->initializeOnModel(m_model_disabled_constraints,
-                problemInfo, m_num_path_constraint_equations);
+        withWorkingDirectory([&] {
+            m_path_constraints[i]->initializeOnModel(
+                    m_model_disabled_constraints, problemInfo,
+                    m_num_path_constraint_equations);
+        });
         m_num_path_constraint_equations +=
                 m_path_constraints[i]->getConstraintInfo().getNumEquations();
     }
+
+    // Muscle batch.
+    // -------------
+    // Parameters may change the properties of the muscles, so the batch is
+    // only used for problems without parameters.
+    m_muscle_batch_disabled_constraints.reset();
+    if (m_parameters.empty()) {
+        auto batch = make_unique<DeGrooteFregly2016MuscleBatch>(
+                m_model_disabled_constraints);
+        if (batch->getNumMuscles()) {
+            m_muscle_batch_disabled_constraints = std::move(batch);
+        }
+    }
+    recordTime("goals and path constraints");
 }
 
 const std::string& MocoProblemRep::getName() const {
@@ -985,49 +1056,75 @@ void MocoProblemRep::applyParametersToModelProperties(
     for (int i = 0; i < (int)m_parameters.size(); ++i) {
         m_parameters[i]->applyParameterToModelProperties(parameterValues(i));
     }
-    if (initSystemAndDisableConstraints) {
-        // TODO: Avoid these const_casts.
-
-        // Model base.
-        // -----------
-        const_cast<Model&>(m_model_base).initSystem();
-        // The PrescribedMotion is disabled by default in the model so that,
-        // if there are constraints, the AssemblySolver does not complain about
-        // having 0 parameters with which to satisfy the constraints. After
-        // we're done with the assembly in initSystem(), we can re-enable the
-        // prescribed motion.
-        if (m_position_motion_base) {
-            m_position_motion_base->setEnabled(m_state_base, true);
-        }
+    if (initSystemAndDisableConstraints) { reinitializeModels(); }
+}
 
-        // Model disable constraints.
-        // --------------------------
-        Model& m_model_disabled_constraints_const_cast =
-                const_cast<Model&>(m_model_disabled_constraints);
+void MocoProblemRep::updatePrescribedKinematics(
+        const PositionMotion& positionMotion) const {
+    OPENSIM_THROW_IF(!m_prescribedKinematics, Exception,
+            "Cannot update the prescribed kinematics: the model does not "
+            "contain a PositionMotion.");
+    const FunctionSet& functions = positionMotion.get_functions();
+    const FunctionSet& current = m_position_motion_base->get_functions();
+    OPENSIM_THROW_IF(functions.getSize() != current.getSize(), Exception,
+            "Expected the PositionMotion to have {} functions, but it has {}.",
+            current.getSize(), functions.getSize());
+    for (int i = 0; i < current.getSize(); ++i) {
+        OPENSIM_THROW_IF(!functions.contains(current.get(i).getName()),
+                Exception, "Expected the PositionMotion to have a function "
+                           "for coordinate '{}'.",
+                current.get(i).getName());
+    }
+    // TODO: Avoid these const_casts.
+    const_cast<PositionMotion&>(*m_position_motion_base).upd_functions() =
+            functions;
+    const_cast<PositionMotion&>(*m_position_motion_disabled_constraints)
+            .upd_functions() = functions;
+    reinitializeModels();
+}
 
-        m_state_disabled_constraints[0] =
-                m_model_disabled_constraints_const_cast.initSystem();
-        m_state_disabled_constraints[1] = m_state_disabled_constraints[0];
-        // See comment above for m_position_motion_base.
-        if (m_position_motion_disabled_constraints) {
-            for (auto& stateDisCon : m_state_disabled_constraints) {
-                m_position_motion_disabled_constraints->setEnabled(
-                        stateDisCon, true);
-            }
+void MocoProblemRep::reinitializeModels() const {
+    // TODO: Avoid these const_casts.
+
+    // Model base.
+    // -----------
+    const_cast<Model&>(m_model_base).initSystem();
+    // The PrescribedMotion is disabled by default in the model so that,
+    // if there are constraints, the AssemblySolver does not complain about
+    // having 0 parameters with which to satisfy the constraints. After
+    // we're done with the assembly in initSystem(), we can re-enable the
+    // prescribed motion.
+    if (m_position_motion_base) {
+        m_position_motion_base->setEnabled(m_state_base, true);
+    }
+
+    // Model disable constraints.
+    // --------------------------
+    Model& m_model_disabled_constraints_const_cast =
+            const_cast<Model&>(m_model_disabled_constraints);
+
+    m_state_disabled_constraints[0] =
+            m_model_disabled_constraints_const_cast.initSystem();
+    m_state_disabled_constraints[1] = m_state_disabled_constraints[0];
+    // See comment above for m_position_motion_base.
+    if (m_position_motion_disabled_constraints) {
+        for (auto& stateDisCon : m_state_disabled_constraints) {
+            m_position_motion_disabled_constraints->setEnabled(
+                    stateDisCon, true);
         }
+    }
 
-        // Re-disable constraints if they were enabled by the previous
-        // initSystem() call.
-        auto& matterDisabledConstraints =
-                m_model_disabled_constraints_const_cast.updMatterSubsystem();
-        const auto NC = matterDisabledConstraints.getNumConstraints();
-        for (SimTK::ConstraintIndex cid(0); cid < NC; ++cid) {
-            SimTK::Constraint& constraintToDisable =
-                    matterDisabledConstraints.updConstraint(cid);
-            for (auto& stateDisCon : m_state_disabled_constraints) {
-                if (!constraintToDisable.isDisabled(stateDisCon)) {
-                    constraintToDisable.disable(stateDisCon);
-                }
+    // Re-disable constraints if they were enabled by the previous
+    // initSystem() call.
+    auto& matterDisabledConstraints =
+            m_model_disabled_constraints_const_cast.updMatterSubsystem();
+    const auto NC = matterDisabledConstraints.getNumConstraints();
+    for (SimTK::ConstraintIndex cid(0); cid < NC; ++cid) {
+        SimTK::Constraint& constraintToDisable =
+                matterDisabledConstraints.updConstraint(cid);
+        for (auto& stateDisCon : m_state_disabled_constraints) {
+            if (!constraintToDisable.isDisabled(stateDisCon)) {
+                constraintToDisable.disable(stateDisCon);
             }
         }
     }
@@ -29,6 +29,10 @@
 #include <OpenSim/Common/Assertion.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Actuators/DeGrooteFregly2016Muscle.h>
+#include <OpenSim/Actuators/DeGrooteFregly2016MuscleBatch.h>
+
+#include <memory>
+#include <mutex>
 
 namespace OpenSim {
 
@@ -68,11 +72,13 @@ public:
     MocoProblemRep(const MocoProblemRep&) = delete;
     MocoProblemRep& operator=(const MocoProblemRep&) = delete;
     MocoProblemRep(MocoProblemRep&& source)
-            : m_problem(std::move(source.m_problem)) {
+            : m_problem(std::move(source.m_problem)),
+              m_processed_model(std::move(source.m_processed_model)) {
         if (m_problem) initialize();
     }
     MocoProblemRep& operator=(MocoProblemRep&& source) {
         m_problem = std::move(source.m_problem);
+        m_processed_model = std::move(source.m_processed_model);
         if (m_problem) initialize();
         return *this;
     }
@@ -117,6 +123,18 @@ public:
         OPENSIM_ASSERT(index <= 1);
         return m_state_disabled_constraints[index];
     }
+    /// Compute the length, velocity, and dynamics info of all
+    /// DeGrooteFregly2016Muscle%s in ModelDisabledConstraints at once (see
+    /// DeGrooteFregly2016MuscleBatch). Solvers can call this after setting
+    /// the state and controls, just before realizing the state to
+    /// Stage::Dynamics or later. This realizes the state to Stage::Velocity.
+    /// This does nothing if the problem has parameters, since they may change
+    /// the muscles' properties.
+    void calcMuscleInfosDisabledConstraints(const SimTK::State& state) const {
+        if (!m_muscle_batch_disabled_constraints) return;
+        m_model_disabled_constraints.realizeVelocity(state);
+        m_muscle_batch_disabled_constraints->calcMuscleInfos(state);
+    }
     /// This is a component inside ModelDisabledConstraints that you can use to
     /// set the value of control signals.
     const ControlDistributor& getControlDistributorDisabledConstraints() const {
@@ -326,6 +344,14 @@ public:
     void applyParametersToModelProperties(const SimTK::Vector& parameterValues,
             bool initSystemAndDisableConstraints = false) const;
 
+    /// Replace the functions of the PositionMotion in the models with those of
+    /// the given PositionMotion, which must prescribe the same coordinates,
+    /// and call initSystem() on each model (re-disabling constraints as with
+    /// applyParametersToModelProperties()). This allows solving the problem
+    /// for other kinematics without creating a new MocoProblemRep.
+    /// @precondition isPrescribedKinematics()
+    void updatePrescribedKinematics(const PositionMotion& positionMotion) const;
+
     /// Get a vector of reference pointers to model outputs that return residual
     /// values for any components with dynamics in implicit forms. The 
     /// references returned are from the model returned by 
@@ -385,12 +411,32 @@ public:
     }
     /// @}
 
+    /// The wall-clock time (in seconds) spent in each step of creating this
+    /// MocoProblemRep, in the order the steps occurred. Solvers use this to
+    /// report the time spent before solving.
+    const std::vector<std::pair<std::string, double>>&
+    getInitializationTimes() const {
+        return m_initialization_times;
+    }
+
 private:
     explicit MocoProblemRep(const MocoProblem& problem);
+    /// Use a copy of the given model instead of processing the MocoProblem's
+    /// ModelProcessor; the model must be the result of processing it.
+    MocoProblemRep(const MocoProblem& problem,
+            std::shared_ptr<const Model> processedModel);
     friend MocoProblem;
 
     void initialize();
 
+    /// Processing and connecting models and initializing goals may read
+    /// files relative to the working directory, which is shared by all
+    /// threads and which some components change temporarily (e.g.,
+    /// ExternalLoads and ContactMesh use IO::CwdChanger). MocoProblemReps
+    /// created concurrently (see MocoProblem::createRepsHeap()) hold this
+    /// mutex only for those steps.
+    static std::mutex& getWorkingDirectoryMutex();
+
     /// Get a list of reference pointers to all outputs whose names (not paths)
     /// match a substring defined by a provided regex string pattern. The regex
     /// string pattern could be the full name of the output. Only Output%s that
@@ -438,6 +484,10 @@ private:
         return outputs;
     }
 
+    /// Call initSystem() on the models after their properties have changed,
+    /// and re-enable the PositionMotion and re-disable the constraints.
+    void reinitializeModels() const;
+
     /// A helper function to get the controls from the model with disabled
     /// constraints. This function is used when the model contains user-defined
     /// controllers, which require the controls to be computed from the model.
@@ -449,6 +499,8 @@ private:
     }
 
     const MocoProblem* m_problem;
+    std::shared_ptr<const Model> m_processed_model;
+    std::vector<std::pair<std::string, double>> m_initialization_times;
 
     Model m_model_base;
     mutable SimTK::State m_state_base;
@@ -463,6 +515,8 @@ private:
             m_position_motion_disabled_constraints;
     SimTK::ReferencePtr<DiscreteForces> m_constraint_forces;
     SimTK::ReferencePtr<AccelerationMotion> m_acceleration_motion;
+    std::unique_ptr<DeGrooteFregly2016MuscleBatch>
+            m_muscle_batch_disabled_constraints;
 
     bool m_prescribedKinematics = false;
     bool m_computeControlsFromModel = false;
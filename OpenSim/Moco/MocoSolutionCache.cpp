@@ -0,0 +1,397 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: MocoSolutionCache.cpp                                             *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoSolutionCache.h"
+
+#include "MocoCasADiSolver/MocoCasADiSolver.h"
+#include "MocoProblem.h"
+#include "MocoStudy.h"
+#include "MocoTropterSolver.h"
+
+#include <OpenSim/Common/IO.h>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+using namespace OpenSim;
+
+namespace {
+    /// 64-bit FNV-1a hash. Unlike std::hash, the result does not depend on
+    /// the standard library implementation, so keys are stable on disk.
+    class Hasher {
+    public:
+        void update(const std::string& text) {
+            for (const unsigned char c : text) {
+                m_hash ^= c;
+                m_hash *= 1099511628211ull;
+            }
+            // Separate consecutive inputs.
+            m_hash ^= 0xff;
+            m_hash *= 1099511628211ull;
+        }
+        std::string hex() const { return fmt::format("{:016x}", m_hash); }
+
+    private:
+        unsigned long long m_hash = 14695981039346656037ull;
+    };
+
+    std::string readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.good()) return {};
+        std::stringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+
+    /// Replace each numeric literal in the text with '#' and collect the
+    /// values. Digits that are part of a name (e.g., "muscle1") are kept.
+    std::string stripNumbers(const std::string& text,
+            std::vector<double>* values = nullptr) {
+        std::string stripped;
+        stripped.reserve(text.size());
+        const char* begin = text.c_str();
+        const char* end = begin + text.size();
+        const char* p = begin;
+        while (p < end) {
+            const bool afterName = p > begin &&
+                    (std::isalnum((unsigned char)p[-1]) || p[-1] == '_');
+            const bool startsNumber =
+                    std::isdigit((unsigned char)p[0]) ||
+                    ((p[0] == '-' || p[0] == '+' || p[0] == '.') &&
+                            p + 1 < end &&
+                            std::isdigit((unsigned char)p[1]));
+            if (!afterName && startsNumber) {
+                char* numberEnd = nullptr;
+                const double value = std::strtod(p, &numberEnd);
+                if (numberEnd > p) {
+                    if (values) values->push_back(value);
+                    stripped.push_back('#');
+                    p = numberEnd;
+                    continue;
+                }
+            }
+            stripped.push_back(*p);
+            ++p;
+        }
+        return stripped;
+    }
+
+    /// The names and values of a trajectory, for hashing a guess that was
+    /// set through the API rather than a file.
+    std::string serializeTrajectory(const MocoTrajectory& trajectory) {
+        if (trajectory.empty()) return {};
+        std::string text;
+        const auto appendNames = [&](const std::vector<std::string>& names) {
+            for (const auto& name : names) text += name + ",";
+            text += "\n";
+        };
+        const auto appendVector = [&](const SimTK::Vector& vector) {
+            for (int i = 0; i < vector.size(); ++i) {
+                text += fmt::format("{:.17g},", vector[i]);
+            }
+            text += "\n";
+        };
+        const auto appendMatrix = [&](const SimTK::Matrix& matrix) {
+            for (int i = 0; i < matrix.nrow(); ++i) {
+                for (int j = 0; j < matrix.ncol(); ++j) {
+                    text += fmt::format("{:.17g},", matrix(i, j));
+                }
+            }
+            text += "\n";
+        };
+        appendVector(trajectory.getTime());
+        appendNames(trajectory.getStateNames());
+        appendMatrix(trajectory.getStatesTrajectory());
+        appendNames(trajectory.getControlNames());
+        appendMatrix(trajectory.getControlsTrajectory());
+        appendNames(trajectory.getInputControlNames());
+        appendMatrix(trajectory.getInputControlsTrajectory());
+        appendNames(trajectory.getMultiplierNames());
+        appendMatrix(trajectory.getMultipliersTrajectory());
+        appendNames(trajectory.getDerivativeNames());
+        appendMatrix(trajectory.getDerivativesTrajectory());
+        appendNames(trajectory.getSlackNames());
+        appendMatrix(trajectory.getSlacksTrajectory());
+        appendNames(trajectory.getParameterNames());
+        appendVector(trajectory.getParameters().transpose());
+        return text;
+    }
+
+    double computeDistance(
+            const std::vector<double>& a, const std::vector<double>& b) {
+        if (a.size() != b.size()) return SimTK::Infinity;
+        double distance = 0;
+        for (int i = 0; i < (int)a.size(); ++i) {
+            const double relative =
+                    (a[i] - b[i]) / (1.0 + std::abs(a[i]) + std::abs(b[i]));
+            distance += relative * relative;
+        }
+        return distance;
+    }
+
+    void writeAtomically(const std::string& path,
+            const std::function<void(const std::string&)>& writer) {
+        // The temporary file name is unique to this thread and time so that
+        // processes sharing the cache do not write to the same file.
+        const std::string temp = fmt::format("{}.{:x}.{}.tmp", path,
+                std::hash<std::thread::id>()(std::this_thread::get_id()),
+                SimTK::realTimeInNs());
+        writer(temp);
+#ifdef _WIN32
+        // rename() does not replace an existing file on Windows. Elsewhere,
+        // it replaces the file atomically, so readers never find it missing.
+        std::remove(path.c_str());
+#endif
+        OPENSIM_THROW_IF(std::rename(temp.c_str(), path.c_str()) != 0,
+                Exception, "Could not write '{}'.", path);
+    }
+}
+
+MocoSolutionCache::MocoSolutionCache(std::string directory)
+        : m_directory(std::move(directory)) {
+    OPENSIM_THROW_IF(m_directory.empty(), Exception,
+            "Expected a cache directory, but got an empty string.");
+    IO::makeDir(m_directory);
+}
+
+std::string MocoSolutionCache::getPath(const std::string& filename) const {
+    return m_directory + SimTK::Pathname::getPathSeparator() + filename;
+}
+
+MocoSolutionCache::Key MocoSolutionCache::computeKeyInternal(
+        const MocoStudy& study) {
+    const MocoProblem& problem = study.getProblem();
+    const MocoSolver& solver = study.getSolver();
+    const std::string problemXML = problem.dump();
+    const std::string solverXML = solver.dump();
+
+    std::string modelContents;
+    for (int i = 0; i < problem.getNumPhases(); ++i) {
+        const auto& filepath = problem.getPhase(i).getModelProcessor()
+                .get_filepath();
+        if (!filepath.empty()) modelContents += readFile(filepath);
+    }
+    std::string guessContents;
+    if (const auto* dcSolver =
+                dynamic_cast<const MocoDirectCollocationSolver*>(&solver)) {
+        if (!dcSolver->get_guess_file().empty()) {
+            guessContents = readFile(dcSolver->get_guess_file());
+        }
+    }
+    // A guess given to setGuess() is not part of the serialized solver.
+    if (const auto* casadi = dynamic_cast<const MocoCasADiSolver*>(&solver)) {
+        guessContents += serializeTrajectory(casadi->m_guessFromAPI);
+    } else if (const auto* tropter =
+                       dynamic_cast<const MocoTropterSolver*>(&solver)) {
+        guessContents += serializeTrajectory(tropter->m_guessFromAPI);
+    }
+
+    Key key;
+    Hasher exact;
+    exact.update(problemXML);
+    exact.update(solverXML);
+    exact.update(modelContents);
+    exact.update(guessContents);
+    key.exact = exact.hex();
+
+    Hasher structure;
+    structure.update(stripNumbers(problemXML, &key.values));
+    structure.update(stripNumbers(solverXML));
+    structure.update(stripNumbers(modelContents));
+    key.structure = structure.hex();
+    return key;
+}
+
+std::string MocoSolutionCache::computeKey(const MocoStudy& study) {
+    return computeKeyInternal(study).exact;
+}
+
+std::vector<MocoSolutionCache::Key> MocoSolutionCache::readIndex() const {
+    std::vector<Key> entries;
+    std::ifstream index(getPath("index.txt"));
+    std::string line;
+    while (std::getline(index, line)) {
+        std::istringstream fields(line);
+        Key entry;
+        std::string values;
+        if (!std::getline(fields, entry.exact, '\t')) continue;
+        if (!std::getline(fields, entry.structure, '\t')) continue;
+        std::getline(fields, values);
+        std::istringstream valueStream(values);
+        std::string value;
+        while (std::getline(valueStream, value, ',')) {
+            entry.values.push_back(std::strtod(value.c_str(), nullptr));
+        }
+        entries.push_back(std::move(entry));
+    }
+    return entries;
+}
+
+bool MocoSolutionCache::entryExists(const std::string& exact) const {
+    return std::ifstream(getPath(exact + ".txt")).good() &&
+           std::ifstream(getPath(exact + ".sto")).good();
+}
+
+bool MocoSolutionCache::contains(const MocoStudy& study) const {
+    return entryExists(computeKey(study));
+}
+
+MocoSolution MocoSolutionCache::load(const std::string& exact) const {
+    MocoSolution solution(getPath(exact + ".sto"));
+    std::ifstream stats(getPath(exact + ".txt"));
+    std::vector<std::pair<std::string, double>> breakdown;
+    std::string line;
+    while (std::getline(stats, line)) {
+        const auto tab = line.find('\t');
+        if (tab == std::string::npos) continue;
+        const std::string name = line.substr(0, tab);
+        const std::string value = line.substr(tab + 1);
+        if (name == "objective") {
+            solution.setObjective(std::strtod(value.c_str(), nullptr));
+        } else if (name == "status") {
+            solution.setStatus(value);
+        } else if (name == "num_iterations") {
+            solution.setNumIterations(std::atoi(value.c_str()));
+        } else if (name == "solver_duration") {
+            solution.setSolverDuration(std::strtod(value.c_str(), nullptr));
+        } else if (name.compare(0, 15, "objective_term:") == 0) {
+            breakdown.emplace_back(name.substr(15),
+                    std::strtod(value.c_str(), nullptr));
+        }
+    }
+    solution.setObjectiveBreakdown(std::move(breakdown));
+    solution.setSuccess(true);
+    return solution;
+}
+
+void MocoSolutionCache::add(
+        const MocoStudy& study, const MocoSolution& solution) const {
+    if (!solution.success()) return;
+    const Key key = computeKeyInternal(study);
+
+    writeAtomically(getPath(key.exact + ".sto"),
+            [&](const std::string& path) { solution.write(path); });
+    writeAtomically(getPath(key.exact + ".txt"),
+            [&](const std::string& path) {
+                std::ofstream f(path);
+                OPENSIM_THROW_IF(!f.good(), Exception,
+                        "Could not open file '{}' for writing.", path);
+                f << fmt::format("objective\t{:.17g}\n",
+                        solution.getObjective());
+                f << "num_iterations\t" << solution.getNumIterations() << "\n";
+                f << fmt::format("solver_duration\t{:.17g}\n",
+                        solution.getSolverDuration());
+                for (const auto& name : solution.getObjectiveTermNames()) {
+                    f << fmt::format("objective_term:{}\t{:.17g}\n", name,
+                            solution.getObjectiveTerm(name));
+                }
+                f << "status\t" << solution.getStatus() << "\n";
+            });
+
+    // Each entry is appended in a single write so that processes sharing the
+    // cache do not interleave lines.
+    std::string line = key.exact + "\t" + key.structure + "\t";
+    for (int i = 0; i < (int)key.values.size(); ++i) {
+        if (i) line += ",";
+        line += fmt::format("{:.17g}", key.values[i]);
+    }
+    line += "\n";
+    std::ofstream index(getPath("index.txt"), std::ios::app);
+    OPENSIM_THROW_IF(!index.good(), Exception,
+            "Could not open the cache index in '{}'.", m_directory);
+    index << line << std::flush;
+}
+
+void MocoSolutionCache::invalidate(const MocoStudy& study) const {
+    const std::string exact = computeKey(study);
+    std::remove(getPath(exact + ".sto").c_str());
+    std::remove(getPath(exact + ".txt").c_str());
+}
+
+void MocoSolutionCache::clear() const {
+    for (const auto& entry : readIndex()) {
+        std::remove(getPath(entry.exact + ".sto").c_str());
+        std::remove(getPath(entry.exact + ".txt").c_str());
+    }
+    std::remove(getPath("index.txt").c_str());
+}
+
+MocoSolution MocoSolutionCache::solve(const MocoStudy& study) {
+    const Key key = computeKeyInternal(study);
+    if (entryExists(key.exact)) {
+        ++m_numHits;
+        log_info("MocoSolutionCache: hit ({}).", key.exact);
+        return load(key.exact);
+    }
+
+    // Find the nearest entry with the same structure. Later entries for the
+    // same key replace earlier ones, and removed entries are skipped.
+    std::string nearest;
+    double minDistance = SimTK::Infinity;
+    for (const auto& entry : readIndex()) {
+        if (entry.structure != key.structure) continue;
+        if (!entryExists(entry.exact)) continue;
+        const double distance = computeDistance(entry.values, key.values);
+        if (distance <= minDistance) {
+            minDistance = distance;
+            nearest = entry.exact;
+        }
+    }
+
+    std::unique_ptr<MocoSolver> solver(study.getSolver().clone());
+    solver->resetProblem(study.getProblem());
+    bool usedNearest = false;
+    if (!nearest.empty()) {
+        MocoTrajectory guess = load(nearest);
+        // If the cached solution is not a valid guess for this solver (e.g.,
+        // the model has other states), solve without it.
+        try {
+            if (auto* casadi = dynamic_cast<MocoCasADiSolver*>(solver.get())) {
+                if (casadi->getGuess().empty()) {
+                    casadi->setGuess(std::move(guess));
+                    usedNearest = true;
+                }
+            } else if (auto* tropter = dynamic_cast<MocoTropterSolver*>(
+                               solver.get())) {
+                if (tropter->getGuess().empty()) {
+                    tropter->setGuess(std::move(guess));
+                    usedNearest = true;
+                }
+            }
+        } catch (const Exception& e) {
+            log_warn("MocoSolutionCache: could not use {} as the initial "
+                     "guess: {}",
+                    nearest, e.getMessage());
+        }
+    }
+    if (usedNearest) {
+        ++m_numNearHits;
+        log_info("MocoSolutionCache: near hit; using {} as the initial guess.",
+                nearest);
+    } else {
+        ++m_numMisses;
+        log_info("MocoSolutionCache: miss ({}).", key.exact);
+    }
+
+    MocoSolution solution = solver->solve();
+    add(study, solution);
+    return solution;
+}
@@ -0,0 +1,129 @@
+#ifndef OPENSIM_MOCOSOLUTIONCACHE_H
+#define OPENSIM_MOCOSOLUTIONCACHE_H
+/* -------------------------------------------------------------------------- *
+ * OpenSim: MocoSolutionCache.h                                               *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoTrajectory.h"
+#include "osimMocoDLL.h"
+
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+
+class MocoStudy;
+
+/** An on-disk cache of MocoSolution%s, keyed by the content of a MocoStudy.
+This is useful when running many similar MocoStudy%s (e.g., parameter sweeps)
+or re-running studies after an interruption.
+
+The key for a study is a hash of the serialized MocoProblem and MocoSolver,
+the content of the model file (if the problem's ModelProcessor uses a file),
+and the solver's guess (the content of the guess file, or the guess given to
+setGuess()). Therefore, editing the problem, the solver settings, the guess,
+or the model file invalidates the cached solution automatically. Other files referenced by the problem (e.g., tables
+used by tracking goals, or mesh geometry) are not part of the key.
+
+When solving a study with solve():
+- **hit**: if the cache contains a solution for the same key, the cached
+  solution is returned without solving.
+- **near hit**: otherwise, if the cache contains a solution for a problem with
+  the same structure (the serialized problem and solver are the same except
+  for numeric values such as goal weights, bounds, time bounds, or the number
+  of mesh intervals), the solution for the nearest such problem is used as
+  the initial guess, unless the solver already has a guess or the solution
+  is not a valid guess. The distance between problems is based on the
+  relative differences between the numeric values of the problems.
+- **miss**: otherwise, the study is solved as usual.
+
+Only successful solutions are added to the cache. The cache directory
+contains an index file (`index.txt`) and, for each entry, the solution
+trajectory (`<key>.sto`) and the solution statistics (`<key>.txt`).
+Multiple processes may share a cache directory; entries are written to a
+temporary file and then renamed.
+
+MocoStudy uses this class if its `solution_cache_directory` property is set.
+@code
+MocoSolutionCache cache("moco_cache");
+for (double weight : {0.1, 0.2, 0.3}) {
+    study.updProblem().updGoal("effort").setWeight(weight);
+    MocoSolution solution = cache.solve(study);
+}
+log_info("{} hits, {} near hits, {} misses.", cache.getNumHits(),
+        cache.getNumNearHits(), cache.getNumMisses());
+@endcode */
+class OSIMMOCO_API MocoSolutionCache {
+public:
+    /// The directory is created if it does not exist.
+    explicit MocoSolutionCache(std::string directory);
+
+    const std::string& getDirectory() const { return m_directory; }
+
+    /// Return the cached solution for the study, or solve the study (using
+    /// a near match as the initial guess, if available) and add the solution
+    /// to the cache. This does not write the solution to the study's results
+    /// directory; use MocoStudy::solve() for that.
+    MocoSolution solve(const MocoStudy& study);
+
+    /// Does the cache contain a solution for exactly this study?
+    bool contains(const MocoStudy& study) const;
+
+    /// Add a successful solution for the study to the cache, replacing any
+    /// existing solution for the same key. Unsuccessful solutions are
+    /// ignored.
+    void add(const MocoStudy& study, const MocoSolution& solution) const;
+
+    /// Remove the cached solution for the study, if any.
+    void invalidate(const MocoStudy& study) const;
+
+    /// Remove all cached solutions.
+    void clear() const;
+
+    /// @name Statistics
+    /// The number of hits, near hits, and misses in calls to solve() on this
+    /// object.
+    /// @{
+    int getNumHits() const { return m_numHits; }
+    int getNumNearHits() const { return m_numNearHits; }
+    int getNumMisses() const { return m_numMisses; }
+    void resetStats() { m_numHits = m_numNearHits = m_numMisses = 0; }
+    /// @}
+
+    /// The key for a study, as a hexadecimal string. See the class
+    /// description.
+    static std::string computeKey(const MocoStudy& study);
+
+private:
+    struct Key {
+        std::string exact;
+        std::string structure;
+        std::vector<double> values;
+    };
+    static Key computeKeyInternal(const MocoStudy& study);
+    std::vector<Key> readIndex() const;
+    std::string getPath(const std::string& filename) const;
+    bool entryExists(const std::string& exact) const;
+    MocoSolution load(const std::string& exact) const;
+
+    std::string m_directory;
+    int m_numHits = 0;
+    int m_numNearHits = 0;
+    int m_numMisses = 0;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MOCOSOLUTIONCACHE_H
@@ -19,6 +19,7 @@
 
 #include "MocoProblem.h"
 
+#include <OpenSim/Common/Stopwatch.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
 
 using namespace OpenSim;
@@ -90,6 +91,11 @@ void MocoSolver::resetProblem(const MocoProblem& problem) const {
     m_problemRep = problem.createRep();
 }
 
+void MocoSolver::recreateProblemRep() const {
+    OPENSIM_THROW_IF(!m_problem, Exception, "Problem not set.");
+    m_problemRep = m_problem->createRep();
+}
+
 MocoSolution MocoSolver::solve() const {
     OPENSIM_THROW_IF(!m_problem, Exception, "Problem not set.");
     return solveImpl();
@@ -107,11 +113,31 @@ void MocoSolver::setSolutionStats(MocoSolution& sol, bool success,
     sol.setObjectiveBreakdown(std::move(objectiveBreakdown));
 }
 
+void MocoSolver::setSolutionProfile(MocoSolution& sol, std::string profile) {
+    sol.setSolverProfile(std::move(profile));
+}
+
 std::unique_ptr<ThreadsafeJar<const MocoProblemRep>>
         MocoSolver::createProblemRepJar(int size) const {
     auto jar = OpenSim::make_unique<ThreadsafeJar<const MocoProblemRep>>();
-    for (int i = 0; i < size; ++i) {
-        jar->leave(std::unique_ptr<MocoProblemRep>(m_problem->createRepHeap()));
+    Stopwatch stopwatch;
+    auto reps = m_problem->createRepsHeap(size, size);
+    if (reps.empty()) { return jar; }
+
+    // Report the average time of each step of creating a MocoProblemRep.
+    std::string steps;
+    const auto& firstTimes = reps.front()->getInitializationTimes();
+    for (int istep = 0; istep < (int)firstTimes.size(); ++istep) {
+        double sum = 0;
+        for (const auto& rep : reps) {
+            sum += rep->getInitializationTimes()[istep].second;
+        }
+        steps += fmt::format("{}{}: {:.3f} s", istep ? ", " : "",
+                firstTimes[istep].first, sum / size);
     }
+    log_info("Created {} copies of the problem in {} (average per copy: {}).",
+            size, stopwatch.getElapsedTimeFormatted(), steps);
+
+    for (auto& rep : reps) { jar->leave(std::move(rep)); }
     return jar;
 }
@@ -28,6 +28,7 @@
 namespace OpenSim {
 
 class MocoStudy;
+class MocoSolutionCache;
 
 /** Once the solver is created, you should not make any edits to the
 MocoProblem. If you do, you must call resetProblem(const MocoProblem&
@@ -88,11 +89,18 @@ protected:
             double duration,
             std::vector<std::pair<std::string, double>> objectiveBreakdown =
                     {});
+    /// Attach a profile of where the solver spent its time to the solution.
+    /// See MocoSolution::getSolverProfile().
+    static void setSolutionProfile(MocoSolution&, std::string profile);
 
     const MocoProblemRep& getProblemRep() const {
         return m_problemRep;
     }
 
+    /// Recreate the MocoProblemRep from the problem passed to
+    /// resetProblem(), to include edits made to the problem since then.
+    void recreateProblemRep() const;
+
     /// Create a library of MocoProblemRep%s for use in parallelized code.
     // TODO SWIG ignore.
     std::unique_ptr<ThreadsafeJar<const MocoProblemRep>>
@@ -105,6 +113,7 @@ private:
     // whether they should call MocoStudy::solve() or MocoSolver::solve().
     MocoSolution solve() const;
     friend MocoStudy;
+    friend MocoSolutionCache;
 
     /// This is the meat of a solver: solve the problem and return the solution.
     virtual MocoSolution solveImpl() const = 0;
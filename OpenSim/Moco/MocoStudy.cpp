@@ -19,6 +19,7 @@
 
 #include "MocoCasADiSolver/MocoCasADiSolver.h"
 #include "MocoProblem.h"
+#include "MocoSolutionCache.h"
 #include "MocoTropterSolver.h"
 #include "MocoUtilities.h"
 #include <regex>
@@ -40,6 +41,7 @@ MocoStudy::MocoStudy(const std::string& omocoFile) : Object(omocoFile) {
 void MocoStudy::constructProperties() {
     constructProperty_write_solution(false);
     constructProperty_results_directory("./");
+    constructProperty_solution_cache_directory("");
     constructProperty_problem(MocoProblem());
     constructProperty_solver(MocoCasADiSolver());
 }
@@ -78,10 +80,17 @@ MocoCasADiSolver& MocoStudy::initCasADiSolver() {
 
 MocoSolver& MocoStudy::updSolver() { return updSolver<MocoSolver>(); }
 
-MocoSolution MocoStudy::solve() const {
-    initSolverInternal();
+const MocoSolver& MocoStudy::getSolver() const { return get_solver(); }
 
-    MocoSolution solution = get_solver().solve();
+MocoSolution MocoStudy::solve() const {
+    MocoSolution solution;
+    if (get_solution_cache_directory().empty()) {
+        initSolverInternal();
+        solution = get_solver().solve();
+    } else {
+        MocoSolutionCache cache(get_solution_cache_directory());
+        solution = cache.solve(*this);
+    }
 
     bool originallySealed = solution.isSealed();
     if (get_write_solution()) {
@@ -96,6 +105,11 @@ MocoSolution MocoStudy::solve() const {
         } catch (const TimestampGreaterThanEqualToNext&) {
             log_warn("Could not write solution to file...skipping.");
         }
+        if (!solution.getSolverProfile().empty()) {
+            solution.writeSolverProfile(get_results_directory() +
+                                        SimTK::Pathname::getPathSeparator() +
+                                        prefix + "_solution_profile.csv");
+        }
         if (originallySealed) solution.seal();
     }
     return solution;
@@ -93,6 +93,10 @@ public:
     OpenSim_DECLARE_PROPERTY(results_directory, std::string,
             "Provide the folder path (relative to working directory) to which "
             "the solution file should be written. Default: './'.");
+    OpenSim_DECLARE_PROPERTY(solution_cache_directory, std::string,
+            "If not empty, solve() looks up the solution in a "
+            "MocoSolutionCache in this folder before solving, and adds new "
+            "solutions to the cache. Default: '' (no cache).");
 
     MocoStudy();
 
@@ -133,11 +137,17 @@ public:
     /// return type; otherwise, you'll make a copy of the solver, and the copy
     /// will have no effect on this MocoStudy.
     MocoSolver& updSolver();
+    /// Access the solver without modifying it.
+    const MocoSolver& getSolver() const;
 
     /// Solve the provided MocoProblem using the provided MocoSolver, and obtain
     /// the solution to the problem. If the write_solution property is true,
     /// then the solution is also written to disk in the directory specified in
-    /// the results_directory property.
+    /// the results_directory property. If the solver recorded a profile
+    /// (see MocoSolution::getSolverProfile()), the profile is written next to
+    /// the solution with the suffix `_solution_profile.csv`.
+    /// If the solution_cache_directory property is set, the solution may come
+    /// from (and is added to) a MocoSolutionCache.
     /// @precondition
     ///     You must have finished setting up both the problem and solver.
     /// This reinitializes the solver so that any changes you have made will
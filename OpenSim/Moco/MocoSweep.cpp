@@ -0,0 +1,390 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: MocoSweep.cpp                                                     *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoSweep.h"
+
+#include "MocoCasADiSolver/MocoCasADiSolver.h"
+
+#include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/Stopwatch.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace OpenSim;
+
+namespace {
+    std::vector<std::string> split(const std::string& text, char delimiter) {
+        std::vector<std::string> fields;
+        std::istringstream stream(text);
+        std::string field;
+        while (std::getline(stream, field, delimiter)) {
+            IO::TrimWhitespace(field);
+            fields.push_back(field);
+        }
+        // A trailing delimiter denotes an empty last field.
+        if (!text.empty() && text.back() == delimiter) fields.emplace_back();
+        return fields;
+    }
+
+    bool isInteger(const std::string& text) {
+        return !text.empty() &&
+               text.find_first_not_of("0123456789") == std::string::npos;
+    }
+}
+
+MocoSweep::MocoSweep(MocoStudy baseStudy) : m_baseStudy(std::move(baseStudy)) {}
+
+void MocoSweep::setOverrides(std::vector<std::string> propertyPaths,
+        std::vector<std::vector<std::string>> rows) {
+    for (int irow = 0; irow < (int)rows.size(); ++irow) {
+        OPENSIM_THROW_IF(rows[irow].size() != propertyPaths.size(), Exception,
+                "Expected row {} of the overrides to have {} values, but it "
+                "has {}.",
+                irow, propertyPaths.size(), rows[irow].size());
+    }
+    m_nameColumn = -1;
+    for (int icol = 0; icol < (int)propertyPaths.size(); ++icol) {
+        if (propertyPaths[icol] == "name") m_nameColumn = icol;
+    }
+    m_propertyPaths = std::move(propertyPaths);
+    m_rows = std::move(rows);
+}
+
+void MocoSweep::setOverridesFromFile(const std::string& csvFile) {
+    std::ifstream file(csvFile);
+    OPENSIM_THROW_IF(!file.good(), Exception,
+            "Could not open the overrides file '{}'.", csvFile);
+    std::vector<std::string> propertyPaths;
+    std::vector<std::vector<std::string>> rows;
+    std::string line;
+    while (std::getline(file, line)) {
+        IO::TrimWhitespace(line);
+        if (line.empty() || line[0] == '#') continue;
+        if (propertyPaths.empty()) {
+            propertyPaths = split(line, ',');
+        } else {
+            rows.push_back(split(line, ','));
+        }
+    }
+    OPENSIM_THROW_IF(propertyPaths.empty(), Exception,
+            "The overrides file '{}' does not contain a header row.", csvFile);
+    setOverrides(std::move(propertyPaths), std::move(rows));
+}
+
+std::string MocoSweep::getRunName(int run) const {
+    OPENSIM_THROW_IF(run < 0 || run >= getNumRuns(), IndexOutOfRange,
+            (size_t)run, 0, (size_t)getNumRuns() - 1);
+    if (m_nameColumn >= 0) return m_rows[run][m_nameColumn];
+    return fmt::format("run{:04d}", run);
+}
+
+void MocoSweep::setPropertyValueByPath(Object& root,
+        const std::string& propertyPath, const std::string& value) {
+    std::vector<std::string> names;
+    for (const auto& name : split(propertyPath, '/')) {
+        if (!name.empty()) names.push_back(name);
+    }
+    OPENSIM_THROW_IF(names.empty(), Exception, "Empty property path.");
+
+    Object* object = &root;
+    for (int i = 0; i < (int)names.size(); ++i) {
+        const std::string& name = names[i];
+        const bool last = i == (int)names.size() - 1;
+        if (object->hasProperty(name)) {
+            AbstractProperty& prop = object->updPropertyByName(name);
+            if (last) {
+                OPENSIM_THROW_IF(prop.isObjectProperty(), Exception,
+                        "Expected '{}' in property path '{}' to be a property "
+                        "with a simple value, but it contains objects.",
+                        name, propertyPath);
+                // Parse the value as if it were read from a file.
+                SimTK::Xml::Element parent("overrides");
+                parent.appendNode(SimTK::Xml::Element(name, value));
+                prop.readFromXMLParentElement(
+                        parent, XMLDocument::getLatestVersion());
+                return;
+            }
+            OPENSIM_THROW_IF(!prop.isObjectProperty(), Exception,
+                    "Property '{}' in property path '{}' does not contain "
+                    "objects.",
+                    name, propertyPath);
+            if (!prop.isListProperty()) {
+                OPENSIM_THROW_IF(prop.size() == 0, Exception,
+                        "Property '{}' in property path '{}' is empty.", name,
+                        propertyPath);
+                object = &prop.updValueAsObject(0);
+                continue;
+            }
+            // Select an element of the list by name or index.
+            const std::string& element = names[++i];
+            Object* selected = nullptr;
+            for (int v = 0; v < prop.size(); ++v) {
+                if (prop.getValueAsObject(v).getName() == element) {
+                    selected = &prop.updValueAsObject(v);
+                    break;
+                }
+            }
+            if (!selected && isInteger(element) &&
+                    std::atoi(element.c_str()) < prop.size()) {
+                selected = &prop.updValueAsObject(std::atoi(element.c_str()));
+            }
+            OPENSIM_THROW_IF(!selected, Exception,
+                    "Property '{}' does not contain an object named (or with "
+                    "index) '{}' in property path '{}'.",
+                    name, element, propertyPath);
+            OPENSIM_THROW_IF(i == (int)names.size() - 1, Exception,
+                    "Property path '{}' ends with an object; expected a "
+                    "property.",
+                    propertyPath);
+            object = selected;
+            continue;
+        }
+
+        // Search the object properties for an object with this name.
+        Object* child = nullptr;
+        for (int p = 0; p < object->getNumProperties() && !child; ++p) {
+            AbstractProperty& prop = object->updPropertyByIndex(p);
+            if (!prop.isObjectProperty()) continue;
+            for (int v = 0; v < prop.size(); ++v) {
+                if (prop.getValueAsObject(v).getName() == name) {
+                    child = &prop.updValueAsObject(v);
+                    break;
+                }
+            }
+        }
+        OPENSIM_THROW_IF(!child, Exception,
+                "'{}' in property path '{}' is neither a property nor an "
+                "object of {} '{}'.",
+                name, propertyPath, object->getConcreteClassName(),
+                object->getName());
+        OPENSIM_THROW_IF(last, Exception,
+                "Property path '{}' ends with an object; expected a property.",
+                propertyPath);
+        object = child;
+    }
+}
+
+MocoStudy MocoSweep::createStudy(int run) const {
+    OPENSIM_THROW_IF(run < 0 || run >= getNumRuns(), IndexOutOfRange,
+            (size_t)run, 0, (size_t)getNumRuns() - 1);
+    MocoStudy study(m_baseStudy);
+    for (int icol = 0; icol < (int)m_propertyPaths.size(); ++icol) {
+        if (icol == m_nameColumn) continue;
+        setPropertyValueByPath(study, m_propertyPaths[icol], m_rows[run][icol]);
+    }
+    return study;
+}
+
+void MocoSweep::setNumWorkers(int numWorkers) {
+    OPENSIM_THROW_IF(numWorkers < 1, Exception,
+            "Expected at least 1 worker, but got {}.", numWorkers);
+    m_numWorkers = numWorkers;
+}
+
+void MocoSweep::setThreadsPerSolve(int threadsPerSolve) {
+    OPENSIM_THROW_IF(threadsPerSolve < 1, Exception,
+            "Expected at least 1 thread per solve, but got {}.",
+            threadsPerSolve);
+    m_threadsPerSolve = threadsPerSolve;
+}
+
+void MocoSweep::setPartition(int index, int count) {
+    OPENSIM_THROW_IF(count < 1 || index < 0 || index >= count, Exception,
+            "Expected 0 <= index < count, but got index {} and count {}.",
+            index, count);
+    m_partitionIndex = index;
+    m_partitionCount = count;
+}
+
+std::string MocoSweep::getPath(const std::string& filename) const {
+    return m_resultsDirectory + SimTK::Pathname::getPathSeparator() +
+           filename;
+}
+
+bool MocoSweep::readCheckpoint(int run, MocoSweepResult& result) const {
+    std::ifstream file(getPath(getRunName(run) + "_result.txt"));
+    if (!file.good()) return false;
+    result = MocoSweepResult();
+    result.name = getRunName(run);
+    result.fromCheckpoint = true;
+    std::string line;
+    while (std::getline(file, line)) {
+        const auto tab = line.find('\t');
+        if (tab == std::string::npos) continue;
+        const std::string key = line.substr(0, tab);
+        const std::string value = line.substr(tab + 1);
+        if (key == "success") {
+            result.success = value == "true";
+        } else if (key == "objective") {
+            result.objective = std::strtod(value.c_str(), nullptr);
+        } else if (key == "num_iterations") {
+            result.numIterations = std::atoi(value.c_str());
+        } else if (key == "solver_duration") {
+            result.solverDuration = std::strtod(value.c_str(), nullptr);
+        } else if (key == "status") {
+            result.status = value;
+        }
+    }
+    return true;
+}
+
+void MocoSweep::writeCheckpoint(const MocoSweepResult& result) const {
+    // Write to a temporary file and rename it, so that a checkpoint is
+    // either complete or absent.
+    const std::string path = getPath(result.name + "_result.txt");
+    const std::string temp = path + ".tmp";
+    {
+        std::ofstream file(temp);
+        OPENSIM_THROW_IF(!file.good(), Exception,
+                "Could not open file '{}' for writing.", temp);
+        file << "success\t" << (result.success ? "true" : "false") << "\n";
+        file << fmt::format("objective\t{:.17g}\n", result.objective);
+        file << "num_iterations\t" << result.numIterations << "\n";
+        file << fmt::format("solver_duration\t{:.17g}\n",
+                result.solverDuration);
+        file << "status\t" << result.status << "\n";
+        OPENSIM_THROW_IF(!file.good(), Exception,
+                "Could not write file '{}'.", temp);
+    }
+#ifdef _WIN32
+    // rename() does not replace an existing file on Windows. Elsewhere, it
+    // replaces the old checkpoint atomically.
+    std::remove(path.c_str());
+#endif
+    OPENSIM_THROW_IF(std::rename(temp.c_str(), path.c_str()) != 0, Exception,
+            "Could not write '{}'.", path);
+}
+
+MocoSweepResult MocoSweep::solveRun(int run) const {
+    MocoSweepResult result;
+    result.name = getRunName(run);
+    try {
+        MocoStudy study = createStudy(run);
+        study.set_write_solution(false);
+        if (auto* solver = dynamic_cast<MocoCasADiSolver*>(
+                    &study.updSolver())) {
+            // For the `parallel` property, 1 means "all cores".
+            solver->set_parallel(m_threadsPerSolve == 1 ? 0 : m_threadsPerSolve);
+        }
+        MocoSolution solution = study.solve();
+        solution.unseal();
+        result.success = solution.success();
+        result.objective = solution.getObjective();
+        result.numIterations = solution.getNumIterations();
+        result.solverDuration = solution.getSolverDuration();
+        result.status = solution.getStatus();
+        try {
+            solution.write(getPath(result.name + "_solution.sto"));
+        } catch (const TimestampGreaterThanEqualToNext&) {
+            log_warn("MocoSweep: could not write the solution for run "
+                     "'{}'...skipping.", result.name);
+        }
+    } catch (const std::exception& ex) {
+        log_error("MocoSweep: run '{}' failed: {}", result.name, ex.what());
+        result.status = ex.what();
+        // Keep the checkpoint on one line.
+        std::replace(result.status.begin(), result.status.end(), '\n', ' ');
+    }
+
+    // Write the checkpoint last so that an interrupted run is solved again
+    // when resuming. This runs on a worker thread, so a failure to write is
+    // recorded in the result rather than thrown.
+    try {
+        writeCheckpoint(result);
+    } catch (const std::exception& ex) {
+        log_error("MocoSweep: could not write the checkpoint for run '{}': "
+                  "{}", result.name, ex.what());
+        result.success = false;
+        result.status = ex.what();
+        std::replace(result.status.begin(), result.status.end(), '\n', ' ');
+    }
+    return result;
+}
+
+std::vector<MocoSweepResult> MocoSweep::run() const {
+    IO::makeDir(m_resultsDirectory);
+    const Stopwatch stopwatch;
+
+    std::vector<int> runs;
+    for (int run = m_partitionIndex; run < getNumRuns();
+            run += m_partitionCount) {
+        runs.push_back(run);
+    }
+    std::vector<MocoSweepResult> results(runs.size());
+    std::vector<int> toSolve;
+    for (int i = 0; i < (int)runs.size(); ++i) {
+        // Failed runs are solved again (e.g., after fixing the cause) unless
+        // retrying is disabled.
+        if (!readCheckpoint(runs[i], results[i]) ||
+                (!results[i].success && m_retryFailedRuns)) {
+            toSolve.push_back(i);
+        }
+    }
+    log_info("MocoSweep: solving {} of {} runs ({} already finished) with {} "
+             "worker(s) and {} thread(s) per solve.",
+            toSolve.size(), runs.size(), runs.size() - toSolve.size(),
+            m_numWorkers, m_threadsPerSolve);
+
+    std::atomic<int> next(0);
+    std::atomic<int> numFinished(0);
+    auto work = [&]() {
+        for (int i = next++; i < (int)toSolve.size(); i = next++) {
+            const int index = toSolve[i];
+            results[index] = solveRun(runs[index]);
+            log_info("MocoSweep: finished run '{}' ({}/{}): {}.",
+                    results[index].name, ++numFinished, toSolve.size(),
+                    results[index].success ? "success" : "failure");
+        }
+    };
+    const int numWorkers =
+            std::min(m_numWorkers, std::max(1, (int)toSolve.size()));
+    std::vector<std::thread> workers;
+    for (int w = 1; w < numWorkers; ++w) workers.emplace_back(work);
+    work();
+    for (auto& worker : workers) worker.join();
+
+    writeSummary();
+    log_info("MocoSweep: finished in {}.", stopwatch.getElapsedTimeFormatted());
+    return results;
+}
+
+void MocoSweep::writeSummary() const {
+    IO::makeDir(m_resultsDirectory);
+    std::ofstream file(getPath("sweep_summary.csv"));
+    OPENSIM_THROW_IF(!file.good(), Exception,
+            "Could not write the sweep summary in '{}'.", m_resultsDirectory);
+    file << "name";
+    for (int icol = 0; icol < (int)m_propertyPaths.size(); ++icol) {
+        if (icol != m_nameColumn) file << "," << m_propertyPaths[icol];
+    }
+    file << ",success,objective,num_iterations,solver_duration\n";
+    for (int run = 0; run < getNumRuns(); ++run) {
+        MocoSweepResult result;
+        if (!readCheckpoint(run, result)) continue;
+        file << result.name;
+        for (int icol = 0; icol < (int)m_propertyPaths.size(); ++icol) {
+            if (icol != m_nameColumn) file << "," << m_rows[run][icol];
+        }
+        file << fmt::format(",{},{:.17g},{},{:.17g}\n",
+                result.success ? "true" : "false", result.objective,
+                result.numIterations, result.solverDuration);
+    }
+}
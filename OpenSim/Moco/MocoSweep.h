@@ -0,0 +1,178 @@
+#ifndef OPENSIM_MOCOSWEEP_H
+#define OPENSIM_MOCOSWEEP_H
+/* -------------------------------------------------------------------------- *
+ * OpenSim: MocoSweep.h                                                       *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoStudy.h"
+#include "osimMocoDLL.h"
+
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+
+/** The outcome of one run of a MocoSweep. */
+struct OSIMMOCO_API MocoSweepResult {
+    /// The name of the run (see MocoSweep).
+    std::string name;
+    bool success = false;
+    double objective = SimTK::NaN;
+    int numIterations = -1;
+    /// Units: seconds.
+    double solverDuration = SimTK::NaN;
+    /// The solver status, or the error message if solving threw an exception.
+    std::string status;
+    /// Was this result read from a checkpoint rather than solved in this call
+    /// to MocoSweep::run()?
+    bool fromCheckpoint = false;
+};
+
+/** Solve many variations of a MocoStudy, such as for a sensitivity analysis.
+Each run of the sweep is the base study with a set of property values
+overridden. The overrides are a table in which each column is a property
+path and each row is a run.
+
+A property path is a sequence of names separated by slashes, starting from
+the MocoStudy. Each name is the name of a property, or selects an object in
+the preceding list property by name or index, or is the name of an object in
+any of the current object's object properties. The last name must be a
+property with a simple value (e.g., a number, bool, string, or list of
+numbers), and the override value is given in the same format as in XML
+files. For example:
+- `problem/phases/0/goals/effort/weight` (or `problem/phases/0/effort/weight`):
+  the weight of the goal named "effort".
+- `problem/phases/0/time_final_bounds/bounds`: the final time bounds
+  (e.g., "0.5 2").
+- `problem/phases/0/model/filepath`: the model file for the problem.
+- `solver/num_mesh_intervals`: the number of mesh intervals.
+
+Scheduling
+==========
+Solves are scheduled on setNumWorkers() threads, each taking the next
+unfinished run. Each solve is limited to setThreadsPerSolve() threads (via the
+MocoCasADiSolver `parallel` property) so that the workers do not
+oversubscribe the machine; by default, each solve uses a single thread.
+Solvers and libraries may not be safe to use from multiple threads in one
+process (e.g., some of IPOPT's linear solvers), so you can instead divide the
+runs among separate processes (or cluster jobs) with setPartition(); process
+`i` of `n` solves runs `i`, `i + n`, `i + 2n`, etc. The `opensim-cmd sweep`
+command launches such processes for you.
+
+Checkpoints
+===========
+When a run finishes, its solution (`<name>_solution.sto`) and a checkpoint
+file with its result (`<name>_result.txt`) are written to the results
+directory. If the sweep is interrupted, calling run() again (in this or
+another process) skips runs whose checkpoint file records a success; failed
+runs are solved again unless setRetryFailedRuns(false). After all runs in
+this process finish, a summary of all runs with checkpoints, including those
+from other partitions, is written to `sweep_summary.csv`.
+@code
+MocoSweep sweep(study);
+sweep.setOverrides(
+        {"problem/phases/0/effort/weight", "solver/num_mesh_intervals"},
+        {{"0.1", "50"}, {"1.0", "50"}, {"10.0", "100"}});
+sweep.setResultsDirectory("sweep_results");
+sweep.setNumWorkers(4);
+std::vector<MocoSweepResult> results = sweep.run();
+@endcode */
+class OSIMMOCO_API MocoSweep {
+public:
+    explicit MocoSweep(MocoStudy baseStudy);
+
+    /// @name Runs
+    /// @{
+
+    /// Each row has one value per property path. If a path is "name", that
+    /// column provides the name of each run (used for file names); otherwise,
+    /// runs are named `run0000`, `run0001`, etc.
+    void setOverrides(std::vector<std::string> propertyPaths,
+            std::vector<std::vector<std::string>> rows);
+    /// Read the overrides from a comma-separated file whose first row
+    /// contains the property paths. Blank lines and lines starting with '#'
+    /// are ignored.
+    void setOverridesFromFile(const std::string& csvFile);
+
+    int getNumRuns() const { return (int)m_rows.size(); }
+    const std::vector<std::string>& getPropertyPaths() const {
+        return m_propertyPaths;
+    }
+    std::string getRunName(int run) const;
+    /// Create a copy of the base study with the overrides for the given run.
+    MocoStudy createStudy(int run) const;
+    /// @}
+
+    /// @name Scheduling
+    /// @{
+    void setNumWorkers(int numWorkers);
+    int getNumWorkers() const { return m_numWorkers; }
+    void setThreadsPerSolve(int threadsPerSolve);
+    int getThreadsPerSolve() const { return m_threadsPerSolve; }
+    /// Only solve the runs assigned to this process; see the class
+    /// description.
+    void setPartition(int index, int count);
+    /// Should run() solve runs whose checkpoint records a failure (default:
+    /// true)? Set this to false to only collect the results of runs that
+    /// other processes have already attempted.
+    void setRetryFailedRuns(bool retry) { m_retryFailedRuns = retry; }
+    bool getRetryFailedRuns() const { return m_retryFailedRuns; }
+    /// @}
+
+    /// The directory in which solutions and checkpoints are written
+    /// (default: "./"). It is created if it does not exist.
+    void setResultsDirectory(std::string directory) {
+        m_resultsDirectory = std::move(directory);
+    }
+    const std::string& getResultsDirectory() const {
+        return m_resultsDirectory;
+    }
+
+    /// Solve all runs in this process's partition that do not have a
+    /// checkpoint of a successful solve, and return the results of those runs
+    /// (including runs skipped because of a checkpoint). Errors in individual runs are
+    /// logged and reported in the results; they do not stop the sweep.
+    std::vector<MocoSweepResult> run() const;
+
+    /// Write the summary of all runs that have a checkpoint to
+    /// `sweep_summary.csv` in the results directory. run() calls this.
+    void writeSummary() const;
+
+    /// Set a property of an object using a path relative to the object, as
+    /// described above. The value is parsed as in an XML file.
+    static void setPropertyValueByPath(Object& root,
+            const std::string& propertyPath, const std::string& value);
+
+private:
+    std::string getPath(const std::string& filename) const;
+    bool readCheckpoint(int run, MocoSweepResult& result) const;
+    void writeCheckpoint(const MocoSweepResult& result) const;
+    MocoSweepResult solveRun(int run) const;
+
+    MocoStudy m_baseStudy;
+    std::vector<std::string> m_propertyPaths;
+    std::vector<std::vector<std::string>> m_rows;
+    int m_nameColumn = -1;
+    int m_numWorkers = 1;
+    int m_threadsPerSolve = 1;
+    int m_partitionIndex = 0;
+    int m_partitionCount = 1;
+    bool m_retryFailedRuns = true;
+    std::string m_resultsDirectory = "./";
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MOCOSWEEP_H
@@ -21,9 +21,17 @@
 #include "MocoUtilities.h"
 
 #include <OpenSim/Common/Assertion.h>
+#include <OpenSim/Common/BinaryIO.h>
 #include <OpenSim/Common/STOFileAdapter.h>
 #include <OpenSim/Common/GCVSplineSet.h>
+#include <OpenSim/Common/TableResampler.h>
 #include <OpenSim/Simulation/Model/Model.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
 
 using namespace OpenSim;
 
@@ -865,13 +873,6 @@ void MocoTrajectory::resample(SimTK::Vector time) {
                 itime, itime - 1, time[itime], time[itime - 1]);
     }
 
-    int numStates = (int)m_state_names.size();
-    int numControls = (int)m_control_names.size();
-    int numInputControls = (int)m_input_control_names.size();
-    int numMultipliers = (int)m_multiplier_names.size();
-    int numDerivatives = (int)m_derivative_names.size();
-    int numSlacks = (int)m_slack_names.size();
-
     // This interpolate step removes any NaN values in the slack variables. It
     // does not resize the slacks trajectory.
     for (int icol = 0; icol < m_slacks.ncol(); ++icol) {
@@ -879,59 +880,39 @@ void MocoTrajectory::resample(SimTK::Vector time) {
                 interpolate(m_time, m_slacks.col(icol), m_time, true, true);
     }
 
-    const TimeSeriesTable table = convertToTable();
-    const GCVSplineSet splines(table, {}, std::min(m_time.size() - 1, 5));
-
-    m_time = std::move(time);
-    const int numTimes = m_time.size();
-    m_states.resize(numTimes, numStates);
-    m_controls.resize(numTimes, numControls);
-    m_input_controls.resize(numTimes, numInputControls);
-    m_multipliers.resize(numTimes, numMultipliers);
-    m_derivatives.resize(numTimes, numDerivatives);
-    m_slacks.resize(numTimes, numSlacks);
-    if (m_time[numTimes - 1] == m_time[0]) {
+    const int numTimes = time.size();
+    const std::vector<SimTK::Matrix*> groups{&m_states, &m_controls,
+            &m_input_controls, &m_multipliers, &m_derivatives, &m_slacks};
+    if (time[numTimes - 1] == time[0]) {
         // If, for example, all times are 0.0, then we cannot use the spline,
         // which requires strictly increasing time.
-        int icol;
-        for (icol = 0; icol < numStates; ++icol)
-            m_states.updCol(icol).setTo(
-                    table.getDependentColumnAtIndex(icol).getElt(0, 0));
-        for (int icontr = 0; icontr < numControls; ++icontr, ++icol)
-            m_controls.updCol(icontr).setTo(
-                    table.getDependentColumnAtIndex(icol).getElt(0, 0));
-        for (int icc = 0; icc < numInputControls; ++icc, ++icol)
-            m_input_controls.updCol(icc).setTo(
-                    table.getDependentColumnAtIndex(icol).getElt(0, 0));
-        for (int imult = 0; imult < numMultipliers; ++imult, ++icol)
-            m_multipliers.updCol(imult).setTo(
-                    table.getDependentColumnAtIndex(icol).getElt(0, 0));
-        for (int ideriv = 0; ideriv < numDerivatives; ++ideriv, ++icol)
-            m_derivatives.updCol(ideriv).setTo(
-                    table.getDependentColumnAtIndex(icol).getElt(0, 0));
-        for (int islack = 0; islack < numSlacks; ++islack, ++icol)
-            m_slacks.updCol(islack).setTo(
-                    table.getDependentColumnAtIndex(icol).getElt(0, 0));
-
+        for (SimTK::Matrix* group : groups) {
+            if (group->ncol() == 0) {
+                group->resize(numTimes, 0);
+                continue;
+            }
+            const SimTK::RowVector initialValues = group->row(0);
+            group->resize(numTimes, group->ncol());
+            for (int itime = 0; itime < numTimes; ++itime) {
+                group->updRow(itime) = initialValues;
+            }
+        }
     } else {
-        SimTK::Vector curTime(1);
-        for (int itime = 0; itime < m_time.size(); ++itime) {
-            curTime[0] = m_time[itime];
-            int icol;
-            for (icol = 0; icol < numStates; ++icol)
-                m_states(itime, icol) = splines[icol].calcValue(curTime);
-            for (int icontr = 0; icontr < numControls; ++icontr, ++icol)
-                m_controls(itime, icontr) = splines[icol].calcValue(curTime);
-            for (int icc = 0; icc < numInputControls; ++icc, ++icol)
-                m_input_controls(itime, icc) = splines[icol].calcValue(curTime);
-            for (int imult = 0; imult < numMultipliers; ++imult, ++icol)
-                m_multipliers(itime, imult) = splines[icol].calcValue(curTime);
-            for (int ideriv = 0; ideriv < numDerivatives; ++ideriv, ++icol)
-                m_derivatives(itime, ideriv) = splines[icol].calcValue(curTime);
-            for (int islack = 0; islack < numSlacks; ++islack, ++icol)
-                m_slacks(itime, islack) = splines[icol].calcValue(curTime);
+        // The interpolation weights (which depend only on the times) are
+        // computed once and applied to all columns of every group.
+        const TableResampler resampler(
+                std::vector<double>(&m_time[0], &m_time[0] + m_time.size()),
+                std::vector<double>(&time[0], &time[0] + numTimes),
+                TableResampler::Kernel::QuinticSpline);
+        for (SimTK::Matrix* group : groups) {
+            if (group->ncol() == 0) {
+                group->resize(numTimes, 0);
+                continue;
+            }
+            *group = resampler.resample(*group);
         }
     }
+    m_time = std::move(time);
 }
 
 MocoTrajectory::MocoTrajectory(const std::string& filepath) {
@@ -1080,6 +1061,314 @@ void MocoTrajectory::write(const std::string& filepath) const {
     STOFileAdapter::write(convertToTable(), filepath);
 }
 
+namespace {
+// The first bytes of each binary file.
+constexpr char binaryMagic[] = "MOCOTRAJ";
+constexpr std::size_t binaryMagicSize = sizeof(binaryMagic) - 1;
+constexpr int binaryFormatVersion = 1;
+// The groups of variables, in the order they are stored. Each column of each
+// group (and each parameter) is stored in its own block, after the times.
+const std::vector<std::string> binaryGroups = {"states", "controls",
+        "input_controls", "multipliers", "derivatives", "slacks",
+        "parameters"};
+
+// XOR the bits of each value with those of the previous value; the sign,
+// exponent, and leading mantissa bits of smooth or constant columns rarely
+// change, so the results have many zero bytes. The bytes are stored by
+// significance (the most significant byte of every value, then the next
+// byte, etc.) so that the zero bytes form long runs, and each run of zero
+// bytes is stored as a zero byte followed by the length of the run (7 bits
+// per byte, least significant first).
+std::string compressColumn(const std::vector<double>& values) {
+    const int size = (int)values.size();
+    std::vector<std::uint64_t> xors(size);
+    std::uint64_t previous = 0;
+    for (int i = 0; i < size; ++i) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &values[i], sizeof(bits));
+        xors[i] = bits ^ previous;
+        previous = bits;
+    }
+    std::string compressed;
+    std::uint64_t numZeros = 0;
+    const auto writeZeros = [&]() {
+        if (!numZeros) return;
+        compressed.push_back(0);
+        for (; numZeros >= 0x80; numZeros >>= 7) {
+            compressed.push_back(char((numZeros & 0x7f) | 0x80));
+        }
+        compressed.push_back(char(numZeros));
+        numZeros = 0;
+    };
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        for (int i = 0; i < size; ++i) {
+            const char byte = char((xors[i] >> shift) & 0xff);
+            if (byte == 0) {
+                ++numZeros;
+            } else {
+                writeZeros();
+                compressed.push_back(byte);
+            }
+        }
+    }
+    writeZeros();
+    return compressed;
+}
+
+std::vector<double> decompressColumn(const std::string& compressed, int size) {
+    std::vector<std::uint64_t> xors(size, 0);
+    const std::uint64_t numBytes = 8 * (std::uint64_t)size;
+    std::uint64_t ibyte = 0;
+    std::size_t pos = 0;
+    while (pos < compressed.size()) {
+        const auto byte = (unsigned char)compressed[pos++];
+        if (byte) {
+            OPENSIM_THROW_IF(ibyte >= numBytes, Exception,
+                    "Invalid compressed column in binary trajectory file.");
+            const int plane = int(ibyte / size);
+            xors[ibyte % size] |= std::uint64_t(byte) << (56 - 8 * plane);
+            ++ibyte;
+        } else {
+            std::uint64_t numZeros = 0;
+            for (int shift = 0;; shift += 7) {
+                OPENSIM_THROW_IF(pos >= compressed.size() || shift > 63,
+                        Exception,
+                        "Invalid compressed column in binary trajectory "
+                        "file.");
+                const auto lengthByte = (unsigned char)compressed[pos++];
+                numZeros |= std::uint64_t(lengthByte & 0x7f) << shift;
+                if (!(lengthByte & 0x80)) break;
+            }
+            ibyte += numZeros;
+        }
+    }
+    OPENSIM_THROW_IF(ibyte != numBytes, Exception,
+            "Invalid compressed column in binary trajectory file.");
+    std::vector<double> values(size);
+    std::uint64_t previous = 0;
+    for (int i = 0; i < size; ++i) {
+        const std::uint64_t bits = xors[i] ^ previous;
+        std::memcpy(&values[i], &bits, sizeof(bits));
+        previous = bits;
+    }
+    return values;
+}
+} // namespace
+
+void MocoTrajectory::writeBinary(
+        const std::string& filepath, bool compress) const {
+    ensureUnsealed();
+    const int numTimes = m_time.size();
+    const std::vector<const std::vector<std::string>*> groupNames = {
+            &m_state_names, &m_control_names, &m_input_control_names,
+            &m_multiplier_names, &m_derivative_names, &m_slack_names,
+            &m_parameter_names};
+    const std::vector<const SimTK::Matrix*> groupMatrices = {&m_states,
+            &m_controls, &m_input_controls, &m_multipliers, &m_derivatives,
+            &m_slacks};
+
+    std::vector<std::string> blocks;
+    std::vector<double> column(numTimes);
+    const auto addBlock = [&](const std::vector<double>& values) {
+        if (compress) {
+            blocks.push_back(compressColumn(values));
+        } else {
+            blocks.emplace_back(reinterpret_cast<const char*>(values.data()),
+                    values.size() * sizeof(double));
+        }
+    };
+    for (int itime = 0; itime < numTimes; ++itime) {
+        column[itime] = m_time[itime];
+    }
+    addBlock(column);
+    for (const auto* matrix : groupMatrices) {
+        for (int icol = 0; icol < matrix->ncol(); ++icol) {
+            for (int itime = 0; itime < numTimes; ++itime) {
+                column[itime] = (*matrix)(itime, icol);
+            }
+            addBlock(column);
+        }
+    }
+    for (int iparam = 0; iparam < (int)m_parameter_names.size(); ++iparam) {
+        addBlock({m_parameters[iparam]});
+    }
+
+    std::ostringstream metadata(std::ios::binary);
+    writeBinaryImpl(metadata);
+
+    std::ofstream stream(filepath, std::ios::binary);
+    OPENSIM_THROW_IF(!stream, Exception,
+            "Could not open file '{}' for writing.", filepath);
+    BinaryIO::writeBytes(stream, binaryMagic, binaryMagicSize);
+    BinaryIO::writeByteOrderMark(stream);
+    BinaryIO::write(stream, binaryFormatVersion);
+    BinaryIO::write(stream, compress);
+    BinaryIO::write(stream, numTimes);
+    for (int igroup = 0; igroup < (int)binaryGroups.size(); ++igroup) {
+        BinaryIO::write(stream, binaryGroups[igroup]);
+        BinaryIO::write(stream, (int)groupNames[igroup]->size());
+        for (const auto& name : *groupNames[igroup]) {
+            BinaryIO::write(stream, name);
+        }
+    }
+    BinaryIO::write(stream, metadata.str());
+    // The sizes of the blocks, from which their locations are computed.
+    for (const auto& block : blocks) {
+        BinaryIO::write(stream, (std::int64_t)block.size());
+    }
+    for (const auto& block : blocks) {
+        BinaryIO::writeBytes(stream, block.data(), block.size());
+    }
+    OPENSIM_THROW_IF(!stream, Exception, "Could not write file '{}'.",
+            filepath);
+}
+
+MocoTrajectory MocoTrajectory::readBinary(const std::string& filepath,
+        const std::vector<std::string>& groups,
+        const std::vector<std::string>& names) {
+    MocoTrajectory trajectory;
+    trajectory.readBinaryInternal(filepath, groups, names);
+    return trajectory;
+}
+
+void MocoTrajectory::readBinaryInternal(const std::string& filepath,
+        const std::vector<std::string>& groups,
+        const std::vector<std::string>& names) {
+    for (const auto& group : groups) {
+        OPENSIM_THROW_IF(std::find(binaryGroups.begin(), binaryGroups.end(),
+                                 group) == binaryGroups.end(),
+                Exception,
+                "Unrecognized group '{}'; expected states, controls, "
+                "input_controls, multipliers, derivatives, slacks, or "
+                "parameters.",
+                group);
+    }
+
+    std::ifstream stream(filepath, std::ios::binary);
+    OPENSIM_THROW_IF(!stream, Exception,
+            "Could not open file '{}' for reading.", filepath);
+    char magic[binaryMagicSize] = {};
+    stream.read(magic, binaryMagicSize);
+    OPENSIM_THROW_IF(
+            !stream || std::memcmp(magic, binaryMagic, binaryMagicSize),
+            Exception, "File '{}' is not a binary MocoTrajectory file.",
+            filepath);
+    BinaryIO::readByteOrderMark(stream);
+    const int formatVersion = BinaryIO::read<int>(stream);
+    OPENSIM_THROW_IF(formatVersion != binaryFormatVersion, Exception,
+            "File '{}' has format version {}, but this version of OpenSim "
+            "reads format version {}.",
+            filepath, formatVersion, binaryFormatVersion);
+    const bool compressed = BinaryIO::read<bool>(stream);
+    const int numTimes = BinaryIO::read<int>(stream);
+    OPENSIM_THROW_IF(numTimes < 0, Exception,
+            "Invalid number of times in file '{}'.", filepath);
+    std::vector<std::vector<std::string>> fileNames(binaryGroups.size());
+    int numBlocks = 1;
+    for (int igroup = 0; igroup < (int)binaryGroups.size(); ++igroup) {
+        OPENSIM_THROW_IF(
+                BinaryIO::read<std::string>(stream) != binaryGroups[igroup],
+                Exception, "Invalid binary MocoTrajectory file '{}'.",
+                filepath);
+        const int numNames = BinaryIO::read<int>(stream);
+        OPENSIM_THROW_IF(numNames < 0, Exception,
+                "Invalid binary MocoTrajectory file '{}'.", filepath);
+        fileNames[igroup].resize(numNames);
+        for (auto& name : fileNames[igroup]) BinaryIO::read(stream, name);
+        numBlocks += numNames;
+    }
+    const std::string metadata = BinaryIO::read<std::string>(stream);
+    std::vector<std::int64_t> blockOffsets(numBlocks);
+    std::vector<std::int64_t> blockSizes(numBlocks);
+    for (auto& blockSize : blockSizes) BinaryIO::read(stream, blockSize);
+    const std::streampos dataStart = stream.tellg();
+    // The blocks must fit in the rest of the file.
+    stream.seekg(0, std::ios::end);
+    const std::int64_t dataSize = std::int64_t(stream.tellg() - dataStart);
+    std::int64_t offset = 0;
+    for (int iblock = 0; iblock < numBlocks; ++iblock) {
+        OPENSIM_THROW_IF(blockSizes[iblock] < 0 ||
+                                 blockSizes[iblock] > dataSize - offset,
+                Exception, "Invalid binary MocoTrajectory file '{}'.",
+                filepath);
+        blockOffsets[iblock] = offset;
+        offset += blockSizes[iblock];
+    }
+
+    // Only the selected blocks are read.
+    const auto readBlock = [&](int iblock, int size) {
+        stream.seekg(dataStart + std::streamoff(blockOffsets[iblock]));
+        std::string block((std::size_t)blockSizes[iblock], '\0');
+        if (!block.empty()) {
+            BinaryIO::readBytes(stream, &block[0], block.size());
+        }
+        if (compressed) return decompressColumn(block, size);
+        OPENSIM_THROW_IF(block.size() != size * sizeof(double), Exception,
+                "Invalid binary MocoTrajectory file '{}'.", filepath);
+        std::vector<double> values(size);
+        if (size) std::memcpy(values.data(), block.data(), block.size());
+        return values;
+    };
+
+    const std::vector<double> time = readBlock(0, numTimes);
+    m_time = SimTK::Vector(numTimes, time.data());
+
+    const std::unordered_set<std::string> selectedNames(
+            names.begin(), names.end());
+    std::unordered_set<std::string> foundNames;
+    const std::vector<std::vector<std::string>*> groupNames = {
+            &m_state_names, &m_control_names, &m_input_control_names,
+            &m_multiplier_names, &m_derivative_names, &m_slack_names,
+            &m_parameter_names};
+    const std::vector<SimTK::Matrix*> groupMatrices = {&m_states, &m_controls,
+            &m_input_controls, &m_multipliers, &m_derivatives, &m_slacks};
+    int firstBlock = 1;
+    for (int igroup = 0; igroup < (int)binaryGroups.size(); ++igroup) {
+        const auto& allNames = fileNames[igroup];
+        std::vector<int> indices;
+        if (groups.empty() || std::find(groups.begin(), groups.end(),
+                                      binaryGroups[igroup]) != groups.end()) {
+            for (int i = 0; i < (int)allNames.size(); ++i) {
+                if (selectedNames.empty() || selectedNames.count(allNames[i])) {
+                    indices.push_back(i);
+                    foundNames.insert(allNames[i]);
+                }
+            }
+        }
+        auto& namesOut = *groupNames[igroup];
+        namesOut.clear();
+        for (const int i : indices) namesOut.push_back(allNames[i]);
+        if (igroup < (int)groupMatrices.size()) {
+            SimTK::Matrix& matrix = *groupMatrices[igroup];
+            matrix.resize(numTimes, (int)indices.size());
+            for (int icol = 0; icol < (int)indices.size(); ++icol) {
+                const std::vector<double> column =
+                        readBlock(firstBlock + indices[icol], numTimes);
+                for (int itime = 0; itime < numTimes; ++itime) {
+                    matrix(itime, icol) = column[itime];
+                }
+            }
+        } else {
+            m_parameters.resize((int)indices.size());
+            for (int iparam = 0; iparam < (int)indices.size(); ++iparam) {
+                m_parameters[iparam] =
+                        readBlock(firstBlock + indices[iparam], 1)[0];
+            }
+        }
+        firstBlock += (int)allNames.size();
+    }
+    for (const auto& name : names) {
+        OPENSIM_THROW_IF(!foundNames.count(name), Exception,
+                "Variable '{}' is not in the selected groups of file '{}'.",
+                name, filepath);
+    }
+
+    if (!metadata.empty()) {
+        std::istringstream metadataStream(metadata, std::ios::binary);
+        readBinaryImpl(metadataStream);
+    }
+}
+
 TimeSeriesTable MocoTrajectory::convertToTable() const {
     ensureUnsealed();
     std::vector<double> time(&m_time[0], &m_time[0] + m_time.size());
@@ -1584,36 +1873,88 @@ double MocoTrajectory::compareContinuousVariablesRMSInternal(
     auto integTime = createVectorLinspace(numTimes, initialTime, finalTime);
     const auto timeInterval = integTime[1] - integTime[0];
 
-    auto integralSumSquaredError =
-            [&selfTime, &otherTime, &numTimes, &integTime, &timeInterval](
-                    const VecStr& namesToUse, const SimTK::Matrix& selfData,
-                    const VecStr& selfNames, const SimTK::Matrix& otherData,
-                    const VecStr& otherNames) -> double {
+    // Interpolate each trajectory onto the integration times within its time
+    // range; the error is computed as though the trajectory is 0 outside its
+    // range. The interpolation weights (which depend only on the times) are
+    // computed once for each trajectory and applied to all columns of every
+    // group at once, instead of fitting a spline to each column.
+    const auto findTimeRange = [&integTime, &numTimes](
+                                       const std::vector<double>& time) {
+        const double* begin = &integTime[0];
+        const double* first = std::lower_bound(
+                begin, begin + numTimes, time.front());
+        const double* last = std::upper_bound(
+                first, begin + numTimes, time.back());
+        return std::make_pair(int(first - begin), int(last - begin));
+    };
+    const auto selfRange = findTimeRange(selfTime);
+    const auto otherRange = findTimeRange(otherTime);
+    const auto createResampler = [&integTime](std::vector<double> time,
+                                         std::pair<int, int> range) {
+        return OpenSim::make_unique<TableResampler>(std::move(time),
+                std::vector<double>(&integTime[0] + range.first,
+                        &integTime[0] + range.second),
+                TableResampler::Kernel::QuinticSpline);
+    };
+    const auto selfResampler = createResampler(selfTime, selfRange);
+    // If the trajectories have the same times, the error can be interpolated
+    // instead of interpolating both trajectories.
+    const bool sameTimes = selfTime == otherTime;
+    std::unique_ptr<TableResampler> otherResampler;
+    if (!sameTimes) {
+        otherResampler = createResampler(otherTime, otherRange);
+    }
+
+    auto integralSumSquaredError = [&](const VecStr& namesToUse,
+                                           const SimTK::Matrix& selfData,
+                                           const VecStr& selfNames,
+                                           const SimTK::Matrix& otherData,
+                                           const VecStr& otherNames) -> double {
         if (namesToUse.empty()) return 0;
 
-        TimeSeriesTable selfTable(selfTime, selfData, selfNames);
-        TimeSeriesTable otherTable(otherTime, otherData, otherNames);
-
-        GCVSplineSet self(selfTable, namesToUse,
-                std::min((int)selfTable.getNumRows() - 1, 5));
-        GCVSplineSet other(otherTable, namesToUse,
-                std::min((int)otherTable.getNumRows() - 1, 5));
+        const int numNames = (int)namesToUse.size();
+        SimTK::Matrix selfColumns(selfData.nrow(), numNames);
+        SimTK::Matrix otherColumns(otherData.nrow(), numNames);
+        const auto findColumn = [](const VecStr& names,
+                                        const std::string& name) {
+            return int(std::find(names.begin(), names.end(), name) -
+                       names.begin());
+        };
+        for (int iname = 0; iname < numNames; ++iname) {
+            const auto& name = namesToUse[iname];
+            selfColumns.updCol(iname) =
+                    selfData.col(findColumn(selfNames, name));
+            otherColumns.updCol(iname) =
+                    otherData.col(findColumn(otherNames, name));
+        }
 
         SimTK::Vector sumSquaredError(numTimes, 0.0);
-        for (int itime = 0; itime < numTimes; ++itime) {
-            const auto& curTime = integTime[itime];
-            SimTK::Vector curTimeVec(1, curTime);
-            bool selfInRange =
-                    self.getMinX() <= curTime && curTime <= self.getMaxX();
-            bool otherInRange =
-                    other.getMinX() <= curTime && curTime <= other.getMaxX();
-            for (int iname = 0; iname < (int)namesToUse.size(); ++iname) {
-                double selfValue =
-                        selfInRange ? self.get(iname).calcValue(curTimeVec) : 0;
-                double otherValue =
-                        otherInRange ? other.get(iname).calcValue(curTimeVec)
-                                     : 0;
-                sumSquaredError[itime] += SimTK::square(selfValue - otherValue);
+        const auto addSquares = [&sumSquaredError](const SimTK::Matrix& error,
+                                        int firstTime) {
+            for (int irow = 0; irow < error.nrow(); ++irow) {
+                sumSquaredError[firstTime + irow] += error.row(irow).normSqr();
+            }
+        };
+        if (sameTimes) {
+            addSquares(selfResampler->resample(selfColumns - otherColumns),
+                    selfRange.first);
+        } else {
+            const SimTK::Matrix selfValues =
+                    selfResampler->resample(selfColumns);
+            const SimTK::Matrix otherValues =
+                    otherResampler->resample(otherColumns);
+            // Times where only one of the trajectories is defined.
+            addSquares(selfValues, selfRange.first);
+            addSquares(otherValues, otherRange.first);
+            // Where both trajectories are defined, replace the squares with
+            // the squared error.
+            for (int itime = std::max(selfRange.first, otherRange.first);
+                    itime < std::min(selfRange.second, otherRange.second);
+                    ++itime) {
+                const auto selfRow = selfValues.row(itime - selfRange.first);
+                const auto otherRow =
+                        otherValues.row(itime - otherRange.first);
+                sumSquaredError[itime] = (selfRow - otherRow).normSqr();
             }
         }
         // Trapezoidal rule for uniform grid:
@@ -1717,6 +2058,12 @@ double MocoTrajectory::compareParametersRMS(const MocoTrajectory& other,
                 other.m_parameter_names);
     }
 
+    if (parameterNames == m_parameter_names &&
+            m_parameter_names == other.m_parameter_names) {
+        return sqrt((m_parameters - other.m_parameters).normSqr() /
+                    parameterNames.size());
+    }
+
     double sumSquaredError = 0;
     for (auto& name : parameterNames) {
         const SimTK::Real& selfValue = this->getParameter(name);
@@ -1772,6 +2119,55 @@ void MocoSolution::printObjectiveBreakdown() const {
     }
 }
 
+void MocoSolution::writeSolverProfile(const std::string& filepath) const {
+    ensureUnsealed();
+    OPENSIM_THROW_IF(m_solverProfile.empty(), Exception,
+            "This solution does not contain a solver profile.");
+    std::ofstream f(filepath);
+    OPENSIM_THROW_IF(!f.good(), Exception,
+            "Could not open file '{}' for writing.", filepath);
+    f << m_solverProfile;
+}
+
+MocoSolution MocoSolution::readBinary(const std::string& filepath,
+        const std::vector<std::string>& groups,
+        const std::vector<std::string>& names) {
+    MocoSolution solution;
+    solution.readBinaryInternal(filepath, groups, names);
+    return solution;
+}
+
+void MocoSolution::writeBinaryImpl(std::ostream& stream) const {
+    BinaryIO::write(stream, m_success);
+    BinaryIO::write(stream, m_status);
+    BinaryIO::write(stream, m_objective);
+    BinaryIO::write(stream, m_numIterations);
+    BinaryIO::write(stream, m_solverDuration);
+    BinaryIO::write(stream, (int)m_objectiveBreakdown.size());
+    for (const auto& entry : m_objectiveBreakdown) {
+        BinaryIO::write(stream, entry.first);
+        BinaryIO::write(stream, entry.second);
+    }
+    BinaryIO::write(stream, m_solverProfile);
+}
+
+void MocoSolution::readBinaryImpl(std::istream& stream) {
+    const bool success = BinaryIO::read<bool>(stream);
+    BinaryIO::read(stream, m_status);
+    BinaryIO::read(stream, m_objective);
+    BinaryIO::read(stream, m_numIterations);
+    BinaryIO::read(stream, m_solverDuration);
+    const int numTerms = BinaryIO::read<int>(stream);
+    m_objectiveBreakdown.clear();
+    for (int i = 0; i < numTerms; ++i) {
+        std::string name = BinaryIO::read<std::string>(stream);
+        const double value = BinaryIO::read<double>(stream);
+        m_objectiveBreakdown.emplace_back(std::move(name), value);
+    }
+    BinaryIO::read(stream, m_solverProfile);
+    setSuccess(success);
+}
+
 void MocoSolution::convertToTableImpl(TimeSeriesTable& table) const {
     std::string success = m_success ? "true" : "false";
     table.updTableMetaData().setValueForKey("success", success);
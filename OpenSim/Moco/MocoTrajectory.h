@@ -23,6 +23,8 @@
 #include <OpenSim/Common/Storage.h>
 #include <OpenSim/Simulation/StatesTrajectory.h>
 
+#include <iosfwd>
+
 namespace OpenSim {
 
 class MocoProblem;
@@ -270,8 +272,12 @@ public:
     /// Resample (interpolate) the data in this trajectory at the provided
     /// times. If all times have the same value (e.g., 0.0), then the value of
     /// each variable for all time is its previous value at the initial time.
+    /// The interpolation weights of the spline described above depend only on
+    /// the existing and new times, so they are computed once and applied to
+    /// all variables (see TableResampler's QuinticSpline kernel).
     /// @throws Exception if new times are not within existing initial and final
-    /// times, if the new times are decreasing, or if getNumTimes() < 2.
+    /// times, if the new times are decreasing, if the existing times are not
+    /// increasing, or if getNumTimes() < 2.
     void resample(SimTK::Vector newTime);
     /// @}
 
@@ -807,6 +813,9 @@ public:
     /// key are compared.
     /// Both trajectories must have at least 6 time nodes.
     /// If the number of columns to compare is 0, this returns 0.
+    /// The trajectories are interpolated onto the integration times with
+    /// TableResampler's QuinticSpline kernel, whose weights are computed once
+    /// for each trajectory and applied to all compared columns.
     double compareContinuousVariablesRMS(const MocoTrajectory& other,
             std::map<std::string, std::vector<std::string>> columnsToUse = {})
             const;
@@ -834,6 +843,30 @@ public:
     /// Save the trajectory to a STO file. Use the ."sto" file extension.
     void write(const std::string& filepath) const;
 
+    /// Save the trajectory to a binary file, which is smaller and faster to
+    /// read than a STO file. Selected variables can be read from it without
+    /// reading the others (see readBinary()). Use the ".mocotraj" file
+    /// extension. If `compress` is true, each column is compressed
+    /// losslessly: the bits of each value are XORed with those of the
+    /// previous value, and the resulting runs of zero bytes are run-length
+    /// encoded. This works well for smooth or constant columns. The file can
+    /// only be read on a machine with the same byte order. For a
+    /// MocoSolution, the file also contains the solver statistics (success,
+    /// status, objective, etc.).
+    void writeBinary(const std::string& filepath, bool compress = true) const;
+
+    /// Read a trajectory from a file written by writeBinary(). Only the
+    /// given groups of variables are read ("states", "controls",
+    /// "input_controls", "multipliers", "derivatives", "slacks", and
+    /// "parameters"); by default, all groups are read. If `names` is not
+    /// empty, only the variables with these names are read from the selected
+    /// groups. The times are always read.
+    /// @throws Exception if a group is not recognized or if a name is not in
+    /// the selected groups.
+    static MocoTrajectory readBinary(const std::string& filepath,
+            const std::vector<std::string>& groups = {},
+            const std::vector<std::string>& names = {});
+
     /// This table can be saved as a Storage file that can be used in the
     /// OpenSim GUI to visualize a motion, or as input to OpenSim's conventional
     /// tools (e.g., AnalyzeTool).
@@ -946,10 +979,17 @@ protected:
     bool isSealed() const { return m_sealed; }
     /// @throws MocoTrajectoryIsSealed if the trajectory is sealed.
     void ensureUnsealed() const;
+    /// Read the file into this (empty) trajectory; see readBinary().
+    void readBinaryInternal(const std::string& filepath,
+            const std::vector<std::string>& groups,
+            const std::vector<std::string>& names);
 
 private:
     TimeSeriesTable convertToTable() const;
     virtual void convertToTableImpl(TimeSeriesTable&) const {}
+    // Write and read the metadata of derived classes in binary files.
+    virtual void writeBinaryImpl(std::ostream&) const {}
+    virtual void readBinaryImpl(std::istream&) {}
     double compareContinuousVariablesRMSInternal(const MocoTrajectory& other,
             std::vector<std::string> stateNames = {},
             std::vector<std::string> controlNames = {},
@@ -1148,6 +1188,31 @@ public:
     void printObjectiveBreakdown() const;
     /// @}
 
+    /// @name Solver profile
+    /// Some solvers can record where time was spent during the solve (e.g.,
+    /// MocoCasADiSolver with the `profile_callbacks` property enabled).
+    /// @{
+
+    /// Get the profile as comma-separated values with the header
+    /// `callback,thread,num_calls,wall_time,cpu_time` (times in seconds).
+    /// Returns an empty string if the solver did not record a profile.
+    const std::string& getSolverProfile() const {
+        ensureUnsealed();
+        return m_solverProfile;
+    }
+    /// Write the solver profile to a CSV file. This throws an exception if
+    /// the solver did not record a profile.
+    void writeSolverProfile(const std::string& filepath) const;
+    /// @}
+
+    /// Read a solution, including the solver statistics, from a file written
+    /// by writeBinary(). See MocoTrajectory::readBinary(). If the file was
+    /// written from a MocoTrajectory, the solution has the default
+    /// statistics.
+    static MocoSolution readBinary(const std::string& filepath,
+            const std::vector<std::string>& groups = {},
+            const std::vector<std::string>& names = {});
+
     /// @name Access control
     /// @{
 
@@ -1189,15 +1254,23 @@ private:
         m_numIterations = numIterations;
     };
     void setSolverDuration(double duration) { m_solverDuration = duration; }
+    void setSolverProfile(std::string profile) {
+        m_solverProfile = std::move(profile);
+    }
     void convertToTableImpl(TimeSeriesTable&) const override;
+    void writeBinaryImpl(std::ostream&) const override;
+    void readBinaryImpl(std::istream&) override;
     bool m_success = true;
     double m_objective = -1;
     std::vector<std::pair<std::string, double>> m_objectiveBreakdown;
     std::string m_status;
     int m_numIterations = -1;
     double m_solverDuration = -1;
+    std::string m_solverProfile;
     // Allow solvers to set success, status, and construct a solution.
     friend class MocoSolver;
+    // Allow loading cached solutions.
+    friend class MocoSolutionCache;
 };
 
 } // namespace OpenSim
@@ -166,6 +166,9 @@ protected:
 private:
     void constructProperties();
 
+    // Allow hashing the guess.
+    friend class MocoSolutionCache;
+
     // When a copy of the solver is made, we want to keep any guess specified
     // by the API, but want to discard anything we've cached by loading a file.
     MocoTrajectory m_guessFromAPI;
@@ -1426,6 +1426,54 @@ TEST_CASE("MocoGoal divide by displacement/duration/mass") {
         Catch::Matchers::WithinAbs(mass, SimTK::Eps));
 }
 
+TEST_CASE("Tracking goals with reference values on the grid") {
+    Model model = ModelFactory::createSlidingPointMass();
+    model.addMarker(new Marker("marker", model.getComponent<Body>("/body"),
+            SimTK::Vec3(0, 0.1, 0)));
+    model.finalizeConnections();
+    SimTK::State state = model.initSystem();
+
+    std::vector<double> time;
+    SimTK::Matrix positions(21, 1);
+    SimTK::Matrix_<SimTK::Vec3> locations(21, 1);
+    for (int i = 0; i < 21; ++i) {
+        time.push_back(0.05 * i);
+        positions(i, 0) = std::sin(time.back());
+        locations(i, 0) = SimTK::Vec3(std::sin(time.back()), 0.1, 0);
+    }
+    MocoStateTrackingGoal stateTracking;
+    stateTracking.setReference(TimeSeriesTable(
+            time, positions, {"/slider/position/value"}));
+    stateTracking.initializeOnModel(model);
+    MocoMarkerTrackingGoal markerTracking;
+    markerTracking.setMarkersReference(MarkersReference(
+            TimeSeriesTableVec3(time, locations, {"marker"}),
+            Set<MarkerWeight>()));
+    markerTracking.initializeOnModel(model);
+
+    // The grid includes times between the reference times.
+    const std::vector<double> grid{0, 0.1234, 0.5, 0.7777, 1.0};
+    const auto calcIntegrands = [&](const std::vector<double>& times) {
+        std::vector<double> integrands;
+        for (const double t : times) {
+            state.setTime(t);
+            state.updQ()[0] = 0.3;
+            integrands.push_back(stateTracking.calcIntegrand({t, state, {}}));
+            integrands.push_back(markerTracking.calcIntegrand({t, state, {}}));
+        }
+        return integrands;
+    };
+    // The second time is not on the grid.
+    const std::vector<double> times{0.1234, 0.3, 1.0};
+    const auto expected = calcIntegrands(times);
+    stateTracking.initializeOnGrid(grid);
+    markerTracking.initializeOnGrid(grid);
+    const auto actual = calcIntegrands(times);
+    for (int i = 0; i < (int)expected.size(); ++i) {
+        CHECK(actual[i] == Approx(expected[i]).epsilon(1e-12));
+    }
+}
+
 TEST_CASE("MocoFrameDistanceConstraint de/serialization") {
 
     {
@@ -19,13 +19,17 @@
 #include <OpenSim/Actuators/BodyActuator.h>
 #include <OpenSim/Actuators/CoordinateActuator.h>
 #include <OpenSim/Actuators/ModelFactory.h>
+#include <OpenSim/Common/GCVSplineSet.h>
+#include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/STOFileAdapter.h>
 #include <OpenSim/Moco/osimMoco.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Simulation/PositionMotion.h>
 #include <OpenSim/Simulation/SimbodyEngine/PinJoint.h>
 #include <OpenSim/Simulation/SimbodyEngine/SliderJoint.h>
 #include <OpenSim/Simulation/SimbodyEngine/ScapulothoracicJoint.h>
 
+#include <cstring>
 #include <fstream>
 
 #include <catch2/catch_all.hpp>
@@ -422,6 +426,34 @@ TEST_CASE("Building a problem", "") {
     }
 }
 
+TEST_CASE("Creating MocoProblemReps concurrently") {
+    MocoStudy study;
+    MocoProblem& problem = study.updProblem();
+    problem.setModel(createSlidingMassModel());
+    problem.setTimeBounds(0, {0, 5});
+    problem.setStateInfo("/slider/position/value", {0, 1}, 0, 1);
+    problem.addGoal<MocoFinalTimeGoal>();
+
+    MocoProblemRep expected = problem.createRep();
+    CHECK(expected.getInitializationTimes().front().first == "process model");
+    const auto reps = problem.createRepsHeap(5, 3);
+    REQUIRE(reps.size() == 5);
+    for (const auto& rep : reps) {
+        CHECK(rep->createStateInfoNames() == expected.createStateInfoNames());
+        CHECK(rep->createControlInfoNames() ==
+                expected.createControlInfoNames());
+        CHECK(rep->getNumCosts() == expected.getNumCosts());
+        CHECK(rep->getInitializationTimes().front().first == "copy model");
+        CHECK(rep->getInitializationTimes().size() ==
+                expected.getInitializationTimes().size());
+    }
+
+    // Names of goals must be unique; the exception from the threads is
+    // rethrown.
+    problem.addGoal<MocoFinalTimeGoal>();
+    CHECK_THROWS_AS(problem.createRepsHeap(4, 2), Exception);
+}
+
 TEMPLATE_TEST_CASE("Workflow", "", MocoCasADiSolver, MocoTropterSolver) {
 
     // Default bounds.
@@ -1650,6 +1682,209 @@ TEST_CASE("MocoTrajectory randomize") {
     }
 }
 
+TEST_CASE("MocoTrajectory binary files") {
+    SimTK::Vector time(3);
+    time[0] = 0;
+    time[1] = 0.1;
+    time[2] = 0.25;
+    MocoTrajectory orig(time, {"a", "b"}, {"g", "h", "i", "j"}, {"m"},
+            {"o", "p"}, SimTK::Test::randMatrix(3, 2),
+            SimTK::Test::randMatrix(3, 4), SimTK::Test::randMatrix(3, 1),
+            SimTK::Test::randVector(2).transpose());
+    // A constant column.
+    orig.setControl("h", SimTK::Vector(3, 0.5));
+
+    for (const bool compress : {true, false}) {
+        CAPTURE(compress);
+        const std::string fname = "testMocoInterface_binary.mocotraj";
+        orig.writeBinary(fname, compress);
+
+        // The values are exactly the same.
+        const MocoTrajectory deserialized = MocoTrajectory::readBinary(fname);
+        CHECK(deserialized.isNumericallyEqual(orig));
+        CHECK((deserialized.getStatesTrajectory() -
+                      orig.getStatesTrajectory()).normInf() == 0);
+        CHECK((deserialized.getControlsTrajectory() -
+                      orig.getControlsTrajectory()).normInf() == 0);
+
+        // Selected groups.
+        const auto controls = MocoTrajectory::readBinary(fname, {"controls"});
+        CHECK(controls.getStateNames().empty());
+        CHECK(controls.getParameterNames().empty());
+        CHECK(controls.getControlNames() == orig.getControlNames());
+        CHECK((controls.getControlsTrajectory() -
+                      orig.getControlsTrajectory()).normInf() == 0);
+        CHECK((controls.getTime() - orig.getTime()).normInf() == 0);
+
+        // Selected names.
+        const auto selected = MocoTrajectory::readBinary(fname, {}, {"i", "p"});
+        CHECK(selected.getControlNames() == std::vector<std::string>{"i"});
+        CHECK(selected.getParameterNames() == std::vector<std::string>{"p"});
+        CHECK(selected.getNumStates() == 0);
+        CHECK(selected.getNumMultipliers() == 0);
+        CHECK((selected.getControl("i") - orig.getControl("i")).normInf() ==
+                0);
+        CHECK(selected.getParameter("p") == orig.getParameter("p"));
+
+        CHECK_THROWS_WITH(
+                MocoTrajectory::readBinary(fname, {"states"}, {"i"}),
+                ContainsSubstring("Variable 'i' is not in the selected"));
+        CHECK_THROWS_WITH(MocoTrajectory::readBinary(fname, {"nonexistent"}),
+                ContainsSubstring("Unrecognized group 'nonexistent'"));
+    }
+    const std::string stoFile = "testMocoInterface_binary.sto";
+    orig.write(stoFile);
+    CHECK_THROWS_WITH(MocoTrajectory::readBinary(stoFile),
+            ContainsSubstring("is not a binary MocoTrajectory file"));
+
+    // Corrupted block sizes, which precede the (uncompressed) blocks.
+    const std::string fname = "testMocoInterface_binary.mocotraj";
+    orig.writeBinary(fname, false);
+    std::string contents;
+    {
+        std::ifstream file(fname, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        contents = buffer.str();
+    }
+    const int numTimes = orig.getNumTimes();
+    const int numColumns = 1 + orig.getNumStates() + orig.getNumControls() +
+                           orig.getNumMultipliers();
+    const int numParameters = orig.getNumParameters();
+    const std::size_t dataSize = sizeof(double) *
+                                 (numColumns * numTimes + numParameters);
+    const std::size_t firstBlockSize = contents.size() - dataSize -
+            sizeof(std::int64_t) * (numColumns + numParameters);
+    for (const std::int64_t blockSize :
+            {std::int64_t(-1), std::int64_t(1) << 40}) {
+        CAPTURE(blockSize);
+        std::string corrupted = contents;
+        std::memcpy(&corrupted[firstBlockSize], &blockSize, sizeof(blockSize));
+        const std::string corruptedFile =
+                "testMocoInterface_binary_corrupted.mocotraj";
+        {
+            std::ofstream file(corruptedFile, std::ios::binary);
+            file << corrupted;
+        }
+        CHECK_THROWS_WITH(MocoTrajectory::readBinary(corruptedFile),
+                ContainsSubstring("Invalid binary MocoTrajectory file"));
+    }
+}
+
+TEST_CASE("MocoSolution binary files") {
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+    MocoSolution solution = study.solve();
+    const std::string fname = "testMocoInterface_solution.mocotraj";
+    solution.writeBinary(fname);
+    const MocoSolution deserialized = MocoSolution::readBinary(fname);
+    CHECK(deserialized.success());
+    CHECK(deserialized.isNumericallyEqual(solution));
+    CHECK(deserialized.getObjective() == solution.getObjective());
+    CHECK(deserialized.getStatus() == solution.getStatus());
+    CHECK(deserialized.getNumIterations() == solution.getNumIterations());
+    CHECK(deserialized.getObjectiveTermNames() ==
+            solution.getObjectiveTermNames());
+
+    // An unsuccessful solution is sealed when read.
+    auto& solver = study.updSolver<MocoCasADiSolver>();
+    solver.set_optim_max_iterations(1);
+    MocoSolution failed = study.solve();
+    failed.unseal();
+    failed.writeBinary(fname);
+    MocoSolution failedDeserialized = MocoSolution::readBinary(fname);
+    CHECK_FALSE(failedDeserialized.success());
+    CHECK(failedDeserialized.isSealed());
+}
+
+TEST_CASE("MocoTrajectory resample and compare with nonuniform times") {
+    // Nonuniform times, as with a refined mesh.
+    const int numTimes = 40;
+    SimTK::Vector time(numTimes);
+    for (int itime = 0; itime < numTimes; ++itime) {
+        time[itime] = std::pow(itime / double(numTimes - 1), 1.5);
+    }
+    const std::vector<std::string> stateNames{"s0", "s1", "s2"};
+    SimTK::Matrix states(numTimes, 3);
+    SimTK::Matrix controls(numTimes, 1);
+    for (int itime = 0; itime < numTimes; ++itime) {
+        for (int i = 0; i < 3; ++i) {
+            states(itime, i) = std::sin((i + 1) * 3.0 * time[itime]);
+        }
+        controls(itime, 0) = std::cos(5.0 * time[itime]);
+    }
+    const MocoTrajectory trajectory(time, stateNames, {"c0"}, {}, {}, states,
+            controls, SimTK::Matrix(numTimes, 0), SimTK::RowVector());
+
+    SECTION("resample() matches GCVSplineSet") {
+        const TimeSeriesTable table(
+                std::vector<double>(&time[0], &time[0] + numTimes), states,
+                stateNames);
+        const GCVSplineSet splines(table, {}, 5);
+        const SimTK::Vector newTime = createVectorLinspace(57, 0.1, 0.9);
+        MocoTrajectory resampled = trajectory;
+        resampled.resample(newTime);
+        for (int itime = 0; itime < newTime.size(); ++itime) {
+            const SimTK::Vector curTime(1, newTime[itime]);
+            for (const auto& name : stateNames) {
+                CHECK(resampled.getState(name)[itime] ==
+                        Approx(splines.get(name).calcValue(curTime))
+                                .margin(1e-10));
+            }
+        }
+    }
+
+    SECTION("compareContinuousVariablesRMS() with different times") {
+        MocoTrajectory resampled = trajectory;
+        resampled.resampleWithNumTimes(71);
+        const double rms = trajectory.compareContinuousVariablesRMS(resampled);
+        CHECK(rms < 1e-4);
+        CHECK(rms ==
+                Approx(resampled.compareContinuousVariablesRMS(trajectory)));
+    }
+}
+
+TEST_CASE("MocoTrajectory resample with many times") {
+    // The spline system for many unevenly spaced times is factored once and
+    // shared by all columns, whether there are fewer or more columns than
+    // times. Both must match GCVSplineSet.
+    const int numTimes = 150;
+    SimTK::Vector time(numTimes);
+    for (int itime = 0; itime < numTimes; ++itime) {
+        time[itime] = std::pow(itime / double(numTimes - 1), 1.5);
+    }
+    for (const int numStates : {3, numTimes}) {
+        CAPTURE(numStates);
+        std::vector<std::string> stateNames;
+        SimTK::Matrix states(numTimes, numStates);
+        for (int i = 0; i < numStates; ++i) {
+            stateNames.push_back("s" + std::to_string(i));
+            for (int itime = 0; itime < numTimes; ++itime) {
+                states(itime, i) =
+                        std::sin((i % 5 + 1) * 3.0 * time[itime] + 0.1 * i);
+            }
+        }
+        const MocoTrajectory trajectory(time, stateNames, {}, {}, {}, states,
+                SimTK::Matrix(numTimes, 0), SimTK::Matrix(numTimes, 0),
+                SimTK::RowVector());
+        const TimeSeriesTable table(
+                std::vector<double>(&time[0], &time[0] + numTimes), states,
+                stateNames);
+        const GCVSplineSet splines(table, {"s0", "s1", "s2"}, 5);
+        const SimTK::Vector newTime = createVectorLinspace(301, 0, 1);
+        MocoTrajectory resampled = trajectory;
+        resampled.resample(newTime);
+        for (int itime = 0; itime < newTime.size(); ++itime) {
+            const SimTK::Vector curTime(1, newTime[itime]);
+            for (int i = 0; i < 3; ++i) {
+                CHECK(resampled.getStatesTrajectory()(itime, i) ==
+                        Approx(splines.get(i).calcValue(curTime))
+                                .margin(1e-10));
+            }
+        }
+        CHECK(trajectory.compareContinuousVariablesRMS(resampled) < 1e-3);
+    }
+}
+
 TEST_CASE("createPeriodicTrajectory") {
     const std::string hip_r = "hip_r/hip_flexion_r/value";
     const std::string hip_l = "hip_l/hip_flexion_l/value";
@@ -2122,6 +2357,415 @@ TEST_CASE("Objective breakdown", "[casadi]") {
     CHECK(solution.getObjectiveTerm("goal_b") == Approx(0.01 * 7.3));
 }
 
+TEST_CASE("Callback profiling", "[casadi]") {
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+    auto& problem = study.updProblem();
+    problem.addGoal<MocoControlGoal>("effort", 0.1);
+    auto& solver = study.updSolver<MocoCasADiSolver>();
+    solver.set_parallel(2);
+
+    SECTION("Disabled by default") {
+        MocoSolution solution = study.solve();
+        CHECK(solution.getSolverProfile().empty());
+        CHECK_THROWS_AS(solution.writeSolverProfile("profile.csv"), Exception);
+    }
+
+    SECTION("Enabled") {
+        solver.set_profile_callbacks(true);
+        study.set_write_solution(true);
+        MocoSolution solution = study.solve();
+        const std::string& profile = solution.getSolverProfile();
+        CHECK_THAT(profile, ContainsSubstring(
+                "callback,thread,num_calls,wall_time,cpu_time"));
+        CHECK_THAT(profile, ContainsSubstring("explicit_multibody_system,all"));
+        CHECK_THAT(profile, ContainsSubstring("cost_effort_integrand,all"));
+        CHECK_THAT(profile, ContainsSubstring("casadi_total,all"));
+        CHECK_THAT(profile, ContainsSubstring("solve,all,1"));
+
+        // The profile is written next to the solution.
+        std::ifstream file("./sliding_mass_solution_profile.csv");
+        REQUIRE(file.good());
+        std::stringstream contents;
+        contents << file.rdbuf();
+        CHECK(contents.str() == profile);
+    }
+
+    SECTION("Accumulated over mesh refinement iterations") {
+        solver.set_profile_callbacks(true);
+        // Refine exactly once.
+        solver.set_mesh_refinement_max_iterations(1);
+        solver.set_mesh_refinement_tolerance(1e-10);
+        MocoSolution solution = study.solve();
+        CHECK_THAT(solution.getSolverProfile(),
+                ContainsSubstring("solve,all,2,"));
+    }
+}
+
+TEST_CASE("Mesh refinement error estimate") {
+    // x = t^2 has a constant second derivative of 2; normalized by
+    // 1 + max|x| = 2, the curvature is 1 everywhere.
+    const int N = 11;
+    SimTK::Vector time(N);
+    SimTK::Matrix states(N, 1);
+    for (int i = 0; i < N; ++i) {
+        time[i] = i / (double)(N - 1);
+        states(i, 0) = SimTK::square(time[i]);
+    }
+    MocoTrajectory traj(time, {"x"}, {}, {}, {}, states, SimTK::Matrix(N, 0),
+            SimTK::Matrix(N, 0), SimTK::RowVector(0));
+
+    const auto errors =
+            MocoCasADiSolver::estimateMeshIntervalErrors(traj, {0, 0.5, 1});
+    REQUIRE(errors.size() == 2);
+    CHECK(errors[0] == Approx(0.25 / 8.0));
+    CHECK(errors[1] == Approx(0.25 / 8.0));
+
+    // Intervals above the tolerance are subdivided, at most into 4.
+    CHECK(MocoCasADiSolver::refineMesh({0, 0.5, 1}, {0.1, 1e-5}, 1e-3, 10) ==
+            std::vector<double>{0, 0.125, 0.25, 0.375, 0.5, 1});
+    CHECK(MocoCasADiSolver::refineMesh({0, 0.5, 1}, {2e-3, 1e-5}, 1e-3, 10) ==
+            std::vector<double>{0, 0.25, 0.5, 1});
+    // The mesh is unchanged if it would become too large.
+    CHECK(MocoCasADiSolver::refineMesh({0, 0.5, 1}, {0.1, 1e-5}, 1e-3, 4) ==
+            std::vector<double>{0, 0.5, 1});
+    CHECK_THROWS_AS(MocoCasADiSolver::refineMesh({0, 1}, {}, 1e-3, 4),
+            Exception);
+}
+
+TEST_CASE("Mesh refinement", "[casadi]") {
+    // The minimum-time sliding mass has bang-bang control, so the speed has a
+    // kink at the switching time that requires a finer mesh locally.
+    const int numMeshIntervals = 10;
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>(
+            "hermite-simpson", numMeshIntervals);
+    auto& solver = study.updSolver<MocoCasADiSolver>();
+    MocoSolution coarse = study.solve();
+    REQUIRE(coarse.success());
+
+    solver.set_mesh_refinement_max_iterations(2);
+    solver.set_mesh_refinement_tolerance(5e-3);
+    MocoSolution refined = study.solve();
+    REQUIRE(refined.success());
+    CHECK(refined.getNumTimes() > coarse.getNumTimes());
+    CHECK(refined.getFinalTime() == Approx(2.0).epsilon(1e-2));
+    CHECK(refined.getNumIterations() > coarse.getNumIterations());
+
+    // The refinement is local: the refined mesh is much smaller than a
+    // uniform mesh with the same finest resolution.
+    const auto& time = refined.getTime();
+    double minStep = SimTK::Infinity;
+    for (int i = 1; i < time.size(); ++i) {
+        minStep = std::min(minStep, time[i] - time[i - 1]);
+    }
+    CHECK(refined.getNumTimes() <
+            0.75 * refined.getFinalTime() / minStep);
+
+    // The refined solution is closer than the coarse solution to a solution
+    // on a uniform mesh with the same finest resolution.
+    const int numFineMeshIntervals =
+            (int)std::round(refined.getFinalTime() / (2 * minStep));
+    solver.set_mesh_refinement_max_iterations(0);
+    solver.set_num_mesh_intervals(numFineMeshIntervals);
+    MocoSolution fine = study.solve();
+    REQUIRE(fine.success());
+    CHECK(refined.getNumTimes() < fine.getNumTimes());
+    CHECK(refined.getObjective() == Approx(fine.getObjective()).epsilon(1e-3));
+    CHECK(refined.compareContinuousVariablesRMS(fine) <
+            coarse.compareContinuousVariablesRMS(fine));
+}
+
+TEST_CASE("MocoSolutionCache", "[casadi]") {
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+    study.updProblem().addGoal<MocoControlGoal>("effort", 0.1);
+    MocoSolutionCache cache("testMocoInterface_solution_cache");
+    cache.clear();
+
+    SECTION("Hits, near hits, and misses") {
+        MocoSolution first = cache.solve(study);
+        REQUIRE(first.success());
+        CHECK(cache.getNumMisses() == 1);
+        CHECK(cache.contains(study));
+
+        MocoSolution cached = cache.solve(study);
+        CHECK(cache.getNumHits() == 1);
+        REQUIRE(cached.success());
+        CHECK(cached.getObjective() == first.getObjective());
+        CHECK(cached.getNumIterations() == first.getNumIterations());
+        CHECK(cached.getObjectiveTerm("effort") ==
+                first.getObjectiveTerm("effort"));
+        CHECK(cached.isNumericallyEqual(first, 1e-6));
+
+        // A different weight is a near match: the solution is used as the
+        // initial guess.
+        study.updProblem().updGoal("effort").setWeight(0.2);
+        CHECK_FALSE(cache.contains(study));
+        MocoSolution near = cache.solve(study);
+        REQUIRE(near.success());
+        CHECK(cache.getNumNearHits() == 1);
+
+        // Changing the solver settings changes the key but not the
+        // structure.
+        study.updSolver<MocoCasADiSolver>().set_num_mesh_intervals(25);
+        cache.solve(study);
+        CHECK(cache.getNumNearHits() == 2);
+
+        // A different transcription scheme is a different structure.
+        study.updSolver<MocoCasADiSolver>().set_transcription_scheme(
+                "trapezoidal");
+        cache.solve(study);
+        CHECK(cache.getNumNearHits() == 2);
+        CHECK(cache.getNumMisses() == 2);
+
+        cache.invalidate(study);
+        CHECK_FALSE(cache.contains(study));
+    }
+
+    SECTION("Guess set through the API") {
+        auto& solver = study.updSolver<MocoCasADiSolver>();
+        const std::string keyWithoutGuess =
+                MocoSolutionCache::computeKey(study);
+        MocoTrajectory guess = solver.createGuess("bounds");
+        solver.setGuess(guess);
+        const std::string key = MocoSolutionCache::computeKey(study);
+        CHECK(key != keyWithoutGuess);
+        CHECK(MocoSolutionCache::computeKey(study) == key);
+        guess.setTime(guess.getTime() * 2);
+        solver.setGuess(guess);
+        CHECK(MocoSolutionCache::computeKey(study) != key);
+    }
+
+    SECTION("MocoStudy property") {
+        study.set_solution_cache_directory(cache.getDirectory());
+        MocoSolution first = study.solve();
+        CHECK(cache.contains(study));
+        MocoSolution second = study.solve();
+        CHECK(second.getObjective() == first.getObjective());
+        // A study with a different structure is not a near match.
+        study.updProblem().addGoal<MocoControlGoal>("effort2", 0.1);
+        CHECK_FALSE(cache.contains(study));
+        MocoSolution third = cache.solve(study);
+        CHECK(third.success());
+        CHECK(cache.getNumHits() == 0);
+        CHECK(cache.getNumNearHits() == 0);
+        CHECK(cache.getNumMisses() == 1);
+        CHECK(cache.contains(study));
+        CHECK(MocoSolutionCache::computeKey(study).size() == 16);
+    }
+}
+
+TEST_CASE("MocoSweep property paths") {
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+    study.updProblem().addGoal<MocoControlGoal>("effort", 0.1);
+
+    MocoSweep::setPropertyValueByPath(
+            study, "problem/phases/0/goals/effort/weight", "0.5");
+    CHECK(study.getProblem().getPhase(0).getGoal("effort").getWeight() ==
+            0.5);
+    MocoSweep::setPropertyValueByPath(
+            study, "problem/phases/0/effort/weight", "0.25");
+    CHECK(study.getProblem().getPhase(0).getGoal("effort").getWeight() ==
+            0.25);
+    MocoSweep::setPropertyValueByPath(
+            study, "problem/phases/0/time_final_bounds/bounds", "2 3");
+    CHECK(study.getProblem().getPhase(0).getTimeFinalBounds().getUpper() ==
+            3);
+    MocoSweep::setPropertyValueByPath(
+            study, "solver/num_mesh_intervals", "7");
+    CHECK(study.updSolver<MocoCasADiSolver>().get_num_mesh_intervals() == 7);
+
+    CHECK_THROWS_WITH(MocoSweep::setPropertyValueByPath(
+                              study, "problem/phases/0/goals/effort", "1"),
+            ContainsSubstring("ends with an object"));
+    CHECK_THROWS_WITH(MocoSweep::setPropertyValueByPath(
+                              study, "problem/phases/0/nonexistent/weight", "1"),
+            ContainsSubstring("is neither a property nor an object"));
+    CHECK_THROWS_WITH(MocoSweep::setPropertyValueByPath(
+                              study, "problem/phases/0/goals", "1"),
+            ContainsSubstring("contains objects"));
+
+    MocoSweep sweep(study);
+    CHECK_THROWS_AS(sweep.setOverrides({"solver/num_mesh_intervals"},
+                            {{"10"}, {"10", "20"}}),
+            Exception);
+    sweep.setOverrides({"name", "problem/phases/0/effort/weight"},
+            {{"low", "0.1"}, {"high", "10"}});
+    CHECK(sweep.getNumRuns() == 2);
+    CHECK(sweep.getRunName(1) == "high");
+    CHECK(sweep.createStudy(1).getProblem().getPhase(0).getGoal("effort")
+                    .getWeight() == 10);
+}
+
+TEST_CASE("MocoSweep", "[casadi]") {
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+    study.updProblem().addGoal<MocoControlGoal>("effort", 0.1);
+    const std::string directory = "testMocoInterface_sweep";
+    {
+        std::ofstream overrides("testMocoInterface_sweep.csv");
+        overrides << "# A comment.\n"
+                  << "problem/phases/0/effort/weight, solver/num_mesh_intervals\n"
+                  << "0.1, 10\n"
+                  << "1.0, 10\n"
+                  << "10.0, 15\n";
+    }
+    MocoSweep sweep(study);
+    sweep.setOverridesFromFile("testMocoInterface_sweep.csv");
+    sweep.setResultsDirectory(directory);
+    for (int run = 0; run < sweep.getNumRuns(); ++run) {
+        std::remove((directory + "/" + sweep.getRunName(run) + "_result.txt")
+                            .c_str());
+    }
+    REQUIRE(sweep.getNumRuns() == 3);
+
+    // Solve the first partition (runs 0 and 2).
+    sweep.setPartition(0, 2);
+    auto results = sweep.run();
+    REQUIRE(results.size() == 2);
+    CHECK(results[0].name == "run0000");
+    CHECK(results[1].name == "run0002");
+    for (const auto& result : results) {
+        CHECK(result.success);
+        CHECK_FALSE(result.fromCheckpoint);
+    }
+
+    // Resume the whole sweep: only run 1 is solved.
+    sweep.setPartition(0, 1);
+    auto resumed = sweep.run();
+    REQUIRE(resumed.size() == 3);
+    CHECK(resumed[0].fromCheckpoint);
+    CHECK_FALSE(resumed[1].fromCheckpoint);
+    CHECK(resumed[2].fromCheckpoint);
+    CHECK(resumed[0].objective == results[0].objective);
+    CHECK(resumed[1].objective > resumed[0].objective);
+
+    // The results match solving the study directly.
+    MocoSolution direct = sweep.createStudy(1).solve();
+    CHECK(resumed[1].objective == Approx(direct.getObjective()).epsilon(1e-6));
+    MocoTrajectory fromFile(directory + "/run0001_solution.sto");
+    CHECK(fromFile.isNumericallyEqual(direct, 1e-6));
+
+    std::ifstream summary(directory + "/sweep_summary.csv");
+    std::string header;
+    std::getline(summary, header);
+    CHECK(header == "name,problem/phases/0/effort/weight,"
+                    "solver/num_mesh_intervals,success,objective,"
+                    "num_iterations,solver_duration");
+    int numLines = 0;
+    std::string line;
+    while (std::getline(summary, line)) ++numLines;
+    CHECK(numLines == 3);
+
+    // A failed run is solved again when resuming.
+    MocoSweep failing(study);
+    failing.setOverrides({"name", "solver/num_mesh_intervals"},
+            {{"failing", "-1"}});
+    failing.setResultsDirectory(directory);
+    std::remove((directory + "/failing_result.txt").c_str());
+    auto failed = failing.run();
+    REQUIRE(failed.size() == 1);
+    CHECK_FALSE(failed[0].success);
+    failed = failing.run();
+    REQUIRE(failed.size() == 1);
+    CHECK_FALSE(failed[0].success);
+    CHECK_FALSE(failed[0].fromCheckpoint);
+    // ...unless retrying is disabled.
+    failing.setRetryFailedRuns(false);
+    failed = failing.run();
+    REQUIRE(failed.size() == 1);
+    CHECK_FALSE(failed[0].success);
+    CHECK(failed[0].fromCheckpoint);
+
+    // A checkpoint that cannot be written is reported in the result.
+    MocoSweep unwritable(study);
+    unwritable.setOverrides({"name", "solver/num_mesh_intervals"},
+            {{"unwritable", "-1"}});
+    unwritable.setResultsDirectory(directory);
+    std::remove((directory + "/unwritable_result.txt").c_str());
+    IO::makeDir(directory + "/unwritable_result.txt.tmp");
+    auto unwritten = unwritable.run();
+    REQUIRE(unwritten.size() == 1);
+    CHECK_FALSE(unwritten[0].success);
+    CHECK_THAT(unwritten[0].status, ContainsSubstring("Could not open file"));
+}
+
+TEST_CASE("MocoCasADiSession", "[casadi]") {
+    const auto createStudy = [](double weight) {
+        MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+        study.updProblem().addGoal<MocoControlGoal>("effort", weight);
+        return study;
+    };
+    MocoStudy study = createStudy(0.1);
+    MocoCasADiSession session(study.updSolver<MocoCasADiSolver>());
+    MocoSolution first = session.solve();
+    REQUIRE(first.success());
+    CHECK(session.getNumSolves() == 1);
+    CHECK(first.getObjective() ==
+            Approx(createStudy(0.1).solve().getObjective()).epsilon(1e-4));
+
+    SECTION("Cost weight") {
+        session.setCostWeight("effort", 10.0);
+        MocoSolution solution = session.solve();
+        REQUIRE(solution.success());
+        CHECK(session.getNumSolves() == 2);
+        MocoSolution expected = createStudy(10.0).solve();
+        CHECK(solution.getObjective() ==
+                Approx(expected.getObjective()).epsilon(1e-4));
+        CHECK(solution.getObjectiveTerm("effort") ==
+                Approx(expected.getObjectiveTerm("effort")).epsilon(1e-4));
+        CHECK_THROWS_AS(session.setCostWeight("nonexistent", 1.0), Exception);
+    }
+
+    SECTION("Bounds") {
+        session.setStateInfo("/slider/position/value", {0, 1}, 0, 0.5);
+        MocoSolution solution = session.solve();
+        REQUIRE(solution.success());
+        const auto position = solution.getState("/slider/position/value");
+        CHECK(position[position.size() - 1] == Approx(0.5));
+
+        MocoStudy expectedStudy = createStudy(0.1);
+        expectedStudy.updProblem().setStateInfo(
+                "/slider/position/value", {0, 1}, 0, 0.5);
+        MocoSolution expected = expectedStudy.solve();
+        CHECK(solution.getObjective() ==
+                Approx(expected.getObjective()).epsilon(1e-4));
+        CHECK(solution.getFinalTime() ==
+                Approx(expected.getFinalTime()).epsilon(1e-4));
+        CHECK_THROWS_AS(session.setStateInfo("/nonexistent", {0, 1}),
+                Exception);
+    }
+
+    SECTION("Time bounds") {
+        session.setTimeBounds(MocoInitialBounds(0), MocoFinalBounds(2, 3));
+        MocoSolution solution = session.solve();
+        REQUIRE(solution.success());
+        CHECK(solution.getFinalTime() >= 2 - 1e-8);
+
+        MocoStudy expectedStudy = createStudy(0.1);
+        expectedStudy.updProblem().setTimeBounds(
+                MocoInitialBounds(0), MocoFinalBounds(2, 3));
+        MocoSolution expected = expectedStudy.solve();
+        CHECK(solution.getFinalTime() ==
+                Approx(expected.getFinalTime()).epsilon(1e-4));
+        CHECK(solution.getObjective() ==
+                Approx(expected.getObjective()).epsilon(1e-4));
+    }
+
+    SECTION("Guess") {
+        session.setGuess(first);
+        MocoSolution solution = session.solve();
+        REQUIRE(solution.success());
+        // Starting from the optimum requires fewer iterations.
+        CHECK(solution.getNumIterations() < first.getNumIterations());
+        CHECK(solution.getObjective() ==
+                Approx(first.getObjective()).epsilon(1e-6));
+    }
+
+    SECTION("Prescribed kinematics") {
+        // The model does not contain a PositionMotion.
+        CHECK_THROWS_AS(session.setPrescribedKinematics(PositionMotion()),
+                Exception);
+    }
+}
+
 TEST_CASE("generateSpeedsFromValues() does not overwrite auxiliary states.") {
     int N = 20;
     SimTK::Vector time = createVectorLinspace(20, 0.0, 1.0);
@@ -209,6 +209,42 @@ TEST_CASE("MocoInverse Rajagopal2016, 18 muscles", "[casadi]") {
         }
     }
 
+    SECTION("solveTrials") {
+        // Each trial's time range comes from its kinematics. The second trial
+        // starts from the solution of the first trial, with its times scaled
+        // to the second trial's time range.
+        inverse.updProperty_initial_time().clear();
+        inverse.updProperty_final_time().clear();
+        const TimeSeriesTable kinematics = inverse.get_kinematics().process();
+        TimeSeriesTable firstKinematics = kinematics;
+        firstKinematics.trim(0.45, 1.0);
+        TimeSeriesTable secondKinematics = kinematics;
+        secondKinematics.trim(0.5, 1.1);
+        const auto solutions = inverse.solveTrials(
+                {TableProcessor(firstKinematics),
+                        TableProcessor(secondKinematics)});
+        REQUIRE(solutions.size() == 2);
+        const MocoSolution& first = solutions[0].getMocoSolution();
+        const MocoSolution& second = solutions[1].getMocoSolution();
+        REQUIRE(first.success());
+        REQUIRE(second.success());
+        CHECK(first.getInitialTime() == Approx(0.45));
+        CHECK(first.getFinalTime() == Approx(1.0));
+        CHECK(second.getInitialTime() == Approx(0.5));
+        CHECK(second.getFinalTime() == Approx(1.1));
+        // Every trial uses the number of mesh intervals of the first trial.
+        CHECK(second.getNumTimes() == first.getNumTimes());
+        CHECK(solutions[1].getOutputs().getNumColumns() ==
+                solutions[0].getOutputs().getNumColumns());
+
+        // The second trial matches solving it on its own.
+        inverse.setKinematics(TableProcessor(secondKinematics));
+        const MocoSolution alone = inverse.solve().getMocoSolution();
+        REQUIRE(alone.success());
+        CHECK(second.compareContinuousVariablesRMS(alone,
+                      {{"controls", {}}}) < 1e-2);
+    }
+
     SECTION("initializeKinematics") {
         auto kinematics = inverse.initializeKinematics();
         // check that some of the expected columns are there
@@ -222,6 +258,7 @@ TEST_CASE("MocoInverse Rajagopal2016, 18 muscles", "[casadi]") {
                 "/jointset/back/lumbar_extension/speed"));
     }
 }
+
 // Next test_case fails on linux while parsing .sto file, disabling for now 
 #ifdef _WIN32
 TEST_CASE("Test IMUDataReporter for gait") {
@@ -54,9 +54,11 @@
 #include "MocoInverse.h"
 #include "MocoParameter.h"
 #include "MocoProblem.h"
+#include "MocoSolutionCache.h"
 #include "MocoSolver.h"
 #include "MocoStudy.h"
 #include "MocoStudyFactory.h"
+#include "MocoSweep.h"
 #include "MocoTrack.h"
 #include "MocoTrajectory.h"
 #include "MocoTropterSolver.h"
@@ -225,17 +225,29 @@ void PrescribedController::extendConnectToModel(Model& model) {
     }
 }
 
+void PrescribedController::extendAddToSystem(
+        SimTK::MultibodySystem& system) const {
+    Super::extendAddToSystem(system);
+    _functionHintsCV = addCacheVariable("function_hints",
+            std::vector<int>(get_ControlFunctions().getSize(), 0),
+            SimTK::Stage::Topology);
+}
+
 //=============================================================================
 // CONTROLLER INTERFACE
 //=============================================================================
 void PrescribedController::computeControls(const SimTK::State& s,
         SimTK::Vector& controls) const {
     SimTK::Vector actControls(1, 0.0);
-    SimTK::Vector time(1, s.getTime());
+    const double time = s.getTime();
 
+    // Each State has its own hints, so that evaluating the functions along a
+    // trajectory (e.g., controls from a long file) is fast.
+    std::vector<int>& hints = updCacheVariableValue(s, _functionHintsCV);
     const auto& socket = getSocket<Actuator>("actuators");
     for(int i = 0; i < (int)socket.getNumConnectees(); ++i){
-        actControls[0] = get_ControlFunctions()[i].calcValue(time);
+        actControls[0] =
+                get_ControlFunctions()[i].calcValue1WithHint(time, hints[i]);
         socket.getConnectee(i).addInControls(actControls, controls);
     }
 }
@@ -144,6 +144,7 @@ public:
 protected:
     // MODEL COMPONENT INTERFACE
     void extendConnectToModel(Model& model) override;
+    void extendAddToSystem(SimTK::MultibodySystem& system) const override;
     void updateFromXMLNode(SimTK::Xml::Element& node,
                            int versionNumber) override;
 
@@ -162,6 +163,11 @@ private:
     // Member variables.
     std::unordered_map<std::string, int> _actuLabelsToControlFunctionIndexMap;
 
+    // The interval of each control function found by the previous evaluation
+    // in a State, which is the hint for the next evaluation in that State
+    // (see Function::calcValue1WithHint()).
+    mutable CacheVariable<std::vector<int>> _functionHintsCV;
+
 };  // class PrescribedController
 
 } // namespace OpenSim
@@ -24,6 +24,7 @@
 #include "InverseDynamicsSolver.h"
 #include "Model/Model.h"
 #include <OpenSim/Common/FunctionSet.h>
+#include <OpenSim/Common/Instrumentation.h>
 
 using namespace std;
 using namespace SimTK;
@@ -170,6 +171,7 @@ void InverseDynamicsSolver::solve(SimTK::State &s, const FunctionSet &Qs, const
     AnalysisSet& analysisSet = const_cast<AnalysisSet&>(getModel().getAnalysisSet());
     //fill in results for each time
     for(int i=0; i<nt; i++){ 
+        OPENSIM_INSTRUMENT_SCOPE("InverseDynamicsSolver::frame");
         genForceTrajectory[i] = solve(s, Qs, times[i]);
         analysisSet.step(s, i);
     }
@@ -189,6 +191,7 @@ void InverseDynamicsSolver::solve(SimTK::State& s, const FunctionSet& Qs,
             const_cast<AnalysisSet&>(getModel().getAnalysisSet());
     // fill in results for each time
     for (int i = 0; i < nt; i++) {
+        OPENSIM_INSTRUMENT_SCOPE("InverseDynamicsSolver::frame");
         genForceTrajectory[i] =
                 solve(s, Qs, coordinatesToSpeedsIndexMap, times[i]);
         analysisSet.step(s, i);
@@ -30,6 +30,7 @@
 #include <OpenSim/Simulation/Model/AnalysisSet.h>
 #include <OpenSim/Simulation/Model/ControllerSet.h>
 #include <OpenSim/Common/Array.h>
+#include <OpenSim/Common/Instrumentation.h>
 
 
 using namespace OpenSim;
@@ -645,6 +646,7 @@ hasStateStorage() const
 
 const SimTK::State& Manager::integrate(double finalTime)
 {
+    OPENSIM_INSTRUMENT_SCOPE("Manager::integrate");
     int step = 1; // for AnalysisSet::step()
 
     if (_timeStepper == nullptr) {
@@ -725,7 +727,10 @@ const SimTK::State& Manager::integrate(double finalTime)
             stepToTime = time + fixedStepSize;
         }
 
-        status = _timeStepper->stepTo(stepToTime);
+        {
+            OPENSIM_INSTRUMENT_SCOPE("Manager::step");
+            status = _timeStepper->stepTo(stepToTime);
+        }
 
         if ( (status == SimTK::Integrator::TimeHasAdvanced) ||
              (status == SimTK::Integrator::ReachedScheduledEvent) ) {
@@ -742,6 +747,8 @@ const SimTK::State& Manager::integrate(double finalTime)
             return getState();
         }
 
+        OPENSIM_INSTRUMENT_COUNTER("Manager::stepSize",
+                _integ->getState().getTime() - time);
         time = _integ->getState().getTime();
         // CHECK FOR INTERRUPT
         if (checkHalt()) break;
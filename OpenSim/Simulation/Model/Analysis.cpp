@@ -352,6 +352,28 @@ ArrayPtrs<Storage>& Analysis::getStorageList()
     return _storageList;
 }
 
+void Analysis::appendResults(const Analysis& other, double afterTime)
+{
+    ArrayPtrs<Storage>& storages = getStorageList();
+    ArrayPtrs<Storage>& otherStorages =
+            const_cast<Analysis&>(other).getStorageList();
+    OPENSIM_THROW_IF_FRMOBJ(storages.getSize() != otherStorages.getSize(),
+            Exception,
+            "Expected the other analysis to have {} storages, but it has {}.",
+            storages.getSize(), otherStorages.getSize());
+    for (int i = 0; i < storages.getSize(); ++i) {
+        appendRows(*storages[i], *otherStorages[i], afterTime);
+    }
+}
+
+void Analysis::appendRows(Storage& to, const Storage& from, double afterTime)
+{
+    for (int i = 0; i < from.getSize(); ++i) {
+        const StateVector& row = *from.getStateVector(i);
+        if (row.getTime() > afterTime) to.append(row);
+    }
+}
+
 // GET AND SET
 //=============================================================================
 //_____________________________________________________________________________
@@ -231,6 +231,31 @@ public:
         printResults(const std::string &aBaseName,const std::string &aDir="",
         double aDT=-1.0,const std::string &aExtension=".sto");
 
+    //--------------------------------------------------------------------------
+    // PARALLEL ANALYSIS
+    //--------------------------------------------------------------------------
+    /**
+     * Do the results that this analysis records at each time depend only on
+     * the state at that time (and not on the states at previous times)? If
+     * so, AnalyzeTool may run copies of this analysis on different parts of
+     * a motion at the same time, and then combine their results with
+     * appendResults(). The default is false.
+     */
+    virtual bool isFrameIndependent() const { return false; }
+
+    /**
+     * Append the results that another copy of this analysis recorded after
+     * the given time to the results of this analysis. The default
+     * implementation appends the rows of each storage in getStorageList() to
+     * the corresponding storage of this analysis; analyses that keep their
+     * results elsewhere must override this if isFrameIndependent() is true.
+     */
+    virtual void appendResults(const Analysis& other, double afterTime);
+
+protected:
+    /** Append the rows of `from` with times after `afterTime` to `to`. */
+    static void appendRows(Storage& to, const Storage& from, double afterTime);
+
 //=============================================================================
 };  // END of class Analysis
 
@@ -21,8 +21,14 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <fstream>
+#include <map>
+#include <set>
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/Logger.h>
 #include "ContactMesh.h"
 #include "Model.h"
 
@@ -51,8 +57,7 @@ ContactMesh::ContactMesh(const std::string& filename,
         file.close();
         SimTK::PolygonalMesh mesh;
         mesh.loadFile(filename);
-        _geometry.reset(new SimTK::ContactGeometry::TriangleMesh(mesh));
-        _decorativeGeometry.reset(new SimTK::DecorativeMesh(mesh));
+        _geometry.reset(createTriangleMesh(mesh));
     }
 }
 
@@ -74,9 +79,13 @@ void ContactMesh::setNull()
 void ContactMesh::constructProperties()
 {
     constructProperty_filename("");
+    constructProperty_decimation_cell_size(0.0);
 }
 
 void ContactMesh::extendFinalizeFromProperties() {
+    OPENSIM_THROW_IF_FRMOBJ(get_decimation_cell_size() < 0,
+            Exception, "Expected decimation_cell_size to be non-negative, "
+            "but got {}.", get_decimation_cell_size());
     _geometry.reset();
     _decorativeGeometry.reset();
 }
@@ -93,6 +102,122 @@ void ContactMesh::setFilename(const std::string& filename)
     _decorativeGeometry.reset();
 }
 
+double ContactMesh::getDecimationCellSize() const
+{
+    return get_decimation_cell_size();
+}
+
+void ContactMesh::setDecimationCellSize(double cellSize)
+{
+    set_decimation_cell_size(cellSize);
+    _geometry.reset();
+    _decorativeGeometry.reset();
+}
+
+int ContactMesh::getNumFaces() const
+{
+    if (!_geometry)
+        _geometry.reset(loadMesh(get_filename()));
+    return _geometry->getNumFaces();
+}
+
+void ContactMesh::getBoundingBox(SimTK::Vec3& lower, SimTK::Vec3& upper) const
+{
+    if (!_geometry)
+        _geometry.reset(loadMesh(get_filename()));
+    lower = SimTK::Vec3(SimTK::Infinity);
+    upper = SimTK::Vec3(-SimTK::Infinity);
+    for (int iv = 0; iv < _geometry->getNumVertices(); ++iv) {
+        const SimTK::Vec3& v = _geometry->getVertexPosition(iv);
+        for (int k = 0; k < 3; ++k) {
+            lower[k] = std::min(lower[k], v[k]);
+            upper[k] = std::max(upper[k], v[k]);
+        }
+    }
+}
+
+SimTK::PolygonalMesh ContactMesh::decimateMesh(
+        const SimTK::PolygonalMesh& mesh, double cellSize)
+{
+    OPENSIM_THROW_IF(cellSize <= 0, Exception,
+            "Expected cellSize to be positive, but got {}.", cellSize);
+
+    // Assign each vertex to a grid cell; vertices sharing a cell are merged.
+    using CellKey = std::array<long long, 3>;
+    std::map<CellKey, int> cellToNewVertex;
+    std::vector<int> oldToNewVertex(mesh.getNumVertices());
+    std::vector<SimTK::Vec3> centroidSums;
+    std::vector<int> centroidCounts;
+    for (int iv = 0; iv < mesh.getNumVertices(); ++iv) {
+        const SimTK::Vec3& v = mesh.getVertexPosition(iv);
+        const CellKey key{{(long long)std::floor(v[0] / cellSize),
+                           (long long)std::floor(v[1] / cellSize),
+                           (long long)std::floor(v[2] / cellSize)}};
+        auto it = cellToNewVertex.find(key);
+        if (it == cellToNewVertex.end()) {
+            it = cellToNewVertex.emplace(key, (int)centroidSums.size()).first;
+            centroidSums.push_back(SimTK::Vec3(0));
+            centroidCounts.push_back(0);
+        }
+        oldToNewVertex[iv] = it->second;
+        centroidSums[it->second] += v;
+        ++centroidCounts[it->second];
+    }
+
+    SimTK::PolygonalMesh decimated;
+    for (int iv = 0; iv < (int)centroidSums.size(); ++iv) {
+        decimated.addVertex(centroidSums[iv] / centroidCounts[iv]);
+    }
+
+    // Triangulate each face as a fan and keep only the triangles that neither
+    // collapsed nor duplicate a triangle that was already added.
+    std::set<std::array<int, 3>> addedFaces;
+    SimTK::Array_<int> triangle(3);
+    for (int iface = 0; iface < mesh.getNumFaces(); ++iface) {
+        const int numFaceVertices = mesh.getNumVerticesForFace(iface);
+        const int v0 = oldToNewVertex[mesh.getFaceVertex(iface, 0)];
+        for (int k = 1; k < numFaceVertices - 1; ++k) {
+            const int v1 = oldToNewVertex[mesh.getFaceVertex(iface, k)];
+            const int v2 = oldToNewVertex[mesh.getFaceVertex(iface, k + 1)];
+            if (v0 == v1 || v1 == v2 || v2 == v0) continue;
+            std::array<int, 3> sorted{{v0, v1, v2}};
+            std::sort(sorted.begin(), sorted.end());
+            if (!addedFaces.insert(sorted).second) continue;
+            triangle[0] = v0;
+            triangle[1] = v1;
+            triangle[2] = v2;
+            decimated.addFace(triangle);
+        }
+    }
+    return decimated;
+}
+
+SimTK::ContactGeometry::TriangleMesh* ContactMesh::
+    createTriangleMesh(const SimTK::PolygonalMesh& mesh) const
+{
+    const double cellSize = get_decimation_cell_size();
+    if (cellSize > 0) {
+        SimTK::PolygonalMesh decimated = decimateMesh(mesh, cellSize);
+        try {
+            // TriangleMesh requires a closed manifold; clustering can break
+            // this if the cells are large relative to the mesh features.
+            auto* triMesh = new SimTK::ContactGeometry::TriangleMesh(decimated);
+            log_debug("ContactMesh '{}': decimated '{}' from {} to {} faces.",
+                    getName(), get_filename(), mesh.getNumFaces(),
+                    decimated.getNumFaces());
+            _decorativeGeometry.reset(new SimTK::DecorativeMesh(decimated));
+            return triMesh;
+        } catch (const std::exception& e) {
+            log_warn("ContactMesh '{}': decimating '{}' with a cell size of {} "
+                     "did not produce a closed mesh ({}); using the "
+                     "full-resolution mesh instead.",
+                    getName(), get_filename(), cellSize, e.what());
+        }
+    }
+    _decorativeGeometry.reset(new SimTK::DecorativeMesh(mesh));
+    return new SimTK::ContactGeometry::TriangleMesh(mesh);
+}
+
 SimTK::ContactGeometry::TriangleMesh* ContactMesh::
     loadMesh(const std::string& filename) const
 {
@@ -114,8 +239,7 @@ SimTK::ContactGeometry::TriangleMesh* ContactMesh::
     }
     file.close();
     mesh.loadFile(filename);
-    _decorativeGeometry.reset(new SimTK::DecorativeMesh(mesh));
-    return new SimTK::ContactGeometry::TriangleMesh(mesh);
+    return createTriangleMesh(mesh);
 }
 
 SimTK::ContactGeometry ContactMesh::createSimTKContactGeometry() const
@@ -45,6 +45,12 @@ public:
     OpenSim_DECLARE_PROPERTY(filename, std::string,
             "Path to mesh geometry file (supports .obj, .stl, .vtp). "
             "Mesh should be closed and water-tight.");
+    OpenSim_DECLARE_PROPERTY(decimation_cell_size, double,
+            "Edge length (in meters) of the grid cells used to simplify the "
+            "mesh when it is loaded. Vertices that fall within the same cell "
+            "are merged, which reduces the number of faces (and elastic "
+            "foundation springs) that must be checked for contact. "
+            "Default: 0, meaning the mesh is used at full resolution.");
 
 //=============================================================================
 // METHODS
@@ -93,6 +99,40 @@ public:
      * %Set the name of the file to load the mesh from.
      */
     void setFilename(const std::string& filename);
+    /**
+     * Get the edge length of the grid cells used to decimate the mesh on load.
+     * A value of 0 means the mesh is not decimated.
+     */
+    double getDecimationCellSize() const;
+    /**
+     * %Set the edge length of the grid cells used to decimate the mesh on
+     * load. Vertices falling within the same cell are merged into their
+     * centroid and collapsed faces are removed. If the simplified mesh is no
+     * longer closed, the full-resolution mesh is used instead and a warning is
+     * logged.
+     */
+    void setDecimationCellSize(double cellSize);
+    /**
+     * Get the number of faces of the loaded (possibly decimated) contact
+     * mesh. The mesh is loaded if it has not been loaded yet.
+     */
+    int getNumFaces() const;
+    /**
+     * Get the axis-aligned bounding box of the loaded (possibly decimated)
+     * contact mesh, expressed in the mesh's own frame (defined by the
+     * location and orientation properties). The mesh is loaded if it has not
+     * been loaded yet.
+     */
+    void getBoundingBox(SimTK::Vec3& lower, SimTK::Vec3& upper) const;
+
+    /**
+     * Simplify a mesh by clustering its vertices on a uniform grid with the
+     * given cell size. Each face is triangulated, vertices in the same cell
+     * are merged into their centroid, and faces that collapse or duplicate an
+     * existing face are removed. The result is not guaranteed to be closed.
+     */
+    static SimTK::PolygonalMesh decimateMesh(const SimTK::PolygonalMesh& mesh,
+            double cellSize);
 
     // VISUALIZATION
     void generateDecorations(bool fixed, const ModelDisplayHints& hints,
@@ -108,6 +148,11 @@ private:
     @param filename   string containing the file to be loaded
     @return SimTK::ContactGeometry::TriangleMesh* heap allocated Contact mesh */
     SimTK::ContactGeometry::TriangleMesh* loadMesh(const std::string& filename) const;
+    /** Create the contact mesh (and its decorative counterpart) from a
+    polygonal mesh, applying decimation if requested.
+    @return SimTK::ContactGeometry::TriangleMesh* heap allocated Contact mesh */
+    SimTK::ContactGeometry::TriangleMesh* createTriangleMesh(
+            const SimTK::PolygonalMesh& mesh) const;
 //=============================================================================
 // DATA
 //=============================================================================
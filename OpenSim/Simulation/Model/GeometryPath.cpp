@@ -27,6 +27,7 @@
 #include "GeometryPath.h"
 
 #include <OpenSim/Common/Assertion.h>
+#include <OpenSim/Common/Instrumentation.h>
 #include <OpenSim/Simulation/Model/ConditionalPathPoint.h>
 #include <OpenSim/Simulation/Model/ForceConsumer.h>
 #include <OpenSim/Simulation/Model/Model.h>
@@ -855,6 +856,8 @@ void GeometryPath::computePath(const SimTK::State& s) const
         return;
     }
 
+    OPENSIM_INSTRUMENT_SCOPE("GeometryPath::computePath");
+
     // Clear the current path.
     _currentPathPtrsCache.setSize(0);
 
@@ -43,6 +43,7 @@
 
 #include <OpenSim/Common/Constant.h>
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/Instrumentation.h>
 #include <OpenSim/Common/Logger.h>
 #include <OpenSim/Common/ScaleSet.h>
 #include <OpenSim/Common/Storage.h>
@@ -56,6 +57,7 @@
 #include <OpenSim/Simulation/SimbodyEngine/SimbodyEngine.h>
 #include <OpenSim/Simulation/SimbodyEngine/WeldConstraint.h>
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <string>
@@ -1275,29 +1277,43 @@ void Model::generateDecorations
 
 void Model::equilibrateMuscles(SimTK::State& state)
 {
+    OPENSIM_INSTRUMENT_SCOPE("Model::equilibrateMuscles");
     getMultibodySystem().realize(state, Stage::Velocity);
 
     bool failed = false;
     string errorMsg = "";
 
-    auto muscles = getComponentList<Muscle>();
+    // Group the muscles by class so that each muscle class can equilibrate
+    // all of its muscles at once (see Muscle::computeEquilibria()).
+    std::vector<std::vector<const Muscle*>> groups;
+    for (const auto& muscle : getComponentList<Muscle>()) {
+        if (!muscle.appliesForce(state)) continue;
+        auto group = std::find_if(groups.begin(), groups.end(),
+                [&](const std::vector<const Muscle*>& g) {
+                    return g.front()->getConcreteClassName() ==
+                           muscle.getConcreteClassName();
+                });
+        if (group == groups.end()) {
+            groups.push_back({&muscle});
+        } else {
+            group->push_back(&muscle);
+        }
+    }
 
-    for (auto& muscle : muscles) {
-        if (muscle.appliesForce(state)){
-            try{
-                muscle.computeEquilibrium(state);
-            }
-            catch (const std::exception& e) {
-                if(!failed){ // haven't failed to equilibrate other muscles yet
-                    errorMsg = e.what();
-                    failed = true;
-                }
-                // just because one muscle failed to equilibrate doesn't mean 
-                // it isn't still useful to have remaining muscles equilibrate
-                // in an analysis, for example, we might not be reporting about
-                // all muscles, so continue with the rest.
-                continue;
+    for (const auto& group : groups) {
+        try {
+            group.front()->computeEquilibria(state, group);
+        }
+        catch (const std::exception& e) {
+            if(!failed){ // haven't failed to equilibrate other muscles yet
+                errorMsg = e.what();
+                failed = true;
             }
+            // just because one muscle failed to equilibrate doesn't mean 
+            // it isn't still useful to have remaining muscles equilibrate
+            // in an analysis, for example, we might not be reporting about
+            // all muscles, so continue with the rest.
+            continue;
         }
     }
 
@@ -2224,31 +2240,37 @@ const Object& Model::getObjectByTypeAndName(const std::string& typeString, const
 //------------------------------------------------------------------------------
 void Model::realizeTime(const SimTK::State& state) const
 {
+    OPENSIM_INSTRUMENT_SCOPE("Model::realizeTime");
     getSystem().realize(state, Stage::Time);
 }
 
 void Model::realizePosition(const SimTK::State& state) const
 {
+    OPENSIM_INSTRUMENT_SCOPE("Model::realizePosition");
     getSystem().realize(state, Stage::Position);
 }
 
 void Model::realizeVelocity(const SimTK::State& state) const
 {
+    OPENSIM_INSTRUMENT_SCOPE("Model::realizeVelocity");
     getSystem().realize(state, Stage::Velocity);
 }
 
 void Model::realizeDynamics(const SimTK::State& state) const
 {
+    OPENSIM_INSTRUMENT_SCOPE("Model::realizeDynamics");
     getSystem().realize(state, Stage::Dynamics);
 }
 
 void Model::realizeAcceleration(const SimTK::State& state) const
 {
+    OPENSIM_INSTRUMENT_SCOPE("Model::realizeAcceleration");
     getSystem().realize(state, Stage::Acceleration);
 }
 
 void Model::realizeReport(const SimTK::State& state) const
 {
+    OPENSIM_INSTRUMENT_SCOPE("Model::realizeReport");
     getSystem().realize(state, Stage::Report);
 }
 
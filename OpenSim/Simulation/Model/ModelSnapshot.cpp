@@ -0,0 +1,95 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  ModelSnapshot.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+
+#include "ModelSnapshot.h"
+
+#include "Model.h"
+
+#include <OpenSim/Common/About.h>
+#include <OpenSim/Common/BinaryIO.h>
+#include <OpenSim/Common/Logger.h>
+
+#include <cstring>
+#include <fstream>
+
+using namespace OpenSim;
+
+namespace {
+// The first bytes of each snapshot file.
+constexpr char magic[] = "OSIMSNAP";
+constexpr std::size_t magicSize = sizeof(magic) - 1;
+}
+
+void ModelSnapshot::write(const Model& model, const std::string& fileName) {
+    std::ofstream stream(fileName, std::ios::binary);
+    OPENSIM_THROW_IF(!stream, Exception,
+            "Could not open file '{}' for writing.", fileName);
+    BinaryIO::writeBytes(stream, magic, magicSize);
+    BinaryIO::writeByteOrderMark(stream);
+    BinaryIO::write(stream, formatVersion);
+    BinaryIO::write(stream, GetVersion());
+    BinaryIO::write(stream, model.getInputFileName());
+    model.writeToBinaryStream(stream);
+    OPENSIM_THROW_IF(!stream, Exception,
+            "Could not write the snapshot of model '{}' to file '{}'.",
+            model.getName(), fileName);
+    log_info("Wrote a snapshot of model {} to file {}.", model.getName(),
+            fileName);
+}
+
+std::unique_ptr<Model> ModelSnapshot::read(const std::string& fileName) {
+    std::ifstream stream(fileName, std::ios::binary);
+    OPENSIM_THROW_IF(!stream, Exception,
+            "Could not open file '{}' for reading.", fileName);
+    char fileMagic[magicSize] = {};
+    stream.read(fileMagic, magicSize);
+    OPENSIM_THROW_IF(!stream || std::memcmp(fileMagic, magic, magicSize),
+            Exception, "File '{}' is not a model snapshot.", fileName);
+    BinaryIO::readByteOrderMark(stream);
+    const int fileFormatVersion = BinaryIO::read<int>(stream);
+    const std::string version = BinaryIO::read<std::string>(stream);
+    OPENSIM_THROW_IF(fileFormatVersion != formatVersion ||
+                             version != GetVersion(),
+            Exception,
+            "Model snapshot '{}' was written by OpenSim {}, but this is "
+            "OpenSim {}. Create the snapshot again from the .osim file.",
+            fileName, version, GetVersion());
+    const std::string inputFileName = BinaryIO::read<std::string>(stream);
+
+    std::unique_ptr<Object> object(Object::makeObjectFromBinaryStream(stream));
+    OPENSIM_THROW_IF(!dynamic_cast<Model*>(object.get()), Exception,
+            "Expected snapshot '{}' to contain a Model, but it contains a {}.",
+            fileName, object->getConcreteClassName());
+    std::unique_ptr<Model> model(static_cast<Model*>(object.release()));
+    model->setInputFileName(inputFileName);
+    log_info("Loaded model {} from snapshot {}", model->getName(), fileName);
+    model->finalizeFromProperties();
+    return model;
+}
+
+bool ModelSnapshot::isSnapshot(const std::string& fileName) {
+    std::ifstream stream(fileName, std::ios::binary);
+    char fileMagic[magicSize] = {};
+    stream.read(fileMagic, magicSize);
+    return stream && !std::memcmp(fileMagic, magic, magicSize);
+}
@@ -0,0 +1,90 @@
+#ifndef OPENSIM_MODELSNAPSHOT_H_
+#define OPENSIM_MODELSNAPSHOT_H_
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  ModelSnapshot.h                          *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+
+#include <memory>
+#include <string>
+
+namespace OpenSim {
+
+class Model;
+
+/** Write and read models in a binary snapshot format that loads faster than
+an .osim file. Loading an .osim file requires parsing XML, updating the
+properties of models written by older versions of %OpenSim, and converting
+each property value from text; loading a snapshot reads the property values
+directly (see Object::writeToBinaryStream()). Use snapshots when the same
+model is loaded many times (e.g., by each job of a batch of simulations);
+create a snapshot with `opensim-cmd snapshot`.
+
+A snapshot contains the model's properties, including the paths of the
+components connected to each socket, so the loaded model is the same as the
+model loaded from the .osim file. Geometry files (e.g., meshes) are not
+included; as with .osim files, they are loaded only when the model is
+visualized. Nor are data files (e.g., the data file of ExternalLoads); the
+snapshot stores the name of each file that a component was read from, so
+these data files are found relative to that file, as when loading the .osim
+file.
+
+Snapshots are intended as caches, not for storing or sharing models: a
+snapshot can only be read by the same version of %OpenSim on a machine with
+the same byte order. Keep the .osim file, and create the snapshot again after
+updating %OpenSim.
+
+@code
+ModelSnapshot::write(Model("gait2354.osim"), "gait2354.osnap");
+// In each job:
+std::unique_ptr<Model> model = ModelSnapshot::read("gait2354.osnap");
+model->initSystem();
+@endcode */
+class OSIMSIMULATION_API ModelSnapshot {
+public:
+    /// Write a snapshot of the model's properties to a file. The model's
+    /// input file name (getInputFileName()) is also stored, so that
+    /// geometry files are found relative to the original .osim file.
+    static void write(const Model& model, const std::string& fileName);
+
+    /// Read a model from a snapshot created by write(). The returned model
+    /// has been finalized from its properties (finalizeFromProperties()), as
+    /// when a model is loaded from an .osim file.
+    /// @throws Exception if the file is not a snapshot, or if it was written
+    /// by a different version of %OpenSim or on a machine with a different
+    /// byte order.
+    static std::unique_ptr<Model> read(const std::string& fileName);
+
+    /// Does the file start with the marker of a snapshot? This does not check
+    /// if the snapshot can be read by this version of %OpenSim.
+    static bool isSnapshot(const std::string& fileName);
+
+private:
+    // Incremented when the layout of the header or of the binary data
+    // (BinaryIO, Object::writeToBinaryStream()) changes.
+    static const int formatVersion = 2;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MODELSNAPSHOT_H_
@@ -30,6 +30,8 @@
 #include "Model.h"
 #include <OpenSim/Common/XMLDocument.h>
 
+#include <exception>
+
 //=============================================================================
 // STATICS
 //=============================================================================
@@ -666,6 +668,20 @@ double Muscle::calcInextensibleTendonActiveFiberForce(SimTK::State& s,
         *mli.cosPennationAngle;
 }
 
+void Muscle::computeEquilibria(SimTK::State& s,
+        const std::vector<const Muscle*>& muscles) const
+{
+    std::exception_ptr firstError;
+    for (const Muscle* muscle : muscles) {
+        try {
+            muscle->computeEquilibrium(s);
+        } catch (...) {
+            if (!firstError) firstError = std::current_exception();
+        }
+    }
+    if (firstError) std::rethrow_exception(firstError);
+}
+
 //=============================================================================
 // FORCE APPLICATION
 //=============================================================================
@@ -340,6 +340,18 @@ public:
     void computeEquilibrium(SimTK::State& s) const override final {
         return computeInitialFiberEquilibrium(s);
     }
+
+    /** Find and set the equilibrium state of each of the given muscles, which
+    must have the same concrete class as this muscle. Model::equilibrateMuscles()
+    calls this once for each muscle class in the model. By default, this calls
+    computeEquilibrium() on each muscle; muscle classes can override this to
+    solve for the equilibrium of all of the muscles at once. A muscle that
+    fails to equilibrate does not prevent the remaining muscles from
+    equilibrating; the exception from the first failure is rethrown after all
+    muscles have been processed.
+    @throws MuscleCannotEquilibrate */
+    virtual void computeEquilibria(SimTK::State& s,
+            const std::vector<const Muscle*>& muscles) const;
     // End of Muscle's State Dependent Accessors.
     //@} 
 
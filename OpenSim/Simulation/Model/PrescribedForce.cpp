@@ -242,6 +242,13 @@ void PrescribedForce::setPointFunctionNames
 //-----------------------------------------------------------------------------
 //_____________________________________________________________________________
 
+void PrescribedForce::extendAddToSystem(SimTK::MultibodySystem& system) const
+{
+    Super::extendAddToSystem(system);
+    _functionHintsCV = addCacheVariable("function_hints",
+            std::array<int, 9>{}, SimTK::Stage::Topology);
+}
+
 void PrescribedForce::implProduceForces(
     const SimTK::State& state,
     ForceConsumer& forceConsumer) const
@@ -253,7 +260,6 @@ void PrescribedForce::implProduceForces(
     const FunctionSet& torqueFunctions = getTorqueFunctions();
 
     double time = state.getTime();
-    SimTK::Vector  timeAsVector(1, time);
 
     const bool hasForceFunctions  = forceFunctions.getSize()==3;
     const bool hasPointFunctions  = pointFunctions.getSize()==3;
@@ -262,19 +268,22 @@ void PrescribedForce::implProduceForces(
     const PhysicalFrame& frame =
         getSocket<PhysicalFrame>("frame").getConnectee();
     const Ground& gnd = getModel().getGround();
+    // Each State has its own hints, so that evaluating the functions along a
+    // trajectory (e.g., a long table of kinetics) is fast.
+    std::array<int, 9>& hints = updCacheVariableValue(state, _functionHintsCV);
     if (hasForceFunctions) {
-        Vec3 force(forceFunctions[0].calcValue(timeAsVector), 
-                   forceFunctions[1].calcValue(timeAsVector), 
-                   forceFunctions[2].calcValue(timeAsVector));
+        Vec3 force(forceFunctions[0].calcValue1WithHint(time, hints[0]),
+                   forceFunctions[1].calcValue1WithHint(time, hints[1]),
+                   forceFunctions[2].calcValue1WithHint(time, hints[2]));
         if (!forceIsGlobal)
             force = frame.expressVectorInAnotherFrame(state, force, gnd);
 
         Vec3 point(0); // Default is body origin.
         if (hasPointFunctions) {
             // Calculate point force at a specified point on the body.
-            point = Vec3(pointFunctions[0].calcValue(timeAsVector), 
-                         pointFunctions[1].calcValue(timeAsVector), 
-                         pointFunctions[2].calcValue(timeAsVector));
+            point = Vec3(pointFunctions[0].calcValue1WithHint(time, hints[3]),
+                         pointFunctions[1].calcValue1WithHint(time, hints[4]),
+                         pointFunctions[2].calcValue1WithHint(time, hints[5]));
             if (pointIsGlobal)
                 point = gnd.findStationLocationInAnotherFrame(state, point, frame);
 
@@ -283,9 +292,9 @@ void PrescribedForce::implProduceForces(
         forceConsumer.consumePointForce(state, frame, point, force);
     }
     if (hasTorqueFunctions){
-        Vec3 torque(torqueFunctions[0].calcValue(timeAsVector), 
-                    torqueFunctions[1].calcValue(timeAsVector), 
-                    torqueFunctions[2].calcValue(timeAsVector));
+        Vec3 torque(torqueFunctions[0].calcValue1WithHint(time, hints[6]),
+                    torqueFunctions[1].calcValue1WithHint(time, hints[7]),
+                    torqueFunctions[2].calcValue1WithHint(time, hints[8]));
         if (!forceIsGlobal)
             torque = frame.expressVectorInAnotherFrame(state, torque, gnd);
 
@@ -303,10 +312,9 @@ Vec3 PrescribedForce::getForceAtTime(double aTime) const
     if (forceFunctions.getSize() != 3)
         return Vec3(0);
 
-    const SimTK::Vector timeAsVector(1, aTime);
-    const Vec3 force(forceFunctions[0].calcValue(timeAsVector), 
-                     forceFunctions[1].calcValue(timeAsVector), 
-                     forceFunctions[2].calcValue(timeAsVector));
+    const Vec3 force(forceFunctions[0].calcValue1(aTime), 
+                     forceFunctions[1].calcValue1(aTime), 
+                     forceFunctions[2].calcValue1(aTime));
     return force;
 }
 
@@ -317,10 +325,9 @@ Vec3 PrescribedForce::getPointAtTime(double aTime) const
     if (pointFunctions.getSize() != 3)
         return Vec3(0);
 
-    const SimTK::Vector timeAsVector(1, aTime);
-    const Vec3 point(pointFunctions[0].calcValue(timeAsVector), 
-                     pointFunctions[1].calcValue(timeAsVector), 
-                     pointFunctions[2].calcValue(timeAsVector));
+    const Vec3 point(pointFunctions[0].calcValue1(aTime), 
+                     pointFunctions[1].calcValue1(aTime), 
+                     pointFunctions[2].calcValue1(aTime));
     return point;
 }
 
@@ -331,10 +338,9 @@ Vec3 PrescribedForce::getTorqueAtTime(double aTime) const
     if (torqueFunctions.getSize() != 3)
         return Vec3(0);
 
-    const SimTK::Vector timeAsVector(1, aTime);
-    const Vec3 torque(torqueFunctions[0].calcValue(timeAsVector), 
-                      torqueFunctions[1].calcValue(timeAsVector), 
-                      torqueFunctions[2].calcValue(timeAsVector));
+    const Vec3 torque(torqueFunctions[0].calcValue1(aTime), 
+                      torqueFunctions[1].calcValue1(aTime), 
+                      torqueFunctions[2].calcValue1(aTime));
     return torque;
 }
 
@@ -394,8 +400,6 @@ OpenSim::Array<double> PrescribedForce::getRecordValues(const SimTK::State& stat
     const bool appliesTorque  = torqueFunctions.getSize()==3;
 
     // This is bad as it duplicates the code in `implProduceForces` we'll cleanup after it works!
-    const double time = state.getTime();
-    const SimTK::Vector timeAsVector(1, time);
     const PhysicalFrame& frame =
         getSocket<PhysicalFrame>("frame").getConnectee();
     const Ground& gnd = getModel().getGround();
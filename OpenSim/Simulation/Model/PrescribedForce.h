@@ -27,6 +27,8 @@
 #include <OpenSim/Simulation/Model/Force.h>
 #include <OpenSim/Simulation/Model/ForceProducer.h>
 
+#include <array>
+
 namespace OpenSim {
 
 class Model;
@@ -275,6 +277,8 @@ protected:
         ForceConsumer& consumer
     ) const override;
 
+    void extendAddToSystem(SimTK::MultibodySystem& system) const override;
+
 //==============================================================================
 // DATA
 //==============================================================================
@@ -282,6 +286,11 @@ private:
     void setNull();
     void constructProperties();
 
+    /** The interval of each force, point, and torque function found by the
+    previous evaluation in a State, which is the hint for the next evaluation
+    in that State (see Function::calcValue1WithHint()). **/
+    mutable CacheVariable<std::array<int, 9>> _functionHintsCV;
+
 //=============================================================================
 };  // END of class PrescribedForce
 //=============================================================================
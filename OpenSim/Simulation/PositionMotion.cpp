@@ -43,8 +43,7 @@ public:
             const SimTK::State& s, int nq, SimTK::Real* q) const override {
         if (m_functions.size()) {
             for (int i = 0; i < nq; ++i) {
-                m_funcArgs[0] = s.getTime();
-                q[i] = m_functions[i]->calcValue(m_funcArgs);
+                q[i] = m_functions[i]->calcValue1(s.getTime());
             }
         }
     }
@@ -52,9 +51,7 @@ public:
             const SimTK::State& s, int nq, SimTK::Real* qdot) const override {
         if (m_functions.size()) {
             for (int i = 0; i < nq; ++i) {
-                m_funcArgs[0] = s.getTime();
-                qdot[i] = m_functions[i]->calcDerivative(
-                        m_qdotDerivComponents, m_funcArgs);
+                qdot[i] = m_functions[i]->calcDerivs1(s.getTime(), 1);
             }
         }
     }
@@ -62,25 +59,15 @@ public:
             SimTK::Real* qdotdot) const override {
         if (m_functions.size()) {
             for (int i = 0; i < nq; ++i) {
-                m_funcArgs[0] = s.getTime();
-                qdotdot[i] = m_functions[i]->calcDerivative(
-                        m_qdotdotDerivComponents, m_funcArgs);
+                qdotdot[i] = m_functions[i]->calcDerivs1(s.getTime(), 2);
             }
         }
     }
 
 private:
     std::vector<Function*> m_functions;
-    mutable SimTK::Vector m_funcArgs = SimTK::Vector(1);
-    static const std::vector<int> m_qdotDerivComponents;
-    static const std::vector<int> m_qdotdotDerivComponents;
 };
 
-const std::vector<int>
-        SimTKPositionMotionImplementation::m_qdotDerivComponents = {0};
-const std::vector<int>
-        SimTKPositionMotionImplementation::m_qdotdotDerivComponents = {0, 0};
-
 class SimTKPositionMotion : public SimTK::Motion::Custom {
 public:
     SimTKPositionMotion(SimTK::MobilizedBody& mobod)
@@ -156,15 +143,15 @@ TimeSeriesTable PositionMotion::exportToTable(
         const std::vector<double>& time) const {
     TimeSeriesTable table(time);
     std::vector<std::string> labels;
+    const SimTK::Vector times((int)time.size(), time.data());
     SimTK::Vector value((int)time.size());
     SimTK::Vector speed((int)time.size());
-    SimTK::Vector thisTime(1);
     for (int ifunc = 0; ifunc < get_functions().getSize(); ++ifunc) {
+        const Function& function = get_functions().get(ifunc);
+        function.calcValues(times, value);
+        int hint = 0;
         for (int itime = 0; itime < (int)time.size(); ++itime) {
-            thisTime[0] = time[itime];
-            value[itime] = get_functions().get(ifunc).calcValue(thisTime);
-            speed[itime] = get_functions().get(ifunc).calcDerivative(
-                    std::vector<int>{0}, thisTime);
+            speed[itime] = function.calcDerivs1WithHint(time[itime], 1, hint);
         }
         const std::string& name = get_functions().get(ifunc).getName();
         table.appendColumn(name + "/value", value);
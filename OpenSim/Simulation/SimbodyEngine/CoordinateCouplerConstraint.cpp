@@ -54,6 +54,12 @@ class CompoundFunction : public SimTK::Function {
 private:
     std::unique_ptr<const SimTK::Function> originalFunction;
     const double scaleFactor;
+    // If the original function has a single independent coordinate, a copy
+    // of it is evaluated directly with calcValue1() and calcDerivs1() to
+    // avoid creating a Vector for the independent coordinate on every call.
+    // The copy is owned so that, like originalFunction, it does not change
+    // if the constraint's function property is edited later.
+    std::unique_ptr<const OpenSim::Function> scalarFunction;
 
 public:
 
@@ -61,8 +67,10 @@ public:
      * Default constructor.
      */
     CompoundFunction(const SimTK::Function* originalFunction,
-                     double scaleFactor) :
-            originalFunction(originalFunction), scaleFactor(scaleFactor) {}
+                     double scaleFactor,
+                     OpenSim::Function* scalarFunction = nullptr) :
+            originalFunction(originalFunction), scaleFactor(scaleFactor),
+            scalarFunction(scalarFunction) {}
 
     /**
      * Compute the residual value of the compound function. The value of the
@@ -70,6 +78,9 @@ public:
      * the value of the dependent coordinate.
      */
     double calcValue(const SimTK::Vector& x) const override {
+        if (scalarFunction) {
+            return scaleFactor * scalarFunction->calcValue1(x[0]) - x[1];
+        }
         SimTK::Vector xi = getIndependentVariables(x);
         SimTK::Real xd = getDependentVariable(x);
         return scaleFactor * originalFunction->calcValue(xi) - xd;
@@ -89,6 +100,9 @@ public:
         if (derivComponents.size() == 1) {
             // Derivative with respect to the independent coordinate(s).
             if (derivComponents[0] < N) {
+                if (scalarFunction) {
+                    return scaleFactor * scalarFunction->calcDerivs1(x[0], 1);
+                }
                 SimTK::Vector xi = getIndependentVariables(x);
                 return scaleFactor * originalFunction->calcDerivative(
                                              derivComponents, xi);
@@ -102,6 +116,9 @@ public:
         } else if (derivComponents.size() == 2) {
             // Derivative with respect to the independent coordinate(s).
             if (derivComponents[0] < N && derivComponents[1] < N) {
+                if (scalarFunction) {
+                    return scaleFactor * scalarFunction->calcDerivs1(x[0], 2);
+                }
                 SimTK::Vector xi = getIndependentVariables(x);
                 return scaleFactor *
                        originalFunction->calcDerivative(derivComponents, xi);
@@ -294,7 +311,8 @@ void CoordinateCouplerConstraint::extendAddToSystem(SimTK::MultibodySystem& syst
     // Create and set the underlying coupler constraint function;
     const Function& f = getFunction();
     SimTK::Function *simtkCouplerFunction = new CompoundFunction(
-            f.createSimTKFunction(), get_scale_factor());
+            f.createSimTKFunction(), get_scale_factor(),
+            f.getArgumentSize() == 1 ? f.clone() : nullptr);
 
 
     // Now create a Simbody Constraint::CoordinateCoupler
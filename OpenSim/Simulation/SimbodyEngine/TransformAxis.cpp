@@ -138,6 +138,12 @@ double TransformAxis::getValue(const State& s )
     const int nc = coordNames.size();
     const auto& coords = _joint->getProperty_coordinates();
 
+    if (nc == 1) {
+        const int idx = coords.findIndexForName( coordNames[0] );
+        return getFunction().calcValue1(
+                _joint->get_coordinates(idx).getValue(s));
+    }
+
     Vector workX(nc, 0.0);
     for (int i=0; i < nc; ++i) {
         const int idx = coords.findIndexForName( coordNames[i] );
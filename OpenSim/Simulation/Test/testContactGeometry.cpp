@@ -27,6 +27,7 @@
 //      1. Analytical contact sphere-plane geometry 
 //      2. Mesh-based sphere on analytical plane geometry
 //      3. Intermediate frames are handled correctly.
+//      4. Decimation of contact meshes on load.
 //
 //==============================================================================
 #include <iostream>
@@ -524,6 +525,47 @@ namespace {
     }
 }
 
+TEST_CASE("ContactMesh decimation") {
+    SECTION("Decimation reduces the number of faces") {
+        Model model;
+        auto* mesh = new ContactMesh(mesh_files[0], Vec3(0), Vec3(0),
+                model.getGround(), "mesh");
+        model.addContactGeometry(mesh);
+        model.initSystem();
+        const int numFullFaces = mesh->getNumFaces();
+        Vec3 fullLower, fullUpper;
+        mesh->getBoundingBox(fullLower, fullUpper);
+        CHECK_THAT(fullUpper[1], Catch::Matchers::WithinAbs(radius, 1e-3));
+
+        mesh->setDecimationCellSize(0.02);
+        const int numDecimatedFaces = mesh->getNumFaces();
+        CHECK(numDecimatedFaces < numFullFaces / 4);
+
+        // Clustering moves vertices by at most one cell.
+        Vec3 lower, upper;
+        mesh->getBoundingBox(lower, upper);
+        CHECK_THAT((lower - fullLower).normInf(),
+                Catch::Matchers::WithinAbs(0, 0.02));
+        CHECK_THAT((upper - fullUpper).normInf(),
+                Catch::Matchers::WithinAbs(0, 0.02));
+
+        // The decimation setting is serialized with the model.
+        model.print("ContactMesh_decimation.osim");
+        Model deserialized("ContactMesh_decimation.osim");
+        CHECK(deserialized.getComponent<ContactMesh>("contactgeometryset/mesh")
+                .getDecimationCellSize() == 0.02);
+    }
+
+    SECTION("Negative cell size is rejected") {
+        Model model;
+        auto* mesh = new ContactMesh(mesh_files[0], Vec3(0), Vec3(0),
+                model.getGround(), "mesh");
+        mesh->setDecimationCellSize(-1.0);
+        model.addContactGeometry(mesh);
+        CHECK_THROWS_AS(model.finalizeFromProperties(), OpenSim::Exception);
+    }
+}
+
 TEST_CASE("Bouncing Ball") {
     SECTION("no mesh") {
         testBouncingBall(false);
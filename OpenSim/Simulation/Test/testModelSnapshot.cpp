@@ -0,0 +1,98 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  testModelSnapshot.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/ModelSnapshot.h>
+#include <OpenSim/Common/LoadOpenSimLibrary.h>
+
+#include <catch2/catch_all.hpp>
+
+#include <fstream>
+
+using namespace OpenSim;
+
+TEST_CASE("ModelSnapshot round trip")
+{
+    LoadOpenSimLibrary("osimActuators");
+    for (const std::string fileName :
+            {"arm26.osim", "gait2354_simbody.osim", "double_pendulum.osim"}) {
+        CAPTURE(fileName);
+        Model model(fileName);
+        const std::string snapshotFile = fileName + ".osnap";
+        ModelSnapshot::write(model, snapshotFile);
+        CHECK(ModelSnapshot::isSnapshot(snapshotFile));
+        CHECK_FALSE(ModelSnapshot::isSnapshot(fileName));
+
+        std::unique_ptr<Model> copy = ModelSnapshot::read(snapshotFile);
+        CHECK(*copy == model);
+        CHECK(copy->getInputFileName() == model.getInputFileName());
+        CHECK(copy->isObjectUpToDateWithProperties());
+
+        // The connections are resolved as in the original model.
+        SimTK::State state = model.initSystem();
+        SimTK::State copyState = copy->initSystem();
+        CHECK(copy->getNumStateVariables() == model.getNumStateVariables());
+        CHECK(copyState.getNQ() == state.getNQ());
+        CHECK(copyState.getNU() == state.getNU());
+        CHECK(copyState.getNZ() == state.getNZ());
+        model.realizeDynamics(state);
+        copy->realizeDynamics(copyState);
+        CHECK(copy->getMatterSubsystem().calcSystemMass(copyState) ==
+                model.getMatterSubsystem().calcSystemMass(state));
+        CHECK((copy->getStateVariableValues(copyState) -
+                      model.getStateVariableValues(state)).normInf() == 0);
+    }
+}
+
+TEST_CASE("ModelSnapshot errors")
+{
+    {
+        std::ofstream stream("testModelSnapshot_invalid.osnap",
+                std::ios::binary);
+        stream << "not a snapshot";
+    }
+    CHECK_FALSE(ModelSnapshot::isSnapshot("testModelSnapshot_invalid.osnap"));
+    CHECK_THROWS_WITH(
+            ModelSnapshot::read("testModelSnapshot_invalid.osnap"),
+            Catch::Matchers::ContainsSubstring("is not a model snapshot"));
+    CHECK_THROWS_WITH(ModelSnapshot::read("nonexistent.osnap"),
+            Catch::Matchers::ContainsSubstring("Could not open file"));
+
+    // A truncated snapshot.
+    Model model("arm26.osim");
+    ModelSnapshot::write(model, "testModelSnapshot_arm26.osnap");
+    std::string contents;
+    {
+        std::ifstream stream("testModelSnapshot_arm26.osnap",
+                std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(stream),
+                std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream stream("testModelSnapshot_truncated.osnap",
+                std::ios::binary);
+        stream.write(contents.data(), contents.size() / 2);
+    }
+    CHECK_THROWS_WITH(
+            ModelSnapshot::read("testModelSnapshot_truncated.osnap"),
+            Catch::Matchers::ContainsSubstring("Unexpected end"));
+}
@@ -28,6 +28,7 @@
 #include "Model/Bhargava2004SmoothedMuscleMetabolics.h"
 #include "Model/Model.h"
 #include "Model/ModelVisualizer.h"
+#include "Model/ModelSnapshot.h"
 #include "Model/Force.h"
 #include "Model/ForceAdapter.h"
 #include "Model/ForceApplier.h"
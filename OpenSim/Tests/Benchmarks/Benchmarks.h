@@ -0,0 +1,54 @@
+#ifndef OPENSIM_BENCHMARKS_H_
+#define OPENSIM_BENCHMARKS_H_
+/* -------------------------------------------------------------------------- *
+ *                           OpenSim:  Benchmarks.h                           *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+namespace Benchmarks {
+
+/// A benchmark logs the time taken by one or more approaches to the same
+/// computation, and throws an Exception if their results disagree.
+struct Benchmark {
+    std::string name;
+    std::function<void()> run;
+};
+
+/// The absolute path of a file in the OpenSim source tree, given its path
+/// relative to the root of the source tree (e.g.,
+/// "OpenSim/Simulation/Test/gait2354_simbody.osim").
+std::string getSourceFile(const std::string& path);
+
+/// The mean duration, in seconds, of `numRepetitions` calls to `function`.
+double time(int numRepetitions, const std::function<void()>& function);
+
+std::vector<Benchmark> createCommonBenchmarks();
+std::vector<Benchmark> createSimulationBenchmarks();
+std::vector<Benchmark> createMocoBenchmarks();
+
+} // namespace Benchmarks
+} // namespace OpenSim
+
+#endif // OPENSIM_BENCHMARKS_H_
@@ -0,0 +1,226 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  benchmarkCommon.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "Benchmarks.h"
+
+#include <OpenSim/Common/Exception.h>
+#include <OpenSim/Common/Logger.h>
+#include <OpenSim/Common/PiecewiseLinearFunction.h>
+#include <OpenSim/Common/Signal.h>
+#include <OpenSim/Common/SimmSpline.h>
+#include <OpenSim/Common/Stopwatch.h>
+#include <OpenSim/Common/Storage.h>
+#include <OpenSim/Common/TableResampler.h>
+#include <OpenSim/Common/TableUtilities.h>
+
+#include "SimTKcommon/Testing.h"
+
+using namespace OpenSim;
+
+namespace {
+
+TimeSeriesTable createRandomTable(int numRows, int numColumns, double dt) {
+    std::vector<double> time(numRows);
+    for (int i = 0; i < numRows; ++i) time[i] = i * dt;
+    std::vector<std::string> labels;
+    for (int j = 0; j < numColumns; ++j) labels.push_back(std::to_string(j));
+    SimTK::Matrix data(numRows, numColumns);
+    for (int j = 0; j < numColumns; ++j) {
+        data.updCol(j) = SimTK::Test::randVector(numRows);
+    }
+    return TimeSeriesTable(time, data, labels);
+}
+
+void benchmarkStorage() {
+    const int numRows = 100000;
+    const int numColumns = 50;
+    Stopwatch watch;
+    Array<std::string> labels("", numColumns + 1);
+    labels[0] = "time";
+    for (int j = 0; j < numColumns; ++j) {
+        labels[j + 1] = "c" + std::to_string(j);
+    }
+    Storage sto(numRows);
+    sto.setColumnLabels(labels);
+    SimTK::Vector row(numColumns);
+    for (int i = 0; i < numRows; ++i) {
+        for (int j = 0; j < numColumns; ++j) row[j] = i + 0.001 * j;
+        sto.append(0.01 * i, row);
+    }
+    log_info("Append {} rows: {}", numRows, watch.getElapsedTimeFormatted());
+
+    watch.reset();
+    SimTK::Vector values(numColumns);
+    for (int i = 0; i < numRows; ++i) {
+        sto.getDataAtTime(0.01 * i + 0.003, numColumns, values);
+    }
+    log_info("Interpolate at {} times: {}", numRows,
+            watch.getElapsedTimeFormatted());
+
+    watch.reset();
+    Array<double> column;
+    for (int j = 0; j < numColumns; ++j) sto.getDataColumn(j, column);
+    log_info("Get {} columns: {}", numColumns,
+            watch.getElapsedTimeFormatted());
+
+    watch.reset();
+    const TimeSeriesTable table = sto.exportToTable();
+    log_info("Export to TimeSeriesTable: {}", watch.getElapsedTimeFormatted());
+
+    watch.reset();
+    const Storage fromTable(table);
+    log_info("Convert from TimeSeriesTable: {}",
+            watch.getElapsedTimeFormatted());
+    OPENSIM_THROW_IF(fromTable.getSize() != numRows, Exception,
+            "Expected {} rows, but got {}.", numRows, fromTable.getSize());
+}
+
+void benchmarkPiecewiseFunctions() {
+    const int n = 10000;
+    std::vector<double> x(n), y(n);
+    for (int i = 0; i < n; ++i) {
+        x[i] = 0.001 * i;
+        y[i] = std::sin(x[i]);
+    }
+    const int m = 1000000;
+    SimTK::Vector times(m);
+    for (int i = 0; i < m; ++i) times[i] = x[n - 1] * i / (m - 1);
+
+    SimmSpline spline(n, x.data(), y.data());
+    PiecewiseLinearFunction linear(n, x.data(), y.data());
+    for (const Function* f : std::vector<const Function*>{&spline, &linear}) {
+        SimTK::Vector values;
+        Stopwatch watch;
+        f->calcValues(times, values);
+        log_info("{}: calcValues() at {} increasing times: {}",
+                f->getConcreteClassName(), m, watch.getElapsedTimeFormatted());
+        watch.reset();
+        double sum = 0;
+        for (int i = 0; i < m; ++i) {
+            sum += f->calcValue(SimTK::Vector(1, times[i]));
+        }
+        log_info("{}: calcValue() at {} increasing times: {}",
+                f->getConcreteClassName(), m, watch.getElapsedTimeFormatted());
+        OPENSIM_THROW_IF(std::abs(sum - values.sum()) > 1e-8 * m, Exception,
+                "calcValues() and calcValue() disagree for {}.",
+                f->getConcreteClassName());
+        watch.reset();
+        double sumWithHint = 0;
+        int hint = 0;
+        for (int i = 0; i < m; ++i) {
+            sumWithHint += f->calcValue1WithHint(times[i], hint);
+        }
+        log_info("{}: calcValue1WithHint() at {} increasing times: {}",
+                f->getConcreteClassName(), m, watch.getElapsedTimeFormatted());
+        OPENSIM_THROW_IF(std::abs(sumWithHint - values.sum()) > 1e-8 * m,
+                Exception, "calcValues() and calcValue1WithHint() disagree "
+                "for {}.",
+                f->getConcreteClassName());
+    }
+}
+
+void benchmarkTableFilters() {
+    // 300 channels sampled at 2 kHz for 10 seconds.
+    const int numRows = 20000;
+    const int numColumns = 300;
+    const double dt = 0.0005;
+    const TimeSeriesTable original = createRandomTable(numRows, numColumns, dt);
+    const double numSamples = (double)numRows * numColumns;
+
+    Stopwatch watch;
+    TimeSeriesTable perColumn = original;
+    TableUtilities::pad(perColumn, numRows / 2);
+    const int numPaddedRows = (int)perColumn.getNumRows();
+    SimTK::Vector filtered(numPaddedRows);
+    for (int icol = 0; icol < numColumns; ++icol) {
+        Signal::LowpassIIR(dt, 20.0, numPaddedRows,
+                perColumn.getDependentColumnAtIndex(icol)
+                        .getContiguousScalarData(),
+                filtered.updContiguousScalarData());
+        perColumn.updDependentColumnAtIndex(icol) = filtered;
+    }
+    double elapsed = watch.getElapsedTime();
+    log_info("Signal::LowpassIIR() per column: {:.3f} s ({:.1f} Msamples/s)",
+            elapsed, 1e-6 * numSamples / elapsed);
+
+    const auto benchmark = [&](const std::string& name,
+                                   const std::function<void(TimeSeriesTable&)>&
+                                           filter) {
+        TimeSeriesTable table = original;
+        watch.reset();
+        filter(table);
+        const double elapsed = watch.getElapsedTime();
+        log_info("{}: {:.3f} s ({:.1f} Msamples/s)", name, elapsed,
+                1e-6 * numSamples / elapsed);
+        return table;
+    };
+    const TimeSeriesTable table = benchmark("filterLowpass()",
+            [](TimeSeriesTable& t) {
+                TableUtilities::filterLowpass(t, 20.0, true);
+            });
+    const double value = table.getMatrix().getElt(numRows, numColumns - 1);
+    const double expected =
+            perColumn.getMatrix().getElt(numRows, numColumns - 1);
+    OPENSIM_THROW_IF(std::abs(value - expected) > 1e-10, Exception,
+            "filterLowpass() gave {}, but Signal::LowpassIIR() gave {}.",
+            value, expected);
+    benchmark("filterLowpassFIR()", [](TimeSeriesTable& t) {
+        TableUtilities::filterLowpassFIR(t, 30, 20.0);
+    });
+    benchmark("filterBandpassFIR()", [](TimeSeriesTable& t) {
+        TableUtilities::filterBandpassFIR(t, 30, 20.0, 400.0);
+    });
+}
+
+void benchmarkTableResampler() {
+    const int numRows = 10000;
+    const int numColumns = 100;
+    const TimeSeriesTable table = createRandomTable(numRows, numColumns, 0.001);
+    const double interval = 0.00075;
+
+    Stopwatch watch;
+    TableUtilities::resampleWithInterval(table, interval);
+    log_info("TableUtilities::resampleWithInterval() (GCVSpline): {}",
+            watch.getElapsedTimeFormatted());
+    for (const auto kernel : {TableResampler::Kernel::Linear,
+                 TableResampler::Kernel::NaturalCubic,
+                 TableResampler::Kernel::WindowedSinc}) {
+        watch.reset();
+        const auto resampler = TableResampler::createWithInterval(
+                table.getIndependentColumn(), interval, kernel);
+        const double setup = watch.getElapsedTime();
+        watch.reset();
+        resampler.resample(table);
+        log_info("TableResampler kernel {}: weights {:.4f} s, resample {:.4f} "
+                 "s",
+                (int)kernel, setup, watch.getElapsedTime());
+    }
+}
+
+} // anonymous namespace
+
+std::vector<Benchmarks::Benchmark> Benchmarks::createCommonBenchmarks() {
+    return {{"Storage", benchmarkStorage},
+            {"PiecewiseFunctions", benchmarkPiecewiseFunctions},
+            {"TableUtilities filters", benchmarkTableFilters},
+            {"TableResampler", benchmarkTableResampler}};
+}
@@ -0,0 +1,337 @@
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  benchmarkMoco.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "Benchmarks.h"
+
+#include <OpenSim/Actuators/CoordinateActuator.h>
+#include <OpenSim/Actuators/DeGrooteFregly2016MuscleBatch.h>
+#include <OpenSim/Actuators/ModelOperators.h>
+#include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/Exception.h>
+#include <OpenSim/Common/GCVSplineSet.h>
+#include <OpenSim/Common/Logger.h>
+#include <OpenSim/Common/Stopwatch.h>
+#include <OpenSim/Moco/osimMoco.h>
+#include <OpenSim/Simulation/SimbodyEngine/SliderJoint.h>
+
+#include <fstream>
+
+using namespace OpenSim;
+
+namespace {
+
+/// A trajectory with the size of a gait solution with many muscles.
+MocoTrajectory createLargeTrajectory(
+        int numTimes, int numStates = 400, int numControls = 200) {
+    const SimTK::Vector time = createVectorLinspace(numTimes, 0, 1);
+    SimTK::Matrix states(numTimes, numStates);
+    SimTK::Matrix controls(numTimes, numControls);
+    for (int itime = 0; itime < numTimes; ++itime) {
+        for (int i = 0; i < numStates; ++i) {
+            states(itime, i) = std::sin(time[itime] * (i + 1));
+        }
+        for (int i = 0; i < numControls; ++i) {
+            // Controls are often at a bound.
+            controls(itime, i) = std::max(0.01, std::cos(time[itime] * i));
+        }
+    }
+    std::vector<std::string> stateNames;
+    for (int i = 0; i < numStates; ++i) {
+        stateNames.push_back("/state" + std::to_string(i));
+    }
+    std::vector<std::string> controlNames;
+    for (int i = 0; i < numControls; ++i) {
+        controlNames.push_back("/control" + std::to_string(i));
+    }
+    return MocoTrajectory(time, stateNames, controlNames, {}, {}, states,
+            controls, SimTK::Matrix(numTimes, 0), SimTK::RowVector());
+}
+
+void benchmarkMocoTrajectoryFiles() {
+    const MocoTrajectory trajectory = createLargeTrajectory(501);
+    const auto& controlNames = trajectory.getControlNames();
+
+    const auto fileSize = [](const std::string& fname) {
+        std::ifstream f(fname, std::ios::binary | std::ios::ate);
+        return (long long)f.tellg();
+    };
+    const auto benchmark = [&](const std::string& label,
+                                   const std::string& fname,
+                                   const std::function<void()>& write,
+                                   const std::function<void()>& read) {
+        const double writeTime = Benchmarks::time(1, write);
+        const double readTime = Benchmarks::time(1, read);
+        log_info("{}: {} bytes; write: {:.4f} s; read: {:.4f} s.", label,
+                fileSize(fname), writeTime, readTime);
+    };
+    const std::string sto = "benchmarkOpenSim_trajectory.sto";
+    const std::string binary = "benchmarkOpenSim_trajectory.mocotraj";
+    benchmark("STO", sto, [&]() { trajectory.write(sto); },
+            [&]() { MocoTrajectory t(sto); });
+    benchmark("Binary (uncompressed)", binary,
+            [&]() { trajectory.writeBinary(binary, false); },
+            [&]() { MocoTrajectory::readBinary(binary); });
+    benchmark("Binary (compressed)", binary,
+            [&]() { trajectory.writeBinary(binary); },
+            [&]() { MocoTrajectory::readBinary(binary); });
+    benchmark("Binary (compressed), 10 controls", binary,
+            [&]() { trajectory.writeBinary(binary); },
+            [&]() {
+                MocoTrajectory::readBinary(binary, {"controls"},
+                        {controlNames.begin(), controlNames.begin() + 10});
+            });
+    OPENSIM_THROW_IF(
+            !MocoTrajectory::readBinary(binary).isNumericallyEqual(trajectory),
+            Exception, "The binary file does not match the trajectory.");
+}
+
+void benchmarkMocoTrajectoryResample(
+        int numTimes, int numStates, int numControls) {
+    const MocoTrajectory trajectory =
+            createLargeTrajectory(numTimes, numStates, numControls);
+    const int numNewTimes = (3 * numTimes) / 2;
+
+    Stopwatch watch;
+    const TimeSeriesTable table = trajectory.exportToStatesTable();
+    const GCVSplineSet splines(table, {}, 5);
+    SimTK::Vector curTime(1);
+    for (int itime = 0; itime < numNewTimes; ++itime) {
+        curTime[0] = itime / (numNewTimes - 1.0);
+        for (int i = 0; i < numStates; ++i) splines[i].calcValue(curTime);
+    }
+    log_info("GCVSplineSet for each state: {}",
+            watch.getElapsedTimeFormatted());
+
+    watch.reset();
+    MocoTrajectory resampled = trajectory;
+    resampled.resampleWithNumTimes(numNewTimes);
+    log_info("resampleWithNumTimes(): {}", watch.getElapsedTimeFormatted());
+
+    watch.reset();
+    trajectory.compareContinuousVariablesRMS(trajectory);
+    log_info("compareContinuousVariablesRMS(), same times: {}",
+            watch.getElapsedTimeFormatted());
+
+    watch.reset();
+    const double rms = trajectory.compareContinuousVariablesRMS(resampled);
+    log_info("compareContinuousVariablesRMS(), different times: {}",
+            watch.getElapsedTimeFormatted());
+    OPENSIM_THROW_IF(rms > 1e-3, Exception,
+            "Expected the resampled trajectory to match, but the RMS error "
+            "is {}.",
+            rms);
+}
+
+void benchmarkDeGrooteFregly2016MuscleBatch() {
+    const std::string fileName = Benchmarks::getSourceFile(
+            "OpenSim/Moco/Test/subject_walk_armless_18musc.osim");
+    Model model = (ModelProcessor(fileName) |
+                   ModOpReplaceMusclesWithDeGrooteFregly2016() |
+                   ModOpTendonComplianceDynamicsModeDGF("implicit"))
+                          .process();
+    model.initSystem();
+    DeGrooteFregly2016MuscleBatch batch(model);
+
+    // Mimic the dynamics evaluations in a direct collocation problem: each
+    // evaluation perturbs the coordinates and invalidates the caches.
+    SimTK::State state = model.getWorkingState();
+    const SimTK::Vector q = state.getQ();
+    const int numEvaluations = 20000;
+    const auto evaluate = [&](bool useBatch) {
+        int i = 0;
+        return Benchmarks::time(numEvaluations, [&]() {
+            state.updQ() = q;
+            state.updQ()[i++ % q.size()] += 1e-6;
+            model.realizeVelocity(state);
+            if (useBatch) batch.calcMuscleInfos(state);
+            model.realizeAcceleration(state);
+        });
+    };
+    log_info("{} muscles, per-muscle evaluation: {:.2f} us per "
+             "realizeAcceleration",
+            batch.getNumMuscles(), 1e6 * evaluate(false));
+    log_info("{} muscles, batched evaluation: {:.2f} us per "
+             "realizeAcceleration",
+            batch.getNumMuscles(), 1e6 * evaluate(true));
+}
+
+void benchmarkMarkerTracking() {
+    // Track the 39 markers in the model and 10 additional markers. The marker
+    // trajectories oscillate about the markers' locations in the default pose.
+    Model model(Benchmarks::getSourceFile(
+            "OpenSim/Moco/Test/walk_gait1018_subject01.osim"));
+    const auto& bodies = model.getBodySet();
+    for (int i = 0; i < 10; ++i) {
+        model.addMarker(new Marker(fmt::format("extra{}", i),
+                bodies.get(i % bodies.getSize()),
+                SimTK::Vec3(0.01 * i, 0.02, 0)));
+    }
+    SimTK::State state = model.initSystem();
+    model.realizePosition(state);
+    const auto& markerSet = model.getMarkerSet();
+    std::vector<double> time;
+    SimTK::Matrix_<SimTK::Vec3> locations(101, markerSet.getSize());
+    std::vector<std::string> labels;
+    for (int j = 0; j < markerSet.getSize(); ++j) {
+        labels.push_back(markerSet.get(j).getName());
+    }
+    for (int i = 0; i < 101; ++i) {
+        time.push_back(0.5 + 0.005 * i);
+        for (int j = 0; j < markerSet.getSize(); ++j) {
+            locations(i, j) = markerSet.get(j).getLocationInGround(state) +
+                    SimTK::Vec3(0.01 * std::sin(10 * time.back() + j));
+        }
+    }
+    TimeSeriesTableVec3 markers(time, locations, labels);
+
+    MocoTrack track;
+    track.setModel(ModelProcessor(model) | ModOpRemoveMuscles() |
+            ModOpAddReserves(100));
+    TimeSeriesTable markersFlat(markers.flatten());
+    track.setMarkersReference(TableProcessor(markersFlat));
+    track.set_initial_time(0.5);
+    track.set_final_time(1.0);
+    MocoStudy study = track.initialize();
+    MocoProblemRep rep = study.getProblem().createRep();
+    const auto& goal = rep.getCost("marker_tracking");
+
+    // Evaluate the integrand at the grid points of a Hermite-Simpson
+    // transcription with 100 mesh intervals.
+    std::vector<double> grid;
+    for (int i = 0; i < 201; ++i) { grid.push_back(0.5 + 0.0025 * i); }
+    SimTK::State repState =
+            rep.getModelDisabledConstraints().getWorkingState();
+    const SimTK::Vector controls;
+    double sum = 0;
+    const auto evaluate = [&]() {
+        return Benchmarks::time(100, [&]() {
+            sum = 0;
+            for (const double t : grid) {
+                repState.setTime(t);
+                sum += goal.calcIntegrand({t, repState, controls});
+            }
+        });
+    };
+    log_info("{} markers, integrand from splines: {:.3f} ms per pass",
+            markerSet.getSize(), 1000 * evaluate());
+    const double splineSum = sum;
+    goal.initializeOnGrid(grid);
+    log_info("{} markers, integrand precomputed on the grid: {:.3f} ms per "
+             "pass",
+            markerSet.getSize(), 1000 * evaluate());
+    OPENSIM_THROW_IF(std::abs(sum - splineSum) > 1e-8 * std::abs(splineSum),
+            Exception, "The integrands disagree: {} vs. {}.", sum, splineSum);
+}
+
+#ifdef OPENSIM_WITH_CASADI
+MocoStudy createSlidingMassStudy() {
+    auto model = make_unique<Model>();
+    model->setName("sliding_mass");
+    model->set_gravity(SimTK::Vec3(0, 0, 0));
+    auto* body = new Body("body", 10.0, SimTK::Vec3(0), SimTK::Inertia(0));
+    model->addComponent(body);
+    auto* joint = new SliderJoint("slider", model->getGround(), *body);
+    auto& coord = joint->updCoordinate(SliderJoint::Coord::TranslationX);
+    coord.setName("position");
+    model->addComponent(joint);
+    auto* actu = new CoordinateActuator();
+    actu->setCoordinate(&coord);
+    actu->setName("actuator");
+    actu->setOptimalForce(1);
+    actu->setMinControl(-10);
+    actu->setMaxControl(10);
+    model->addComponent(actu);
+
+    MocoStudy study;
+    MocoProblem& problem = study.updProblem();
+    problem.setModel(std::move(model));
+    problem.setTimeBounds(MocoInitialBounds(0), MocoFinalBounds(0, 10));
+    problem.setStateInfo("/slider/position/value", {0, 1}, 0, 1);
+    problem.setStateInfo("/slider/position/speed", {-100, 100}, 0, 0);
+    problem.addGoal<MocoFinalTimeGoal>();
+    problem.addGoal<MocoControlGoal>("effort");
+    auto& solver = study.initCasADiSolver();
+    solver.set_num_mesh_intervals(100);
+    solver.set_transcription_scheme("hermite-simpson");
+    solver.set_enforce_constraint_derivatives(false);
+    solver.set_verbosity(0);
+    return study;
+}
+
+void benchmarkMocoCasADiSession() {
+    // Solve the same problem with several effort weights, each time starting
+    // from the previous solution, so that the difference between the two
+    // approaches is the setup (transcription and creating the NLP solver).
+    const std::vector<double> weights = {0.1, 0.2, 0.5, 1.0, 2.0};
+    MocoStudy study = createSlidingMassStudy();
+    auto& solver = study.updSolver<MocoCasADiSolver>();
+
+    Stopwatch watch;
+    MocoSolution solution;
+    for (const double weight : weights) {
+        study.updProblem().updGoal("effort").setWeight(weight);
+        if (!solution.empty()) { solver.setGuess(solution); }
+        solution = study.solve();
+    }
+    log_info("MocoStudy::solve(), {} weights: {}", weights.size(),
+            watch.getElapsedTimeFormatted());
+    const double expected = solution.getObjective();
+
+    study.updProblem().updGoal("effort").setWeight(weights[0]);
+    solver.clearGuess();
+    watch.reset();
+    MocoCasADiSession session(solver);
+    for (const double weight : weights) {
+        session.setCostWeight("effort", weight);
+        Stopwatch solveWatch;
+        solution = session.solve();
+        log_info("MocoCasADiSession solve {}: {}", session.getNumSolves(),
+                solveWatch.getElapsedTimeFormatted());
+    }
+    log_info("MocoCasADiSession, {} weights: {}", weights.size(),
+            watch.getElapsedTimeFormatted());
+    OPENSIM_THROW_IF(
+            std::abs(solution.getObjective() - expected) > 1e-4 * expected,
+            Exception, "The objectives disagree: {} vs. {}.",
+            solution.getObjective(), expected);
+}
+#endif
+
+} // anonymous namespace
+
+std::vector<Benchmarks::Benchmark> Benchmarks::createMocoBenchmarks() {
+    return {{"MocoTrajectory files", benchmarkMocoTrajectoryFiles},
+            // More columns than times: the quintic spline kernel is shared
+            // by all columns.
+            {"MocoTrajectory resample and compare",
+                    [] { benchmarkMocoTrajectoryResample(201, 400, 200); }},
+            // Fewer columns than times: each column gets its own spline.
+            {"MocoTrajectory resample and compare, few columns",
+                    [] { benchmarkMocoTrajectoryResample(2001, 10, 5); }},
+            {"DeGrooteFregly2016MuscleBatch",
+                    benchmarkDeGrooteFregly2016MuscleBatch},
+            {"MocoTrack marker tracking", benchmarkMarkerTracking},
+#ifdef OPENSIM_WITH_CASADI
+            {"MocoCasADiSession", benchmarkMocoCasADiSession},
+#endif
+    };
+}
@@ -0,0 +1,109 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  benchmarkOpenSim.cpp                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "Benchmarks.h"
+
+#include <OpenSim/Common/Logger.h>
+#include <OpenSim/Common/Stopwatch.h>
+
+#include <algorithm>
+#include <iostream>
+
+using namespace OpenSim;
+
+static const char HELP[] =
+R"(Time the performance-critical code paths of OpenSim.
+
+Usage:
+  benchmarkOpenSim [--list] [<name>...]
+  benchmarkOpenSim -h | --help
+
+Runs the benchmarks whose names contain any of the given <name>s, or all
+benchmarks if no names are given. Each benchmark logs its timings, and fails
+if the approaches it compares give different results. With --list, the names
+of the benchmarks are printed instead.
+
+Examples:
+  benchmarkOpenSim --list
+  benchmarkOpenSim Storage MocoTrajectory
+)";
+
+std::string Benchmarks::getSourceFile(const std::string& path) {
+    return std::string(OPENSIM_BENCHMARKS_SOURCE_DIR) + "/" + path;
+}
+
+double Benchmarks::time(
+        int numRepetitions, const std::function<void()>& function) {
+    Stopwatch watch;
+    for (int i = 0; i < numRepetitions; ++i) { function(); }
+    return watch.getElapsedTime() / numRepetitions;
+}
+
+int main(int argc, const char** argv) {
+    std::vector<Benchmarks::Benchmark> benchmarks;
+    for (const auto& group : {Benchmarks::createCommonBenchmarks(),
+                 Benchmarks::createSimulationBenchmarks(),
+                 Benchmarks::createMocoBenchmarks()}) {
+        benchmarks.insert(benchmarks.end(), group.begin(), group.end());
+    }
+
+    bool list = false;
+    std::vector<std::string> names;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            std::cout << HELP << std::endl;
+            return EXIT_SUCCESS;
+        } else if (arg == "--list") {
+            list = true;
+        } else {
+            names.push_back(arg);
+        }
+    }
+
+    int numFailed = 0;
+    for (const auto& benchmark : benchmarks) {
+        if (!names.empty() &&
+                std::none_of(names.begin(), names.end(),
+                        [&](const std::string& name) {
+                            return benchmark.name.find(name) !=
+                                   std::string::npos;
+                        })) {
+            continue;
+        }
+        if (list) {
+            std::cout << benchmark.name << std::endl;
+            continue;
+        }
+        log_info("{}", benchmark.name);
+        log_info("{}", std::string(benchmark.name.size(), '-'));
+        try {
+            Stopwatch watch;
+            benchmark.run();
+            log_info("Finished in {}.\n", watch.getElapsedTimeFormatted());
+        } catch (const std::exception& e) {
+            log_error("{} failed: {}\n", benchmark.name, e.what());
+            ++numFailed;
+        }
+    }
+    return numFailed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,366 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  benchmarkSimulation.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2026 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "Benchmarks.h"
+
+#include <OpenSim/Actuators/CoordinateActuator.h>
+#include <OpenSim/Actuators/Millard2012EquilibriumMuscle.h>
+#include <OpenSim/Common/Constant.h>
+#include <OpenSim/Common/Exception.h>
+#include <OpenSim/Common/GCVSpline.h>
+#include <OpenSim/Common/LinearFunction.h>
+#include <OpenSim/Common/Logger.h>
+#include <OpenSim/Common/PiecewiseLinearFunction.h>
+#include <OpenSim/Common/SimmSpline.h>
+#include <OpenSim/Common/Stopwatch.h>
+#include <OpenSim/Simulation/Control/PrescribedController.h>
+#include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Simulation/Model/ContactMesh.h>
+#include <OpenSim/Simulation/Model/ElasticFoundationForce.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/ModelSnapshot.h>
+#include <OpenSim/Simulation/Model/PrescribedForce.h>
+#include <OpenSim/Simulation/SimbodyEngine/CoordinateCouplerConstraint.h>
+#include <OpenSim/Simulation/SimbodyEngine/CustomJoint.h>
+#include <OpenSim/Simulation/SimbodyEngine/FreeJoint.h>
+#include <OpenSim/Simulation/SimbodyEngine/SliderJoint.h>
+
+using namespace OpenSim;
+
+namespace {
+
+const std::string gait2354 = "OpenSim/Simulation/Test/gait2354_simbody.osim";
+
+Model createMillard2012EquilibriumMuscleModel(int numMuscles) {
+    Model model;
+    for (int i = 0; i < numMuscles; ++i) {
+        const double optimalFiberLength = 0.05 + 0.1 * (i % 7) / 7.0;
+        const double tendonSlackLength = 0.1 + 0.3 * (i % 11) / 11.0;
+        const double pennationAngle = 0.3 * (i % 5) / 5.0;
+        auto* muscle = new Millard2012EquilibriumMuscle("muscle" +
+                std::to_string(i), 100.0 + 10.0 * i, optimalFiberLength,
+                tendonSlackLength, pennationAngle);
+        muscle->set_default_activation(0.05 + 0.9 * (i % 13) / 13.0);
+        const double length = (optimalFiberLength + tendonSlackLength) *
+                              (0.9 + 0.3 * (i % 17) / 17.0);
+        muscle->addNewPathPoint("p1", model.updGround(), SimTK::Vec3(0));
+        muscle->addNewPathPoint("p2", model.updGround(),
+                SimTK::Vec3(0, 0, length));
+        model.addForce(muscle);
+    }
+    return model;
+}
+
+void benchmarkCustomJointRealizePosition() {
+    // A knee whose rotations and translations are splines of the flexion
+    // angle, with the anterior translation also enforced by a coupler.
+    Model model;
+    auto* shank = new OpenSim::Body("shank", 3.51, SimTK::Vec3(0),
+            SimTK::Inertia(0.0477, 0.0048, 0.0484));
+    model.addBody(shank);
+
+    const double x[] = {-2.0, -1.5, -1.0, -0.5, 0.0, 0.5};
+    const double y[] = {0.0, 0.02, 0.05, 0.04, 0.01, 0.0};
+    const int n = 6;
+    SpatialTransform kneeTransform;
+    const Array<std::string> flexion("knee_angle", 1, 1);
+    kneeTransform[0].setCoordinateNames(flexion);
+    kneeTransform[0].setFunction(new SimmSpline(n, x, y));
+    kneeTransform[1].setCoordinateNames(flexion);
+    kneeTransform[1].setFunction(new SimmSpline(n, x, y));
+    kneeTransform[2].setCoordinateNames(flexion);
+    kneeTransform[2].setFunction(new LinearFunction());
+    kneeTransform[3].setCoordinateNames(Array<std::string>("knee_tx", 1, 1));
+    kneeTransform[3].setFunction(new LinearFunction());
+    kneeTransform[4].setCoordinateNames(flexion);
+    kneeTransform[4].setFunction(new SimmSpline(n, x, y));
+    kneeTransform[5].setCoordinateNames(flexion);
+    kneeTransform[5].setFunction(new SimmSpline(n, x, y));
+    auto* knee = new CustomJoint("knee", model.getGround(), *shank,
+            kneeTransform);
+    model.addJoint(knee);
+
+    auto* coupler = new CoordinateCouplerConstraint();
+    coupler->setName("knee_tx_coupler");
+    coupler->setIndependentCoordinateNames(flexion);
+    coupler->setDependentCoordinateName("knee_tx");
+    coupler->setFunction(SimmSpline(n, x, y));
+    model.addConstraint(coupler);
+
+    SimTK::State state = model.initSystem();
+    const auto& angle = model.getCoordinateSet().get("knee_angle");
+    const int numEvals = 100000;
+    Stopwatch watch;
+    for (int i = 0; i < numEvals; ++i) {
+        angle.setValue(state, -2.0 + 2.5 * i / numEvals, false);
+        model.realizePosition(state);
+    }
+    log_info("realizePosition() for a spline knee with a coupler: {} for {} "
+             "evaluations.",
+            watch.getElapsedTimeFormatted(), numEvals);
+}
+
+// Drop a mesh sphere onto a fixed mesh sphere, with both meshes decimated
+// using the provided cell size. Returns the final height of the ball.
+double simulateMeshOnMesh(double decimationCellSize) {
+    const double radius = 0.1;
+    const std::string meshFile = Benchmarks::getSourceFile(
+            "OpenSim/Simulation/Test/sphere_10cm_radius.obj");
+    Model model;
+    auto* ball = new OpenSim::Body("ball", 1.0, SimTK::Vec3(0),
+            SimTK::Inertia(1.0));
+    model.addBody(ball);
+    model.addJoint(new FreeJoint("free", model.getGround(), *ball));
+
+    auto* ball1 = new ContactMesh(meshFile, SimTK::Vec3(0), SimTK::Vec3(0),
+            model.getGround(), "ball1");
+    ball1->setDecimationCellSize(decimationCellSize);
+    auto* ball2 = new ContactMesh(meshFile, SimTK::Vec3(0), SimTK::Vec3(0),
+            *ball, "ball2");
+    ball2->setDecimationCellSize(decimationCellSize);
+    model.addContactGeometry(ball1);
+    model.addContactGeometry(ball2);
+
+    auto* contactParams = new ElasticFoundationForce::ContactParameters(
+            1.0e6 / (2 * radius), 0.001, 0.0, 0.0, 0.0);
+    contactParams->addGeometry("ball1");
+    contactParams->addGeometry("ball2");
+    model.addForce(new ElasticFoundationForce(contactParams));
+    model.setGravity(SimTK::Vec3(0, -9.8065, 0));
+
+    SimTK::State& state = model.initSystem();
+    state.updQ()[4] = 2.5 * radius;
+    Manager manager(model);
+    manager.setIntegratorAccuracy(1e-5);
+    manager.initialize(state);
+    state = manager.integrate(0.5);
+    model.realizePosition(state);
+    return ball->getPositionInGround(state)[1];
+}
+
+void benchmarkContactMeshDecimation() {
+    for (double cellSize : {0.0, 0.005, 0.01, 0.02}) {
+        Stopwatch watch;
+        const double height = simulateMeshOnMesh(cellSize);
+        log_info("Mesh-on-mesh contact with decimation cell size {}: {} "
+                 "(final height: {})",
+                cellSize, watch.getElapsedTimeFormatted(), height);
+    }
+}
+
+void benchmarkModelCopy() {
+    Model model(Benchmarks::getSourceFile(gait2354));
+    // The same model with the splines of the CustomJoints (e.g., the knee)
+    // replaced by GCVSplines through the same points, whose fits are shared
+    // by copies of the model.
+    Model gcvModel(model);
+    for (auto& joint : gcvModel.updComponentList<CustomJoint>()) {
+        for (int i = 0; i < 6; ++i) {
+            TransformAxis& axis = joint.updSpatialTransform()[i];
+            if (!axis.hasFunction()) continue;
+            const auto* spline =
+                    dynamic_cast<const SimmSpline*>(&axis.get_function());
+            // A quintic GCVSpline requires at least 6 points.
+            if (!spline || spline->getSize() < 6) continue;
+            axis.setFunction(new GCVSpline(5, spline->getSize(),
+                    spline->getXValues(), spline->getYValues()));
+        }
+    }
+
+    const int numCopies = 20;
+    for (Model* original : {&model, &gcvModel}) {
+        original->initSystem();
+        double copyTime = 0;
+        double totalTime = 0;
+        for (int i = 0; i < numCopies; ++i) {
+            Stopwatch watch;
+            std::unique_ptr<Model> copy(original->clone());
+            copyTime += watch.getElapsedTime();
+            copy->initSystem();
+            totalTime += watch.getElapsedTime();
+        }
+        log_info("{}: {} copies: clone(): {:.4f} s; clone() + initSystem(): "
+                 "{:.4f} s.",
+                original == &model ? "SimmSpline" : "GCVSpline", numCopies,
+                copyTime, totalTime);
+    }
+}
+
+void benchmarkModelSnapshot() {
+    const std::string fileName = Benchmarks::getSourceFile(gait2354);
+    const std::string snapshotFile = "benchmarkOpenSim_gait2354.osnap";
+    ModelSnapshot::write(Model(fileName), snapshotFile);
+
+    const int numLoads = 20;
+    const double xmlTime = Benchmarks::time(numLoads,
+            [&]() { Model model(fileName); });
+    const double snapshotTime = Benchmarks::time(numLoads,
+            [&]() { ModelSnapshot::read(snapshotFile); });
+    log_info("Load: .osim file: {:.4f} s; snapshot: {:.4f} s.", xmlTime,
+            snapshotTime);
+}
+
+void benchmarkXMLDeserialization() {
+    const int numMuscles = 2000;
+    const std::string fileName = "benchmarkOpenSim_muscles.osim";
+    createMillard2012EquilibriumMuscleModel(numMuscles).print(fileName);
+
+    const int numReads = 5;
+    const double time = Benchmarks::time(numReads, [&]() {
+        std::unique_ptr<Object> model(Object::makeObjectFromFile(fileName));
+        const int numForces =
+                dynamic_cast<const Model&>(*model).getForceSet().getSize();
+        OPENSIM_THROW_IF(numForces != numMuscles, Exception,
+                "Expected {} muscles, but read {}.", numMuscles, numForces);
+    });
+    log_info("Read a model with {} muscles in {:.4f} s ({:.0f} muscles/s).",
+            numMuscles, time, numMuscles / time);
+}
+
+void benchmarkMuscleEquilibria() {
+    Model model = createMillard2012EquilibriumMuscleModel(300);
+    const SimTK::State& state = model.initSystem();
+    std::vector<const Muscle*> muscles;
+    for (const auto& muscle : model.getComponentList<Muscle>()) {
+        muscles.push_back(&muscle);
+    }
+    const int numRepetitions = 100;
+
+    SimTK::State perMuscle = state;
+    const double perMuscleTime = Benchmarks::time(numRepetitions, [&]() {
+        for (const auto* muscle : muscles) {
+            muscle->computeEquilibrium(perMuscle);
+        }
+    });
+    log_info("Per-muscle equilibrium of {} muscles: {:.3f} ms",
+            muscles.size(), 1000 * perMuscleTime);
+
+    SimTK::State batched = state;
+    const double batchedTime = Benchmarks::time(numRepetitions, [&]() {
+        muscles.front()->computeEquilibria(batched, muscles);
+    });
+    log_info("Batched equilibrium of {} muscles: {:.3f} ms",
+            muscles.size(), 1000 * batchedTime);
+
+    model.realizeVelocity(perMuscle);
+    model.realizeVelocity(batched);
+    for (const auto* muscle : muscles) {
+        const double expected = muscle->getFiberLength(perMuscle);
+        OPENSIM_THROW_IF(std::abs(muscle->getFiberLength(batched) - expected) >
+                                 1e-12 * expected,
+                Exception, "The fiber lengths of {} disagree.",
+                muscle->getName());
+    }
+}
+
+// A block on a slider with a control and a force prescribed by functions
+// with numPoints knots over the given duration: a SimmSpline of cos(t) for
+// the control of a CoordinateActuator and a PiecewiseLinearFunction of sin(t)
+// for the x component of a PrescribedForce.
+Model createLongPrescribedTrajectoryModel(int numPoints, double duration) {
+    std::vector<double> time(numPoints), control(numPoints), force(numPoints);
+    for (int i = 0; i < numPoints; ++i) {
+        time[i] = duration * i / (numPoints - 1);
+        control[i] = std::cos(time[i]);
+        force[i] = std::sin(time[i]);
+    }
+    Model model;
+    auto* block = new OpenSim::Body("block", 1.0, SimTK::Vec3(0),
+            SimTK::Inertia(1.0));
+    model.addBody(block);
+    auto* slider = new SliderJoint("slider", model.getGround(), *block);
+    model.addJoint(slider);
+
+    auto* actuator = new CoordinateActuator();
+    actuator->setName("actuator");
+    actuator->setCoordinate(&slider->updCoordinate());
+    actuator->setOptimalForce(1.0);
+    model.addForce(actuator);
+    auto* controller = new PrescribedController();
+    controller->addActuator(*actuator);
+    controller->prescribeControlForActuator("actuator",
+            SimmSpline(numPoints, time.data(), control.data()));
+    model.addController(controller);
+
+    auto* prescribed = new PrescribedForce("prescribed", *block);
+    prescribed->setForceFunctions(
+            new PiecewiseLinearFunction(numPoints, time.data(), force.data()),
+            new Constant(0), new Constant(0));
+    model.addForce(prescribed);
+    return model;
+}
+
+void benchmarkLongPrescribedTrajectories() {
+    // Evaluate the prescribed control and force at increasing times, as in a
+    // simulation. The cost per evaluation should not depend on the number of
+    // knots, since each State holds the interval of the previous evaluation.
+    const double duration = 100.0;
+    const int numEvals = 200000;
+    for (int numPoints : {101, 10001, 1000001}) {
+        Model model = createLongPrescribedTrajectoryModel(numPoints, duration);
+        SimTK::State state = model.initSystem();
+        const auto& actuator =
+                model.getComponent<CoordinateActuator>("/forceset/actuator");
+        Stopwatch watch;
+        double maxError = 0;
+        for (int i = 0; i < numEvals; ++i) {
+            state.setTime(duration * i / (numEvals - 1));
+            model.realizeDynamics(state);
+            maxError = std::max(maxError,
+                    std::abs(actuator.getActuation(state) -
+                             std::cos(state.getTime())));
+        }
+        log_info("{} knots: realizeDynamics() at {} increasing times: {}",
+                numPoints, numEvals, watch.getElapsedTimeFormatted());
+        OPENSIM_THROW_IF(maxError > 1e-2, Exception,
+                "Expected the control to follow cos(t), but the max. error is "
+                "{}.",
+                maxError);
+    }
+
+    // Simulating a long motion evaluates the functions at nearby times.
+    for (int numPoints : {101, 1000001}) {
+        Model model = createLongPrescribedTrajectoryModel(numPoints, duration);
+        SimTK::State state = model.initSystem();
+        Stopwatch watch;
+        Manager manager(model);
+        manager.initialize(state);
+        state = manager.integrate(duration);
+        log_info("{} knots: simulate {} s: {}", numPoints, duration,
+                watch.getElapsedTimeFormatted());
+    }
+}
+
+} // anonymous namespace
+
+std::vector<Benchmarks::Benchmark> Benchmarks::createSimulationBenchmarks() {
+    return {{"CustomJoint realizePosition",
+                    benchmarkCustomJointRealizePosition},
+            {"ContactMesh decimation", benchmarkContactMeshDecimation},
+            {"Model copy and initSystem", benchmarkModelCopy},
+            {"ModelSnapshot load", benchmarkModelSnapshot},
+            {"XML deserialization", benchmarkXMLDeserialization},
+            {"Millard2012EquilibriumMuscle equilibria",
+                    benchmarkMuscleEquilibria},
+            {"Long prescribed trajectories",
+                    benchmarkLongPrescribedTrajectories}};
+}
@@ -22,6 +22,7 @@
 #include <OpenSim/Common/XMLDocument.h>
 #include "AnalyzeTool.h"
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/Instrumentation.h>
 #include <OpenSim/Common/GCVSplineSet.h>
 
 #include <OpenSim/Simulation/Control/ControlLinear.h>
@@ -35,6 +36,11 @@
 #include <OpenSim/Simulation/Model/PrescribedForce.h>
 #include <OpenSim/Actuators/Thelen2003Muscle.h>
 
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <thread>
+
 using namespace OpenSim;
 using namespace std;
 
@@ -59,6 +65,7 @@ AnalyzeTool::AnalyzeTool() :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _numThreads(_numThreadsProp.getValueInt()),
     _printResultFiles(true),
     _loadModelAndInput(false)
 {
@@ -79,6 +86,7 @@ AnalyzeTool::AnalyzeTool(const string &aFileName, bool aLoadModelAndInput) :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _numThreads(_numThreadsProp.getValueInt()),
     _printResultFiles(true),
     _loadModelAndInput(aLoadModelAndInput)
 {
@@ -111,6 +119,7 @@ AnalyzeTool::AnalyzeTool(Model& aModel) :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _numThreads(_numThreadsProp.getValueInt()),
     _printResultFiles(true),
     _loadModelAndInput(false)
 {
@@ -171,6 +180,7 @@ AnalyzeTool(const AnalyzeTool &aTool) :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _numThreads(_numThreadsProp.getValueInt()),
     _loadModelAndInput(false)
 {
     setNull();
@@ -191,6 +201,7 @@ setNull()
     _coordinatesFileName = "";
     _speedsFileName = "";
     _lowpassCutoffFrequency = -1.0;
+    _numThreads = 1;
 
     _statesStore = NULL;
 
@@ -236,6 +247,15 @@ void AnalyzeTool::setupProperties()
     _lowpassCutoffFrequencyProp.setName("lowpass_cutoff_frequency_for_coordinates");
     _propertySet.append( &_lowpassCutoffFrequencyProp );
 
+    comment = "Number of threads used to run the analyses. If greater than 1 and "
+                 "all analyses are frame-independent (e.g., BodyKinematics, "
+                 "JointReaction, Kinematics, MuscleAnalysis), the frames are divided "
+                 "among copies of the model and analyzed in parallel. Otherwise, the "
+                 "frames are analyzed in order. The default value is 1.";
+    _numThreadsProp.setComment(comment);
+    _numThreadsProp.setName("num_threads");
+    _propertySet.append( &_numThreadsProp );
+
 }
 
 
@@ -259,6 +279,7 @@ operator=(const AnalyzeTool &aTool)
     _coordinatesFileName = aTool._coordinatesFileName;
     _speedsFileName = aTool._speedsFileName;
     _lowpassCutoffFrequency= aTool._lowpassCutoffFrequency;
+    _numThreads = aTool._numThreads;
     _statesStore = aTool._statesStore;
     _printResultFiles = aTool._printResultFiles;
     return(*this);
@@ -590,7 +611,7 @@ bool AnalyzeTool::run(bool plotting)
     //}
 
     log_info("Executing the analyses from {} to {}...", ti, tf);
-    run(s, *_model, iInitial, iFinal, *_statesStore, _solveForEquilibriumForAuxiliaryStates);
+    run(s, *_model, iInitial, iFinal, *_statesStore, _solveForEquilibriumForAuxiliaryStates, _numThreads);
     _model->getMultibodySystem().realize(s, SimTK::Stage::Position );
     } catch (const Exception& x) {
         x.print(cout);
@@ -613,15 +634,17 @@ bool AnalyzeTool::run(bool plotting)
 //=============================================================================
 // HELPER
 //=============================================================================
-void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium)
+namespace {
+// When the frames are divided among threads, each part has at least this many
+// frames.
+constexpr int minFramesPerThread = 10;
+
+// Analyze frames iFirst to iLast of the states storage. The analyses begin at
+// iFirst and end at iFinal (if iFinal <= iLast); the other frames are steps.
+void runFrames(SimTK::State& s, Model &aModel, int iFirst, int iLast, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium)
 {
     AnalysisSet& analysisSet = aModel.updAnalysisSet();
 
-    for(int i=0;i<analysisSet.getSize();i++) {
-        analysisSet.get(i).setStatesStore(aStatesStore);
-    }
-
-
     // PERFORM THE ANALYSES
     double /*tPrev=0.0,*/t=0.0/*,dt=0.0*/;
     int ny = s.getNY();
@@ -663,7 +686,8 @@ void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal,
     // model defaults.
     SimTK::Vector stateValues = aModel.getStateVariableValues(s);
 
-    for(int i=iInitial;i<=iFinal;i++) {
+    for(int i=iFirst;i<=iLast;i++) {
+        OPENSIM_INSTRUMENT_SCOPE("AnalyzeTool::frame");
         // tPrev = t;
         aStatesStore.getTime(i,s.updTime()); // time
         t = s.getTime();
@@ -697,7 +721,7 @@ void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal,
         // Make sure model is at least ready to provide kinematics
         aModel.getMultibodySystem().realize(s, SimTK::Stage::Velocity);
 
-        if(i==iInitial) {
+        if(i==iFirst) {
             analysisSet.begin(s);
         } else if(i==iFinal) {
             analysisSet.end(s);
@@ -707,3 +731,98 @@ void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal,
         }
     }
 }
+} // namespace
+
+void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium)
+{
+    run(s, aModel, iInitial, iFinal, aStatesStore, aSolveForEquilibrium, 1);
+}
+
+void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium, int aNumThreads)
+{
+    AnalysisSet& analysisSet = aModel.updAnalysisSet();
+
+    for(int i=0;i<analysisSet.getSize();i++) {
+        analysisSet.get(i).setStatesStore(aStatesStore);
+    }
+
+    const int numFrames = iFinal - iInitial + 1;
+    int numParts = std::min(aNumThreads, numFrames / minFramesPerThread);
+    for (int i = 0; i < analysisSet.getSize() && numParts > 1; ++i) {
+        const Analysis& analysis = analysisSet.get(i);
+        if (analysis.getOn() && !analysis.isFrameIndependent()) {
+            log_info("Analyzing frames in order because analysis '{}' ({}) "
+                     "is not frame-independent.",
+                    analysis.getName(), analysis.getConcreteClassName());
+            numParts = 1;
+        }
+    }
+    if (numParts <= 1) {
+        runFrames(s, aModel, iInitial, iFinal, iFinal, aStatesStore,
+                aSolveForEquilibrium);
+        return;
+    }
+
+    // Divide the frames into contiguous parts. Part 0 is analyzed with aModel
+    // and the other parts with copies of aModel. The analyses for part p > 0
+    // begin at the last frame of part p - 1, so that each frame of part p is
+    // a step (with the same step number as when analyzing frames in order);
+    // the results for that first frame are discarded.
+    std::vector<int> partStart(numParts + 1);
+    for (int p = 0; p <= numParts; ++p) {
+        partStart[p] = iInitial + (int)((long long)numFrames * p / numParts);
+    }
+    log_info("Analyzing {} frames with {} threads.", numFrames, numParts);
+
+    // The copies are initialized before starting the threads because
+    // connecting some components (e.g., ExternalLoads) changes the working
+    // directory, which is shared by all threads.
+    std::vector<std::unique_ptr<Model>> copies;
+    std::vector<SimTK::State*> copyStates;
+    for (int p = 1; p < numParts; ++p) {
+        copies.emplace_back(aModel.clone());
+        copyStates.push_back(&copies.back()->initSystem());
+    }
+    std::vector<std::exception_ptr> errors(numParts);
+    std::vector<std::thread> threads;
+    for (int p = 1; p < numParts; ++p) {
+        threads.emplace_back([&, p]() {
+            try {
+                Model& copy = *copies[p - 1];
+                SimTK::State& copyState = *copyStates[p - 1];
+                AnalysisSet& copyAnalyses = copy.updAnalysisSet();
+                for (int i = 0; i < copyAnalyses.getSize(); ++i) {
+                    copyAnalyses.get(i).setStatesStore(aStatesStore);
+                }
+                runFrames(copyState, copy, partStart[p] - 1,
+                        partStart[p + 1] - 1, iFinal, aStatesStore,
+                        aSolveForEquilibrium);
+            } catch (...) {
+                errors[p] = std::current_exception();
+            }
+        });
+    }
+    try {
+        runFrames(s, aModel, iInitial, partStart[1] - 1, iFinal, aStatesStore,
+                aSolveForEquilibrium);
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+    for (auto& thread : threads) thread.join();
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+
+    // Append the results of the copies in time order.
+    for (int p = 1; p < numParts; ++p) {
+        double afterTime;
+        aStatesStore.getTime(partStart[p] - 1, afterTime);
+        const AnalysisSet& copyAnalyses = copies[p - 1]->getAnalysisSet();
+        for (int i = 0; i < analysisSet.getSize(); ++i) {
+            Analysis& analysis = analysisSet.get(i);
+            if (analysis.getOn()) {
+                analysis.appendResults(copyAnalyses.get(i), afterTime);
+            }
+        }
+    }
+}
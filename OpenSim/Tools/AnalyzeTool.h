@@ -68,6 +68,9 @@ private:
     /** Low-pass cut-off frequency for filtering the coordinates (does not apply to states). */
     PropertyDbl _lowpassCutoffFrequencyProp;
     double &_lowpassCutoffFrequency;
+    /** Number of threads used to run the analyses. */
+    PropertyInt _numThreadsProp;
+    int &_numThreads;
 
     /** Storage for the model states. */
     Storage *_statesStore;
@@ -119,6 +122,8 @@ public:
     void setSpeedsFileName(const std::string &aFileName) { _speedsFileName = aFileName; }
     double getLowpassCutoffFrequency() const { return _lowpassCutoffFrequency; }
     void setLowpassCutoffFrequency(double aLowpassCutoffFrequency) { _lowpassCutoffFrequency = aLowpassCutoffFrequency; }
+    int getNumThreads() const { return _numThreads; }
+    void setNumThreads(int aNumThreads) { _numThreads = aNumThreads; }
     bool getLoadModelAndInput() const { return _loadModelAndInput; }
     void setLoadModelAndInput(bool b) { _loadModelAndInput = b; }
 
@@ -141,6 +146,14 @@ public:
     //--------------------------------------------------------------------------
 #ifndef SWIG
     static void run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium);
+    /** Run the analyses with up to aNumThreads threads. If all analyses that
+    are on are frame-independent (see Analysis::isFrameIndependent()), the
+    frames are divided into contiguous parts; the first part is analyzed
+    with aModel and each other part with a copy of aModel (and its
+    analyses) on its own thread. The results of the copies are then appended
+    to the analyses of aModel in time order. Otherwise, the frames are
+    analyzed in order on this thread. */
+    static void run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium, int aNumThreads);
 #endif
 //=============================================================================
 };  // END of class AnalyzeTool
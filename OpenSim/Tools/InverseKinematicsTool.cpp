@@ -34,6 +34,7 @@
 #include <OpenSim/Common/FunctionSet.h>
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/Instrumentation.h>
 #include <OpenSim/Common/Stopwatch.h>
 #include <OpenSim/Common/Storage.h>
 #include <OpenSim/Common/XMLDocument.h>
@@ -190,6 +191,7 @@ bool InverseKinematicsTool::run()
         Stopwatch watch;
 
         for (int i = start_ix; i <= final_ix; ++i) {
+            OPENSIM_INSTRUMENT_SCOPE("InverseKinematicsTool::frame");
             s.updTime() = times[i];
             ikSolver.track(s);
             // show progress line every 1000 frames so users see progress
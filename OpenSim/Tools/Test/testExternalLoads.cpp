@@ -310,3 +310,24 @@ TEST_CASE("ExternalLoads Can Be Copied")
     OpenSim::Model copy{model};   // create an independent copy containing the `OpenSim::ExternalLoads`
     copy.finalizeConnections();   // should work (wasn't when this test was written)
 }
+
+// A model snapshot remembers the file that the `OpenSim::ExternalLoads` was
+// read from, so its data file is still found relative to that file.
+TEST_CASE("ExternalLoads In ModelSnapshot")
+{
+    OpenSim::Model model{"ExternalLoadsInSubdir/model-in-subdir.osim"};
+    model.addModelComponent(&dynamic_cast<OpenSim::ModelComponent&>(*Object::makeObjectFromFile("ExternalLoadsInSubdir/external-loads-in-subdir.xml")));
+    model.finalizeConnections();
+    ModelSnapshot::write(model, "testExternalLoads_model-in-subdir.osnap");
+
+    std::unique_ptr<Model> copy =
+            ModelSnapshot::read("testExternalLoads_model-in-subdir.osnap");
+    const auto& extLoads = *copy->getComponentList<ExternalLoads>().begin();
+    CHECK(extLoads.getDocumentFileName() ==
+            "ExternalLoadsInSubdir/external-loads-in-subdir.xml");
+    SimTK::State state = model.initSystem();
+    SimTK::State copyState = copy->initSystem();
+    model.realizeAcceleration(state);
+    copy->realizeAcceleration(copyState);
+    CHECK((copyState.getUDot() - state.getUDot()).normInf() == 0);
+}